@@ -0,0 +1,80 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/c_client_header.template
+extern const char * const kCClientHeader;
+
+const char * const kCClientHeader = 
+"{% if mlComment != \"\" %}\n"
+"{$mlComment}\n"
+"\n"
+"{% endif %}\n"
+"{$commonHeader()}\n"
+"\n"
+"#if !defined({$clientCGuardMacro})\n"
+"#define {$clientCGuardMacro}\n"
+"\n"
+"#include \"{$commonCHeaderName}\"\n"
+"#include \"erpc_client_manager.h\"\n"
+"{% for iface in group.interfaces %}\n"
+"{%  for fn in iface.functions %}\n"
+"{%   for externalInterface in fn.externalInterfaces %}\n"
+"{%    for interfaceFile in interfacesFiles %}\n"
+"{%     if externalInterface == interfaceFile.interfaceName %}\n"
+"#include \"c_{$interfaceFile.interfaceCommonFileName}_client.h\"\n"
+"{%     endif %}\n"
+"{%    endfor -- interfacesFiles %}\n"
+"{%   endfor -- externalInterface %}\n"
+"{%  endfor -- fn %}\n"
+"{% endfor -- iface %}\n"
+"\n"
+"#if defined(__cplusplus)\n"
+"extern \"C\"\n"
+"{\n"
+"#endif\n"
+"\n"
+"#if !defined({$getFunctionDeclarationMacroName()})\n"
+"#define {$getFunctionDeclarationMacroName()}\n"
+"\n"
+"{% for iface in group.interfaces %}\n"
+"{%  for cb in iface.callbacksInt%}\n"
+"typedef {$cb.typenameName};\n"
+"{%  endfor %}\n"
+"\n"
+"/*! @brief {$iface.name} identifiers */\n"
+"enum _{$iface.name}_ids\n"
+"{\n"
+"    k{$iface.name}_service_id = {$iface.id},\n"
+"{%  for fn in iface.functions %}\n"
+"    k{$iface.name}_{$fn.name}_id = {$fn.id},\n"
+"{%  endfor %}\n"
+"};\n"
+"\n"
+"{% endfor %}\n"
+"{% for iface in group.interfaces if iface.isNonExternalInterface == true %}\n"
+"{$> iface.mlComment}\n"
+"//! @name {$iface.name}\n"
+"//@{\n"
+"{%  for fn in iface.functions if fn.isNonExternalFunction == true %}\n"
+"{$> fn.mlComment}\n"
+"{$fn.prototype};{$fn.ilComment}{$loop.addNewLineIfNotLast}\n"
+"{%  endfor -- functions %}\n"
+"//@}{$iface.ilComment}\n"
+"\n"
+"{% endfor -- iface %}\n"
+"#endif // {$getFunctionDeclarationMacroName()}\n"
+"\n"
+"{% for iface in group.interfaces %}\n"
+"void init{$iface.clientClassName}(erpc_client_t client);\n"
+"\n"
+"void deinit{$iface.clientClassName}(void);\n"
+"\n"
+"{% endfor -- iface %}\n"
+"#if defined(__cplusplus)\n"
+"}\n"
+"#endif\n"
+"\n"
+"#endif // {$clientCGuardMacro}\n"
+;
+
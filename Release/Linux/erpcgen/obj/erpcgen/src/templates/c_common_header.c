@@ -0,0 +1,128 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/c_common_header.template
+extern const char * const kCCommonHeader;
+
+const char * const kCCommonHeader = 
+"{% if mlComment != \"\"%}\n"
+"{$mlComment}\n"
+"\n"
+"{% endif %}\n"
+"{$commonHeader()}\n"
+"\n"
+"#if !defined({$commonGuardMacro})\n"
+"#define {$commonGuardMacro}\n"
+"{% if usedUnionType %}\n"
+"\n"
+"#if defined(__CC_ARM) || defined(__ARMCC_VERSION)\n"
+"#pragma anon_unions\n"
+"#endif\n"
+"{% endif -- usedUnionType %}\n"
+"\n"
+"{% for inc in includes %}\n"
+"#include \"{$inc}\"\n"
+"{% endfor -- includes %}\n"
+"\n"
+"{% if cCommonHeaderFile %}\n"
+"#if defined(__cplusplus)\n"
+"extern \"C\"\n"
+"{\n"
+"#endif\n"
+"#include <stdbool.h>\n"
+"#include <stddef.h>\n"
+"#include <stdint.h>\n"
+"{% else %}\n"
+"#include <cstddef>\n"
+"#include <cstdint>\n"
+"{% endif %}\n"
+"\n"
+"#include \"erpc_version.h\"\n"
+"{% if empty(crc16) == false %}\n"
+"#include \"{$crcHeaderName}\"\n"
+"{% endif  -- empty(crc16) == false %}\n"
+"\n"
+"{$checkVersion()}\n"
+"{$>checkCrc()}\n"
+"\n"
+"#if !defined(ERPC_TYPE_DEFINITIONS{$scopeNamePrefix}{$scopeNameC})\n"
+"#define ERPC_TYPE_DEFINITIONS{$scopeNamePrefix}{$scopeNameC}\n"
+"{% if not empty(enums) %}\n"
+"\n"
+"// Enumerators data types declarations\n"
+"{%  for enum in enums %}\n"
+"{$> enum.mlComment}\n"
+"{%   if enum.name %}typedef {% endif --enum.name  %}enum{$addIndent(\" \", enum.name)}\n"
+"{\n"
+"{%   for enumMember in enum.members %}\n"
+"{$> addIndent(\"    \", enumMember.mlComment)}\n"
+"    {$enumMember.memberDeclaration}{$enumMember.ilComment}\n"
+"{%   endfor -- enumsMembers %}\n"
+"}{$addIndent(\" \", enum.name)};{$enum.ilComment}{$loop.addNewLineIfNotLast}\n"
+"{%  endfor -- enums %}\n"
+"{% endif -- enums %}\n"
+"{% if not empty(aliases) %}\n"
+"\n"
+"// Aliases data types declarations\n"
+"{%  for alias in aliases %}\n"
+"{$> alias.mlComment}\n"
+"{%   if alias.typenameName == \"\" %}\n"
+"typedef {$alias.unnamedType}\n"
+"{\n"
+"{%    for mem in alias.unnamed.members %}\n"
+"    {$mem.memberDeclaration}\n"
+"{%    endfor -- alias.unnamed.members %}\n"
+"} {$alias.unnamedName};\n"
+"{%   else -- alias.typenameName %}\n"
+"typedef {$alias.typenameName};{$alias.ilComment}\n"
+"{%   endif -- alias.typenameName %}\n"
+"{%  endfor -- aliases %}\n"
+"{% endif -- aliases %}\n"
+"{% if nonExternalStructUnion %}\n"
+"\n"
+"// Structures/unions data types declarations\n"
+"{%  for us in symbols %}\n"
+"{%   if !us.isExternal %}\n"
+"{%    if us.type == \"struct\" %}\n"
+"{$> us.mlComment}\n"
+"struct {$us.name}\n"
+"{\n"
+"{%     for mem in us.members %}\n"
+"{$> addIndent(\"    \", mem.mlComment)}\n"
+"    {$mem.memberDeclaration}{$mem.ilComment}\n"
+"{$> addIndent(\"    \", mem.elementsCount)}\n"
+"{%     endfor %}\n"
+"};{$us.ilComment}{$loop.addNewLineIfNotLast}\n"
+"{%    else -- us.type == \"union\" %}\n"
+"{$> us.mlComment}\n"
+"union {$us.name}\n"
+"{\n"
+"{$ addIndent(\"    \", unionMembersDeclaration(us))}\n"
+"};{$us.ilComment}{$loop.addNewLineIfNotLast}\n"
+"{%    endif -- us.type == \"union/struct\" %}\n"
+"{%   endif -- !us.isExternal %}\n"
+"{%  endfor -- symbols %}\n"
+"\n"
+"{% endif -- nonExternalStruct || nonExternalUnion %}\n"
+"{% if not empty(consts) %}\n"
+"\n"
+"// Constant variable declarations\n"
+"{%  for c in consts %}\n"
+"{$> c.mlComment}\n"
+"extern const {$c.typeAndName};{$c.ilComment}{$loop.addNewLineIfNotLast}\n"
+"{%  endfor -- consts %}\n"
+"{% endif -- consts %}\n"
+"\n"
+"#endif // ERPC_TYPE_DEFINITIONS{$scopeNamePrefix}{$scopeNameC}\n"
+"\n"
+"{% if cCommonHeaderFile %}\n"
+"#if defined(__cplusplus)\n"
+"}\n"
+"#endif\n"
+"{% else %}\n"
+"{% endif %}\n"
+"\n"
+"#endif // {$commonGuardMacro}\n"
+;
+
@@ -0,0 +1,85 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/c_server_header.template
+extern const char * const kCServerHeader;
+
+const char * const kCServerHeader = 
+"{% if mlComment != \"\" %}\n"
+"{$mlComment}\n"
+"\n"
+"{% endif %}\n"
+"{$commonHeader()}\n"
+"\n"
+"#if !defined({$serverCGuardMacro})\n"
+"#define {$serverCGuardMacro}\n"
+"\n"
+"#include \"{$commonCHeaderName}\"\n"
+"{% for iface in group.interfaces %}\n"
+"{%  for fn in iface.functions %}\n"
+"{%   for externalInterface in fn.externalInterfaces %}\n"
+"{%    for interfaceFile in interfacesFiles %}\n"
+"{%     if externalInterface == interfaceFile.interfaceName %}\n"
+"#include \"c_{$interfaceFile.interfaceCommonFileName}_client.h\"\n"
+"{%     endif %}\n"
+"{%    endfor -- interfacesFiles %}\n"
+"{%   endfor -- externalInterface %}\n"
+"{%  endfor -- fn %}\n"
+"{% endfor -- iface %}\n"
+"\n"
+"#if defined(__cplusplus)\n"
+"extern \"C\"\n"
+"{\n"
+"#endif\n"
+"\n"
+"typedef void * erpc_service_t;\n"
+"\n"
+"#if !defined({$getFunctionDeclarationMacroName()})\n"
+"#define {$getFunctionDeclarationMacroName()}\n"
+"\n"
+"{% for iface in group.interfaces %}\n"
+"{%  for cb in iface.callbacksInt%}\n"
+"typedef {$cb.typenameName};\n"
+"{%  endfor %}\n"
+"\n"
+"/*! @brief {$iface.name} identifiers */\n"
+"enum _{$iface.name}_ids\n"
+"{\n"
+"    k{$iface.name}_service_id = {$iface.id},\n"
+"{%  for fn in iface.functions %}\n"
+"    k{$iface.name}_{$fn.name}_id = {$fn.id},\n"
+"{%  endfor %}\n"
+"};\n"
+"\n"
+"{% endfor %}\n"
+"{% for iface in group.interfaces if iface.isNonExternalInterface == true %}\n"
+"{$> iface.mlComment}\n"
+"//! @name {$iface.name}\n"
+"//@{\n"
+"{%  for fn in iface.functions if fn.isNonExternalFunction == true %}\n"
+"{$> fn.mlComment}\n"
+"{$fn.prototype};{$fn.ilComment}{$loop.addNewLineIfNotLast}\n"
+"{%  endfor -- functions %}\n"
+"//@}{$iface.ilComment}\n"
+"\n"
+"{% endfor -- iface %}\n"
+"\n"
+"#endif // {$getFunctionDeclarationMacroName()}\n"
+"\n"
+"{% for iface in group.interfaces %}\n"
+"/*! @brief Return {$iface.serviceClassName} service object. */\n"
+"erpc_service_t create_{$iface.serviceClassName}(void);\n"
+"\n"
+"/*! @brief Destroy {$iface.serviceClassName} service object. */\n"
+"void destroy_{$iface.serviceClassName}(erpc_service_t service);\n"
+"\n"
+"{% endfor -- iface %}\n"
+"\n"
+"#if defined(__cplusplus)\n"
+"}\n"
+"#endif\n"
+"\n"
+"#endif // {$serverCGuardMacro}\n"
+;
+
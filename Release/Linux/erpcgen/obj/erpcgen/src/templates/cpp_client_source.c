@@ -0,0 +1,208 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/cpp_client_source.template
+extern const char * const kCppClientSource;
+
+const char * const kCppClientSource = 
+"{% set source = \"client\" >%}\n"
+"{% if mlComment != \"\" %}\n"
+"{$mlComment}\n"
+"\n"
+"{% endif %}\n"
+"{$commonHeader()}\n"
+"\n"
+"#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC\n"
+"#include \"erpc_port.h\"\n"
+"#endif\n"
+"#include \"{$codecHeader}\"\n"
+"#include \"{$clientCppHeaderName}\"\n"
+"#include \"erpc_manually_constructed.hpp\"\n"
+"\n"
+"{$checkVersion()}\n"
+"{$>checkCrc()}\n"
+"using namespace erpc;\n"
+"using namespace std;\n"
+"{$usingNamespace() >}\n"
+"{$generateCrcVariable()}\n"
+"{$> setSharedMemAddresses()}\n"
+"{$> constantsDefinitions(consts)}\n"
+"{$> symbolHeader(group.symbolsMap.symbolsToServer, \"serial\", \"def\")}\n"
+"{$> symbolSource(group.symbolsMap.symbolsToServer, \"serial\", \"def\")}\n"
+"{$> symbolHeader(group.symbolsMap.symbolsToClient, \"deserial\", \"def\")}\n"
+"{$> symbolSource(group.symbolsMap.symbolsToClient, \"deserial\", \"def\")}\n"
+"{$> symbolHeader(group.symbolsMap.symbolsToServer, \"serial\", \"noSharedMem\")}\n"
+"{$> symbolSource(group.symbolsMap.symbolsToServer, \"serial\", \"noSharedMem\")}\n"
+"{$> symbolHeader(group.symbolsMap.symbolsToClient, \"deserial\", \"noSharedMem\")}\n"
+"{$> symbolSource(group.symbolsMap.symbolsToClient, \"deserial\", \"noSharedMem\")}\n"
+"\n"
+"{% def clientShimCode(client, fn, serverIDName, functionIDName) ------------------------- clientShimCode(fn, serverIDName, functionIDName) %}\n"
+"{% set clientIndent = \"\" >%}\n"
+"{% if generateErrorChecks %}\n"
+"    erpc_status_t err = kErpcStatus_Success;\n"
+"\n"
+"{% endif -- generateErrorChecks %}\n"
+"{% if fn.isReturnValue %}\n"
+"{%  if fn.needTempVariableClientI32 %}\n"
+"    int32_t _tmp_local_i32;\n"
+"{%  endif %}\n"
+"{% endif %}\n"
+"{% if fn.needTempVariableClientU16 %}\n"
+"    uint16_t _tmp_local_u16;\n"
+"{% endif %}\n"
+"{% if fn.returnValue.type.isNotVoid %}\n"
+"    {$fn.returnValue.resultVariable}{% if fn.returnValue.isNullReturnType %} = NULL{% endif %};\n"
+"{% endif -- isNotVoid %}\n"
+"\n"
+"#if ERPC_PRE_POST_ACTION\n"
+"    pre_post_action_cb preCB = {$client}->getPreCB();\n"
+"    if (preCB)\n"
+"    {\n"
+"        preCB();\n"
+"    }\n"
+"#endif\n"
+"\n"
+"    // Get a new request.\n"
+"{% if !fn.isReturnValue %}\n"
+"    RequestContext request = {$client}->createRequest(true);\n"
+"{% else %}\n"
+"    RequestContext request = {$client}->createRequest(false);\n"
+"{% endif -- isReturnValue %}\n"
+"\n"
+"    // Encode the request.\n"
+"{% if codecClass == \"Codec\" %}\n"
+"    {$codecClass} * codec = request.getCodec();\n"
+"{% else %}\n"
+"    {$codecClass} * codec = static_cast<{$codecClass} *>(request.getCodec());\n"
+"{% endif %}\n"
+"\n"
+"{% if generateAllocErrorChecks %}\n"
+"{%  set clientIndent = \"    \" >%}\n"
+"    if (codec == NULL)\n"
+"    {\n"
+"        err = kErpcStatus_MemoryError;\n"
+"    }\n"
+"    else\n"
+"    {\n"
+"{% endif -- generateErrorChecks %}\n"
+"{$clientIndent}    codec->startWriteMessage({% if not fn.isReturnValue %}message_type_t::kOnewayMessage{% else %}message_type_t::kInvocationMessage{% endif %}, {$serverIDName}, {$functionIDName}, request.getSequence());\n"
+"\n"
+"{% if fn.isSendValue %}\n"
+"{%  for param in fn.parameters if (param.serializedDirection == \"\" || param.serializedDirection == OutDirection || param.referencedName != \"\") %}\n"
+"{%   if param.isNullable %}\n"
+"{$ addIndent(clientIndent & \"    \", f_paramIsNullableEncode(param))}\n"
+"\n"
+"{%   else -- isNullable %}\n"
+"{%    if param.direction != OutDirection %}\n"
+"{$addIndent(clientIndent & \"    \", param.coderCall.encode(param.coderCall))}\n"
+"\n"
+"{%    endif -- param != OutDirection %}\n"
+"{%   endif -- isNullable %}\n"
+"{%  endfor -- fn parameters %}\n"
+"{% endif -- isSendValue %}\n"
+"{$clientIndent}    // Send message to server\n"
+"{$clientIndent}    // Codec status is checked inside this function.\n"
+"{$clientIndent}    {$client}->performRequest(request);\n"
+"{% if fn.isReturnValue %}\n"
+"{%  for param in fn.parametersToClient if (param.serializedDirection == \"\" || param.serializedDirection == InDirection || param.referencedName != \"\") %}\n"
+"\n"
+"{%   if param.isNullable %}\n"
+"{%    if ((source == \"client\") && (param.direction != ReturnDirection) && (empty(param.lengthName) == false)) %}\n"
+"{%     set lengthNameCon = \") && (\" & param.lengthName & \" != NULL)\" >%}\n"
+"{%    else %}\n"
+"{%     set lengthNameCon = \"\" >%}\n"
+"{%    endif %}\n"
+"{$clientIndent}    if ({% if lengthNameCon != \"\" %}({% endif %}{$param.nullableName} != NULL{$lengthNameCon})\n"
+"{$clientIndent}    {\n"
+"{$addIndent(clientIndent & \"        \", param.coderCall.decode(param.coderCall))}\n"
+"        }\n"
+"{%   else -- notNullable %}\n"
+"{$addIndent(clientIndent & \"    \", param.coderCall.decode(param.coderCall))}\n"
+"{%   endif -- isNullable %}\n"
+"{%  endfor -- fn parametersToClient %}\n"
+"{%  if fn.returnValue.type.isNotVoid %}\n"
+"\n"
+"{%   if fn.returnValue.isNullable %}\n"
+"{$clientIndent}    bool isNull;\n"
+"{$addIndent(clientIndent & \"    \", f_paramIsNullableDecode(fn.returnValue))}\n"
+"{%   else -- isNullable %}\n"
+"{$> addIndent(clientIndent & \"    \", allocMem(fn.returnValue.firstAlloc))}\n"
+"{$addIndent(clientIndent & \"    \", fn.returnValue.coderCall.decode(fn.returnValue.coderCall))}\n"
+"{%   endif -- isNullable %}\n"
+"{%  endif -- isNotVoid %}\n"
+"{% endif -- isReturnValue %}\n"
+"{% if generateErrorChecks %}\n"
+"\n"
+"{$clientIndent}    err = codec->getStatus();\n"
+"{% endif -- generateErrorChecks %}\n"
+"{%    if generateAllocErrorChecks %}\n"
+"    }\n"
+"{% endif -- generateAllocErrorChecks %}\n"
+"\n"
+"    // Dispose of the request.\n"
+"    {$client}->releaseRequest(request);\n"
+"{% if generateErrorChecks %}\n"
+"\n"
+"    // Invoke error handler callback function\n"
+"    {$client}->callErrorHandler(err, {$functionIDName});\n"
+"{% endif -- generateErrorChecks %}\n"
+"\n"
+"#if ERPC_PRE_POST_ACTION\n"
+"    pre_post_action_cb postCB = {$client}->getPostCB();\n"
+"    if (postCB)\n"
+"    {\n"
+"        postCB();\n"
+"    }\n"
+"#endif\n"
+"\n"
+"{% if generateErrorChecks && fn.returnValue.type.isNotVoid %}\n"
+"{%  if empty(fn.returnValue.errorReturnValue) == false && fn.returnValue.isNullReturnType == false %}\n"
+"\n"
+"    if (err != kErpcStatus_Success)\n"
+"    {\n"
+"        result = {$fn.returnValue.errorReturnValue};\n"
+"    }\n"
+"{%  endif %}\n"
+"{% endif -- generateErrorChecks %}\n"
+"\n"
+"    return{% if fn.returnValue.type.isNotVoid %} result{% endif -- isNotVoid %};\n"
+"{% enddef --------------------------------------------------------------------------------- clientShimCode(fn, serverIDName, functionIDName) %}\n"
+"{% for iface in group.interfaces %}\n"
+"{%  for cb in iface.callbacksInt if (count(cb.callbacks) > 1) %}\n"
+"\n"
+"// Common function for serializing and deserializing callback functions of same type.\n"
+"static {$cb.callbacksData.prototype};\n"
+"{% endfor %}\n"
+"{%  for cb in iface.callbacksInt if (count(cb.callbacks) > 1) %}\n"
+"\n"
+"// Common function for serializing and deserializing callback functions of same type.\n"
+"static {$cb.callbacksData.prototype}\n"
+"{\n"
+"{$ clientShimCode(\"m_clientManager\", cb.callbacksData, \"serviceID\", \"functionID\") >}\n"
+"}\n"
+"{% endfor %}\n"
+"\n"
+"{$iface.clientClassName}::{$iface.clientClassName}(ClientManager *manager)\n"
+":m_clientManager(manager)\n"
+"{\n"
+"}\n"
+"\n"
+"{$iface.clientClassName}::~{$iface.clientClassName}()\n"
+"{\n"
+"}\n"
+"{% for fn in iface.functions %}\n"
+"\n"
+"// {$iface.name} interface {$fn.name} function client shim.\n"
+"{$fn.prototypeCpp}\n"
+"{\n"
+"{%  if fn.isCallback %}\n"
+"    {% if fn.returnValue.type.isNotVoid %}return {% endif %}{$fn.callbackFName}(m_clientManager, m_serviceId, {$getClassFunctionIdName(fn)}{% for param in fn.parameters %}, {$param.pureName}{% endfor %});\n"
+"{%  else -- fn.isCallback >%}\n"
+"{$ clientShimCode(\"m_clientManager\", fn, \"m_serviceId\", getClassFunctionIdName(fn)) >}\n"
+"{%  endif -- fn.isCallback >%}\n"
+"}\n"
+"{% endfor -- fn %}\n"
+"{% endfor -- iface %}\n"
+;
+
@@ -0,0 +1,399 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/cpp_coders.template
+extern const char * const kCppCoders;
+
+const char * const kCppCoders = 
+"{% def decodeBuiltinType(info) --------------- BuiltinType %}\n"
+"{% if info.builtinType == \"kStringType\" %}\n"
+"{\n"
+"    uint32_t {$info.stringLocalName}_len;\n"
+"    char * {$info.stringLocalName}_local;\n"
+"    codec->readString({$info.stringLocalName}_len, &{$info.stringLocalName}_local);\n"
+"{%  if info.stringAllocSize != info.stringLocalName & \"_len\" %}\n"
+"    if (({$info.stringAllocSize} >= 0) && ({$info.stringLocalName}_len <= static_cast<uint32_t>({$info.stringAllocSize})))\n"
+"    {\n"
+"{%   set indent = \"    \" >%}\n"
+"{% else %}\n"
+"{%   set indent = \"\" >%}\n"
+"{% endif  -- if info.stringAllocSize != info.stringLocalName & \"_len\" %}\n"
+"{%  if ((source == \"client\" && info.withoutAlloc == false) or source == \"server\") %}\n"
+"{$indent}    {$info.name} = ({$info.builtinTypeName}) erpc_malloc(({$info.stringAllocSize} + 1) * sizeof(char));\n"
+"{%   if generateAllocErrorChecks == true %}\n"
+"{$indent}    if (({$info.name} == NULL) || ({$info.stringLocalName}_local == NULL))\n"
+"{$indent}    {\n"
+"{$indent}        codec->updateStatus(kErpcStatus_MemoryError);\n"
+"{$indent}    }\n"
+"{$indent}    else\n"
+"{$indent}    {\n"
+"{%   endif -- generateAllocErrorChecks == true %}\n"
+"{%  endif -- withoutAlloc %}\n"
+"{$indent}    {%  if (((source == \"client\" && info.withoutAlloc == false) or source == \"server\") && generateAllocErrorChecks == true) %}    {%  endif -- withoutAlloc %}memcpy({$info.name}, {$info.stringLocalName}_local, {$info.stringLocalName}_len);\n"
+"{$indent}    {%  if (((source == \"client\" && info.withoutAlloc == false) or source == \"server\") && generateAllocErrorChecks == true) %}    {%  endif -- withoutAlloc %}({$info.name})[{$info.stringLocalName}_len] = 0;\n"
+"{%  if (((source == \"client\" && info.withoutAlloc == false) or source == \"server\") && generateAllocErrorChecks == true) %}\n"
+"    {$indent}}\n"
+"{%  endif -- withoutAlloc && generateAllocErrorChecks %}\n"
+"{%  if info.stringAllocSize != info.stringLocalName & \"_len\" %}\n"
+"    }\n"
+"    else\n"
+"    {\n"
+"        codec->updateStatus(kErpcStatus_InvalidArgument);\n"
+"    }\n"
+"{% endif  -- if info.stringAllocSize != info.stringLocalName & \"_len\" %}\n"
+"}\n"
+"{% else %}\n"
+"{%  if source == \"client\" && info.pointerScalarTypes %}\n"
+"codec->read(*{$info.name});\n"
+"{%  else %}\n"
+"codec->read({$info.name});\n"
+"{%  endif -- pointerScalarTypes %}\n"
+"{% endif -- builtinType %}\n"
+"{% enddef ------------------------------- BuiltinType %}\n"
+"\n"
+"{% def decodeBinaryType(info) --------------- BinaryType %}\n"
+"{% if info.hasLengthVariable %}\n"
+"uint32_t {$info.sizeTemp};\n"
+"{% endif %}\n"
+"uint8_t * {$info.dataTemp};\n"
+"codec->readBinary({$info.sizeTemp}, &{$info.dataTemp});\n"
+"{% if info.hasLengthVariable && not info.constantVariable %}\n"
+"{%  if info.pointerScalarTypes && source == \"client\" %}*{% endif %}{$info.size} = {$info.sizeTemp};\n"
+"{% endif %}\n"
+"{% if info.maxSize != info.sizeTemp %}\n"
+"if (({$info.sizeTemp} <= {$info.maxSize}) && ({$info.dataTemp} != NULL))\n"
+"{\n"
+"{%   set indent = \"    \" >%}\n"
+"{% else %}\n"
+"{%   set indent = \"\" >%}\n"
+"{% endif %}\n"
+"{$indent}if ({$info.sizeTemp} > 0)\n"
+"{$indent}{\n"
+"{% if source == \"server\" || info.useMallocOnClientSide == true %}\n"
+"{$indent}{$info.name} = (uint8_t *) erpc_malloc({$info.maxSize} * sizeof(uint8_t));\n"
+"{%  if generateAllocErrorChecks == true %}\n"
+"{$indent}    if ({$info.name} == NULL)\n"
+"{$indent}    {\n"
+"{$indent}        codec->updateStatus(kErpcStatus_MemoryError);\n"
+"{$indent}    }\n"
+"{$indent}    else\n"
+"{$indent}    {\n"
+"{$indent}        memcpy({$info.name}, {$info.dataTemp}, {$info.sizeTemp});\n"
+"{$indent}    }\n"
+"{%  else -- generateAllocErrorChecks == true %}\n"
+"{$indent}    memcpy({$info.name}, {$info.dataTemp}, {$info.sizeTemp});\n"
+"{%  endif -- generateAllocErrorChecks == true %}\n"
+"{% else %}\n"
+"{$indent}    memcpy({$info.name}, {$info.dataTemp}, {$info.sizeTemp});\n"
+"{% endif %}\n"
+"{$indent}}\n"
+"{% if source == \"server\" || info.useMallocOnClientSide == true %}\n"
+"{$indent}else\n"
+"{$indent}{\n"
+"{$indent}    {$info.name} = NULL;\n"
+"{$indent}}\n"
+"{% endif %}\n"
+"{% if info.maxSize != info.sizeTemp %}\n"
+"}\n"
+"else\n"
+"{\n"
+"    codec->updateStatus(kErpcStatus_InvalidArgument);\n"
+"}\n"
+"{% endif %}\n"
+"{% enddef ------------------------------- BinaryType %}\n"
+"\n"
+"{% def decodeEnumType(info) ---------------- EnumType %}\n"
+"codec->read(_tmp_local_i32);\n"
+"{% if source == \"client\" && info.pointerScalarTypes %}\n"
+"*{$info.name} = static_cast<{$info.enumName}>(_tmp_local_i32);\n"
+"{% else %}\n"
+"{$info.name} = static_cast<{$info.enumName}>(_tmp_local_i32);\n"
+"{% endif -- pointerScalarTypes %}\n"
+"{% enddef ---------------------------------- EnumType %}\n"
+"\n"
+"{% def decodeListType(info) ------------------- ListType %}\n"
+"{% if info.useBinaryCoder >%}\n"
+"{$decodeBinaryType(info) >}\n"
+"{% else >%}\n"
+"{%  if info.hasLengthVariable %}\n"
+"uint32_t {$info.sizeTemp};\n"
+"{%  endif %}\n"
+"codec->startReadList({$info.sizeTemp});\n"
+"{%  if info.hasLengthVariable && not info.constantVariable %}\n"
+"{%   if info.pointerScalarTypes && source == \"client\" %}*{% endif %}{$info.size} = {$info.sizeTemp};\n"
+"{%  endif %}\n"
+"{%  if info.maxSize != info.sizeTemp %}\n"
+"if ({$info.sizeTemp} <= {$info.maxSize})\n"
+"{\n"
+"{%   set indent = \"    \" >%}\n"
+"{%  else %}\n"
+"{%   set indent = \"\" >%}\n"
+"{%  endif %}\n"
+"{%  if source == \"server\" || info.useMallocOnClientSide == true %}\n"
+"{$indent}{$info.name} = ({$info.mallocType}) erpc_malloc({$info.maxSize} * sizeof({$info.mallocSizeType}));\n"
+"{%   if generateAllocErrorChecks == true %}\n"
+"{$indent}if (({$info.name} == NULL) && ({$info.sizeTemp} > 0))\n"
+"{$indent}{\n"
+"{$indent}    codec->updateStatus(kErpcStatus_MemoryError);\n"
+"{$indent}}\n"
+"{%   endif -- generateAllocErrorChecks == true %}\n"
+"{$      addIndent(indent, decodeArrayType(info))}\n"
+"{%  else %}\n"
+"{$addIndent(indent, decodeArrayType(info))}\n"
+"{%  endif %}\n"
+"{%  if info.maxSize != info.sizeTemp %}\n"
+"}\n"
+"else\n"
+"{\n"
+"    codec->updateStatus(kErpcStatus_Fail);\n"
+"}\n"
+"{%  endif %}\n"
+"{% endif >%}\n"
+"{% enddef ------------------------------------- ListType %}\n"
+"\n"
+"{% def decodeArrayType(info) -------------- ArrayType %}\n"
+"{% if codecClass == \"BasicCodec\" && !empty(info.builtinTypeName) >%}\n"
+"{$decodeData(info)>}\n"
+"{% else >%}\n"
+"for (uint32_t {$info.forLoopCount} = 0U; {$info.forLoopCount} < {$info.sizeTemp}; ++{$info.forLoopCount})\n"
+"{\n"
+"{$addIndent(\"    \", info.protoNext.decode(info.protoNext))}\n"
+"}\n"
+"{% endif >%}\n"
+"{% enddef ----------------------------------- ArrayType %}\n"
+"\n"
+"{% def decodeStructType(info) --------------- StructType %}\n"
+"{% if info.inDataContainer %}\n"
+"read_{$info.typeName}_struct(codec, &({$info.name}));\n"
+"{% else -- not inDataContainer %}\n"
+"read_{$info.typeName}_struct(codec, {$info.name});\n"
+"{% endif -- inDataContainer %}\n"
+"{% enddef -------------------------- StructType %}\n"
+"\n"
+"{% def decodeUnionParamType(info) --------------- UnionParamType %}\n"
+"{% if info.inDataContainer %}\n"
+"{%  if info.castDiscriminator %}\n"
+"read_{$info.typeName}_union(codec, _tmp_local_i32, &{$info.name});\n"
+"{%   if !info.isConstant %}\n"
+"{$info.dataLiteral}{$info.discriminatorName} = static_cast<{$info.discriminatorType}>(_tmp_local_i32);\n"
+"{%   endif %}\n"
+"{%  else %}\n"
+"read_{$info.typeName}_union(codec, {$info.dataLiteral}{$info.discriminatorName}, &{$info.name});\n"
+"{%  endif -- castDiscriminator %}\n"
+"{% else -- not inDataContainer %}\n"
+"{%  if info.castDiscriminator %}\n"
+"read_{$info.typeName}_union(codec, _tmp_local_i32, {$info.name});\n"
+"{%   if !info.isConstant %}\n"
+"{%    if info.discrimPtr == true && source == \"client\" %}*{% endif %}{$info.discriminatorName} = static_cast<{$info.discriminatorType}>(_tmp_local_i32);\n"
+"{%   endif %}\n"
+"{%  else %}\n"
+"read_{$info.typeName}_union(codec, {% if info.discrimPtr == true && source == \"client\" %}*{% endif %}{$info.discriminatorName}, {$info.name});\n"
+"{%  endif  -- castDiscriminator %}\n"
+"{% endif -- inDataContainer %}\n"
+"{% enddef -------------------------- UnionParamType %}\n"
+"\n"
+"{% def decodeUnionType(info) ---------------- %}\n"
+"codec->startReadUnion({% if info.castDiscriminator %}{% if info.dataLiteral == \"\" %}*{% endif %}_tmp_local_i32{% else %}{% if info.dataLiteral != \"\" %}{$info.dataLiteral}{% endif %}{$info.discriminatorName}{% endif %});\n"
+"{% if info.castDiscriminator %}\n"
+"{$info.dataLiteral}{$info.discriminatorName} = static_cast<{$info.discriminatorType}>(_tmp_local_i32);\n"
+"{% endif -- info.castDiscriminator %}\n"
+"switch ({% if info.dataLiteral != \"\" %}{$info.dataLiteral}{% endif %}{$info.discriminatorName})\n"
+"{\n"
+"{% for case in info.cases %}\n"
+"    {% if case.name != \"default\" %}case {% endif %}{% if case.name != \"\" %}{$case.name}{% else %}{$case.value}{%  endif %}:\n"
+"    {\n"
+"{%  for member in case.members %}\n"
+"{% if source == \"server\" %}\n"
+"{$> addIndent(\"        \", allocMem(member.coderCall.memberAllocation))}\n"
+"{% endif %}\n"
+"{$> addIndent(\"        \", member.coderCall.decode(member.coderCall))}\n"
+"{%  endfor -- members %}\n"
+"        break;\n"
+"    }\n"
+"{% endfor -- cases %}\n"
+"}\n"
+"{% enddef -------------------------- UnionType %}\n"
+"\n"
+"{% def decodeFunctionType(info) %}\n"
+"{% if info.callbacksCount == 1 %}\n"
+"{% if param.direction != InDirection %}*{% endif %}{$info.name} = &{% if param.ifaceScope != \"\"%}{$param.ifaceScope}{% else %}{$iface.name}{% endif %}_interface::{$info.callbacks};\n"
+"{% else -- info.callbacksCount == 1 %}\n"
+"codec->read(_tmp_local_u16);\n"
+"if (!{% if param.ifaceScope != \"\"%}{$param.ifaceScope}{% else %}{$iface.name}{% endif %}_interface::get_callbackAddress_{$info.cbTypeName}(_tmp_local_u16, {% if param.direction == InDirection %}&{% endif %}{$info.cbParamOutName}))\n"
+"{\n"
+"    codec->updateStatus(kErpcStatus_UnknownCallback);\n"
+"}\n"
+"{% endif -- info.callbacksCount == 1 %}\n"
+"{% enddef -------------------------- FunctionType %}\n"
+"\n"
+"{% def decodeSharedType(info) %}\n"
+"codec->readPtr(reinterpret_cast<uintptr_t &>({% if ((info.funcParam == true && info.InoutOutDirection == true) && source == \"client\") %}*{%  endif %}{$info.name}));\n"
+"{% if info.sharedType != \"\" %}\n"
+"{%  if info.sharedType == \"struct\" %}\n"
+"{%   if info.inDataContainer %}\n"
+"read_{$info.sharedType}_struct_shared(codec, &({$info.name}));\n"
+"{%   else -- not inDataContainer %}\n"
+"read_{$info.sharedType}_struct_shared(codec, {$info.name});\n"
+"{%   endif -- inDataContainer %}\n"
+"{%  else %}\n"
+"{%   if info.inDataContainer %}\n"
+"{%    if info.castDiscriminator %}\n"
+"read_{$info.sharedType}_union_shared(codec, _tmp_local_i32, &{$info.name});\n"
+"{$info.dataLiteral}{$info.discriminatorName} = static_cast<{$info.discriminatorType}>(_tmp_local_i32);\n"
+"{%    else %}\n"
+"read_{$info.sharedType}_union_shared(codec, {$info.dataLiteral}{$info.discriminatorName}, &{$info.name});\n"
+"{%    endif -- castDiscriminator %}\n"
+"{%   else -- not inDataContainer %}\n"
+"{%    if info.castDiscriminator %}\n"
+"read_{$info.sharedType}_union_shared(codec, _tmp_local_i32, {$info.name});\n"
+"{%     if info.discrimPtr == true && source == \"client\" %}*{% endif %}{$info.discriminatorName} = static_cast<{$info.discriminatorType}>(_tmp_local_i32);\n"
+"{%    else %}\n"
+"read_{$info.sharedType}_union_shared(codec, {% if info.discrimPtr == true && source == \"client\" %}*{% endif %}{$info.discriminatorName}, {$info.name});\n"
+"{%    endif  -- castDiscriminator %}\n"
+"{%   endif -- inDataContainer %}\n"
+"{%  endif %}\n"
+"{% endif %}\n"
+"{% enddef -------------------------- SharedType %}\n"
+"\n"
+"{% def decodeData(info) -------------------%}\n"
+"codec->readData({$info.name}, {$info.sizeTemp} * sizeof({$info.builtinTypeName}));\n"
+"{% enddef --------------------------------------- decodeData %}\n"
+"{# ----------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------#}\n"
+"\n"
+"\n"
+"{# Encode sending data #}\n"
+"{% def encodeBuiltinType(info) -----------------  %}\n"
+"{% if info.builtinType == \"kStringType\" %}\n"
+"{\n"
+"    uint32_t {$info.stringLocalName}_len = strlen((const char*){$info.name});\n"
+"\n"
+"{% if info.stringAllocSize != info.stringLocalName & \"_len\"  %}\n"
+"    erpc_assert({$info.stringAllocSize} >= 0);\n"
+"    erpc_assert({$info.stringLocalName}_len <= static_cast<uint32_t>({$info.stringAllocSize}));\n"
+"\n"
+"{% endif %}\n"
+"    codec->writeString({$info.stringLocalName}_len, (const char*){$info.name});\n"
+"}\n"
+"{% else %}\n"
+"{%  if source == \"client\" && info.pointerScalarTypes %}\n"
+"codec->write(*{$info.name});\n"
+"{%  else %}\n"
+"codec->write({$info.name});\n"
+"{%  endif -- pointerScalarTypes %}\n"
+"{% endif -- builtinType %}\n"
+"{% enddef --------------------------------------- BuiltinType %}\n"
+"\n"
+"{% def encodeBinaryType(info) -----------------  %}\n"
+"{% if info.sizeTemp != info.maxSize %}\n"
+"erpc_assert({% if source == \"client\" && info.pointerScalarTypes %}*{% endif %}{$info.size} <= {$info.maxSize} * sizeof({$info.mallocSizeType}));\n"
+"{% endif %}\n"
+"codec->writeBinary({% if source == \"client\" && info.pointerScalarTypes %}*{% endif %}{$info.size}, {$info.name});\n"
+"{% enddef --------------------------------------- BinaryType %}\n"
+"\n"
+"{% def encodeEnumType(info) ---------------------%}\n"
+"{% if source == \"client\" && info.pointerScalarTypes %}\n"
+"codec->write(static_cast<int32_t>(*{$info.name}));\n"
+"{% else %}\n"
+"codec->write(static_cast<int32_t>({$info.name}));\n"
+"{% endif -- pointerScalarTypes %}\n"
+"{% enddef --------------------------------------- Enum %}\n"
+"\n"
+"{% def encodeListType(info) ---------------------------%}\n"
+"{% if info.useBinaryCoder >%}\n"
+"{$encodeBinaryType(info)>}\n"
+"{% else >%}\n"
+"codec->startWriteList({% if source == \"client\" && info.pointerScalarTypes %}*{% endif %}{$info.size});\n"
+"{$encodeArrayType(info)) >}\n"
+"{% endif >%}\n"
+"{% enddef ------------------------------------ ListType %}\n"
+"\n"
+"{% def encodeArrayType(info) --------------------- %}\n"
+"{% if codecClass == \"BasicCodec\" && !empty(info.builtinTypeName) >%}\n"
+"{$encodeData(info) >}\n"
+"{% else >%}\n"
+"for (uint32_t {$info.forLoopCount} = 0U; {$info.forLoopCount} < {% if source == \"client\" && info.pointerScalarTypes %}*{% endif %}{$info.size}; ++{$info.forLoopCount})\n"
+"{\n"
+"{$addIndent(\"    \", info.protoNext.encode(info.protoNext))}\n"
+"}\n"
+"{% endif >%}\n"
+"{% enddef --------------------------------------- ArrayType %}\n"
+"\n"
+"{% def encodeStructType(info) -------------------%}\n"
+"{% if info.inDataContainer %}\n"
+"write_{$info.typeName}_struct(codec, &({$info.name}));\n"
+"{% else -- not inDataContainer %}\n"
+"write_{$info.typeName}_struct(codec, {$info.name});\n"
+"{% endif -- inDataContainer %}\n"
+"{% enddef --------------------------------------- StructType %}\n"
+"\n"
+"{% def encodeUnionParamType(info) --------------- UnionParamType %}\n"
+"{% if info.inDataContainer %}\n"
+"write_{$info.typeName}_union(codec, {% if info.castDiscriminator %}static_cast<int32_t>({% endif %}{$info.dataLiteral}{$info.discriminatorName}{% if info.castDiscriminator %}){% endif %}, &{$info.name});\n"
+"{% else -- not inDataContainer %}\n"
+"write_{$info.typeName}_union(codec, {% if info.castDiscriminator %}static_cast<int32_t>({% endif %}{% if info.discrimPtr == true && source == \"client\" %}*{% endif %}{$info.discriminatorName}{% if info.castDiscriminator %}){% endif %}, {$info.name});\n"
+"{% endif -- inDataContainer %}\n"
+"{% enddef -------------------------- UnionParamType %}\n"
+"\n"
+"{% def encodeUnionType(info) ---------------- %}\n"
+"codec->startWriteUnion({% if info.castDiscriminator %}static_cast<int32_t>({% endif %}{$info.dataLiteral}{$info.discriminatorName}{% if info.castDiscriminator %}){% endif %});\n"
+"switch ({$info.dataLiteral}{$info.discriminatorName})\n"
+"{\n"
+"{% for case in info.cases %}\n"
+"    {% if case.name != \"default\" %}case {% endif %}{% if case.name != \"\" %}{$case.name}{% else %}{$case.value}{% endif %}:\n"
+"    {\n"
+"{%  for member in case.members %}\n"
+"{$> addIndent(\"        \", member.coderCall.encode(member.coderCall))}\n"
+"{%  endfor -- members %}\n"
+"        break;\n"
+"    }\n"
+"{% endfor -- cases %}\n"
+"}\n"
+"{% enddef -------------------------- UnionType %}\n"
+"\n"
+"{% def encodeFunctionType(info) %}\n"
+"{% if info.callbacksCount == 1 %}\n"
+"/* No need to serialize code for {$info.name} when only one cb exists. */\n"
+"// (void){% if param.ifaceScope != \"\"%}{$param.ifaceScope}{% else %}{$iface.name}{% endif %}_interface::get_callbackIdx_{$info.cbTypeName}(&{$info.name}, _tmp_local_u16);\n"
+"// codec->write(_tmp_local_u16);\n"
+"{% else -- info.callbacksCount == 1 %}\n"
+"(void){% if param.ifaceScope != \"\"%}{$param.ifaceScope}{% else %}{$iface.name}{% endif %}_interface::get_callbackIdx_{$info.cbTypeName}(&{$info.name}, _tmp_local_u16);\n"
+"codec->write(_tmp_local_u16);\n"
+"{% endif -- info.callbacksCount == 1 %}\n"
+"{% enddef -------------------------- FunctionType %}\n"
+"\n"
+"{% def encodeSharedType(info) %}\n"
+"{% if sharedMemBeginAddr != \"\" %}\n"
+"if (({$info.name} >= ERPC_SHARED_MEMORY_BEGIN) && ({$info.name} <= ERPC_SHARED_MEMORY_END))\n"
+"{\n"
+"    codec->writePtr(reinterpret_cast<uintptr_t>({%if source == \"client\" && info.InoutOutDirection %}*{% endif %}{$info.name}));\n"
+"}\n"
+"else\n"
+"{\n"
+"    codec->updateStatus(kErpcStatus_MemoryError);\n"
+"}\n"
+"{% else %}\n"
+"codec->writePtr(reinterpret_cast<uintptr_t>({%if source == \"client\" && info.InoutOutDirection %}*{% endif %}{$info.name}));\n"
+"{% endif %}\n"
+"{% if info.sharedType != \"\" %}\n"
+"{%  if info.sharedType == \"struct\" %}\n"
+"{%   if info.inDataContainer %}\n"
+"write_{$info.typeName}_struct(codec, &({$info.name}));\n"
+"{%   else -- not inDataContainer %}\n"
+"write_{$info.typeName}_struct(codec, {$info.name});\n"
+"{%   endif -- inDataContainer %}\n"
+"{%  else %}\n"
+"{%   if info.inDataContainer %}\n"
+"write_{$info.typeName}_union_shared(codec, {% if info.castDiscriminator %}static_cast<int32_t>({% endif %}{$info.dataLiteral}{$info.discriminatorName}{% if info.castDiscriminator %}){% endif %}, &{$info.name});\n"
+"{%   else -- not inDataContainer %}\n"
+"write_{$info.typeName}_union_shared(codec, {% if info.castDiscriminator %}static_cast<int32_t>({% endif %}{% if info.discrimPtr == true && source == \"client\" %}*{% endif %}{$info.discriminatorName}{% if info.castDiscriminator %}){% endif %}, {$info.name});\n"
+"{%   endif -- inDataContainer %}\n"
+"{%  endif %}\n"
+"{% endif %}\n"
+"{% enddef -------------------------- SharedType %}\n"
+"\n"
+"{% def encodeData(info) -------------------%}\n"
+"codec->writeData({$info.name}, {% if source == \"client\" && info.pointerScalarTypes %}*{% endif %}{$info.size} * sizeof({$info.builtinTypeName}));\n"
+"{% enddef --------------------------------------- encodeData %}\n"
+;
+
@@ -0,0 +1,555 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/cpp_common_functions.template
+extern const char * const kCppCommonFunctions;
+
+const char * const kCppCommonFunctions = 
+"{#--------------------commonHeader----------------------#}\n"
+"{% def commonHeader() %}\n"
+"/*\n"
+" * Generated by erpcgen {$erpcVersion} on {$todaysDate}.\n"
+" *\n"
+" * AUTOGENERATED - DO NOT EDIT\n"
+" */\n"
+"{% enddef --commonHeader %}\n"
+"\n"
+"{% def checkVersion() %}\n"
+"#if {$erpcVersionNumber} != ERPC_VERSION_NUMBER\n"
+"#error \"The generated shim code version is different to the rest of eRPC code.\"\n"
+"#endif\n"
+"{% enddef --checkVersion %}\n"
+"\n"
+"{% def checkCrc() %}\n"
+"{% if empty(crc16) == false %}\n"
+"\n"
+"#if !defined(ERPC_GENERATED_CRC) || ERPC_GENERATED_CRC != {$crc16}\n"
+"#error \"Macro 'ERPC_GENERATED_CRC' should be defined with value {$crc16}.\"\n"
+"#endif\n"
+"\n"
+"{% endif  -- empty(crc16) == false %}\n"
+"{% enddef --checkCrc %}\n"
+"\n"
+"{% def generateCrcVariable() %}\n"
+"{% if empty(crc16) == false %}\n"
+"// for mdk/keil do not forgett add \"--muldefweak\" for linker\n"
+"extern const uint32_t erpc_generated_crc;\n"
+"#if defined(__MINGW32__)\n"
+"__declspec( selectany )\n"
+"#else\n"
+"#pragma weak erpc_generated_crc\n"
+"#endif\n"
+"extern const uint32_t erpc_generated_crc = {$crc16};\n"
+"{% endif  -- empty(crc16) == false %}\n"
+"{% enddef --checkCrc %}\n"
+"\n"
+"{# ---------------- namespace ---------------- #}\n"
+"{% def fillNamespaceBegin() %}\n"
+"{% if empty(namespace) == false %}\n"
+"\n"
+"namespace {$namespace}\n"
+"{\n"
+"{% endif  -- empty(crc16) == false %}\n"
+"{% enddef --checkCrc %}\n"
+"\n"
+"{% def fillNamespaceEnd() %}\n"
+"{% if empty(namespace) == false %}\n"
+"} // {$namespace}\n"
+"\n"
+"{% endif  -- empty(crc16) == false %}\n"
+"{% enddef --checkCrc %}\n"
+"\n"
+"{% def usingNamespace() %}\n"
+"{% if empty(namespace) == false %}\n"
+"using namespace {$namespace};\n"
+"{% endif  -- empty(crc16) == false %}\n"
+"{% enddef --checkCrc %}\n"
+"\n"
+"{# ---------------- constantsDefinitions ---------------- #}\n"
+"{% def constantsDefinitions(consts) %}\n"
+"{% if not empty(consts) %}\n"
+"\n"
+"// Constant variable definitions\n"
+"{%  for c in consts %}\n"
+"#if defined(__MINGW32__)\n"
+"__declspec( selectany )\n"
+"#else\n"
+"#pragma weak {$c.name}\n"
+"#endif\n"
+"extern const {$c.typeAndName} = {$c.value};\n"
+"{%  endfor -- consts %}\n"
+"{% endif %}\n"
+"{% enddef -- constantsDefinitions %}\n"
+"\n"
+"{# ---------------- symbolHeader ---------------- #}\n"
+"{% def symbolHeader(symbols, way, shared) %}\n"
+"{% if symbols %}\n"
+"{%  for s in symbols if (shared == \"def\") || (shared == \"noSharedMem\" && s.noSharedMem) %}\n"
+"{%   if s.type == \"struct\" %}\n"
+"{%    if way == \"serial\" %}\n"
+"{$ structSerialHeader(s, shared)}\n"
+"{%    else %}\n"
+"{$ structDeserialHeader(s, shared)}\n"
+"{%    endif -- way == \"serial\" %}\n"
+"{%   else %}\n"
+"{%    if way == \"serial\" %}\n"
+"{$ unionSerialHeader(s, shared)}\n"
+"{%    else %}\n"
+"{$ unionDeserialHeader(s, shared)}\n"
+"{%    endif -- way == \"serial\" %}\n"
+"{%   endif -- s.type == \"union/struct\" %}\n"
+"{%  endfor -- symbols %}\n"
+"{% endif -- symbols %}\n"
+"{% enddef -- serialHeader %}\n"
+"\n"
+"{# ---------------- symbolSource ---------------- #}\n"
+"{% def symbolSource(symbols, way, shared) %}\n"
+"{% if symbols %}\n"
+"{%  for s in symbols if (shared == \"def\") || (shared == \"noSharedMem\" && s.noSharedMem) %}\n"
+"{%   if s.type == \"struct\" %}\n"
+"{%    if way == \"serial\" %}\n"
+"{$ structSerialSource(s, shared)}\n"
+"{%    else %}\n"
+"{$ structDeserialSource(s, shared)}\n"
+"{%    endif -- way == \"serial\" %}\n"
+"{%   else -- s.type == \"union/struct\" %}\n"
+"{%    if way == \"serial\" %}\n"
+"{$ unionSerialSource(s, shared)}\n"
+"{%    else %}\n"
+"{$ unionDeserialSource(s, shared)}\n"
+"{%    endif -- way == \"serial\" %}\n"
+"{%   endif -- s.type == \"union/struct\" %}\n"
+"{%  endfor -- symbols %}\n"
+"{% endif -- symbols %}\n"
+"{% enddef -- serialHeader %}\n"
+"\n"
+"{# ---------------- symbolFreeSpaceHeader ---------------- #}\n"
+"{% def symbolFreeSpaceHeader(symbols, shared) %}\n"
+"{% if symbols %}\n"
+"{%  for s in symbols if (shared == \"def\") || (shared == \"noSharedMem\" && s.noSharedMem) %}\n"
+"{%   if s.type == \"struct\" %}\n"
+"{$ structFreeSpaceHeader(s, shared)}\n"
+"{%   else %}\n"
+"{$ unionFreeSpaceHeader(s, shared)}\n"
+"{%   endif %}\n"
+"{%  endfor -- symbols %}\n"
+"{% endif -- symbols %}\n"
+"{% enddef -- serialHeader %}\n"
+"\n"
+"{# ---------------- symbolFreeSpaceSource ---------------- #}\n"
+"{% def symbolFreeSpaceSource(symbols, shared) %}\n"
+"{% if symbols %}\n"
+"{%  for s in symbols if (shared == \"def\") || (shared == \"noSharedMem\" && s.noSharedMem) %}\n"
+"{%   if s.type == \"struct\" %}\n"
+"{$ structFreeSpaceSource(s, shared)}\n"
+"{%   else %}\n"
+"{$ unionFreeSpaceSource(s, shared)}\n"
+"{%   endif %}\n"
+"{%  endfor -- symbols %}\n"
+"{% endif -- symbols %}\n"
+"{% enddef -- serialHeader %}\n"
+"\n"
+"{# ---------------- structDeserialHeader ---------------- #}\n"
+"{% def structDeserialHeader(struct, shared) %}\n"
+"{%   if struct.noSharedMem && shared == \"noSharedMem\" %}\n"
+"//! @brief Function to read no shared member of shared struct {$struct.name}\n"
+"static void read_{$struct.name}_struct_shared(erpc::{$codecClass} * codec, {$struct.name} * data);\n"
+"{%   else %}\n"
+"//! @brief Function to read struct {$struct.name}\n"
+"static void read_{$struct.name}_struct(erpc::{$codecClass} * codec, {$struct.name} * data);\n"
+"{%   endif %}\n"
+"{% enddef -- structDeserialHeader %}\n"
+"\n"
+"{# ---------------- structSerialHeader ---------------- #}\n"
+"{% def structSerialHeader(struct, shared) %}\n"
+"{%   if struct.noSharedMem && shared == \"noSharedMem\" %}\n"
+"//! @brief Function to write no shared member of shared struct {$struct.name}\n"
+"static void write_{$struct.name}_struct_shared(erpc::{$codecClass} * codec, const {$struct.name} * data);\n"
+"{%   else %}\n"
+"//! @brief Function to write struct {$struct.name}\n"
+"static void write_{$struct.name}_struct(erpc::{$codecClass} * codec, const {$struct.name} * data);\n"
+"{%   endif %}\n"
+"{% enddef  -- structSerialHeader %}\n"
+"\n"
+"{# ---------------- structDeserialSource ---------------- #}\n"
+"{% def structDeserialSource(struct, shared) %}\n"
+"{%   if struct.noSharedMem && shared == \"noSharedMem\" %}\n"
+"//! @brief Read no shared member of shared struct {$struct.name} function implementation\n"
+"static void read_{$struct.name}_struct_shared(erpc::{$codecClass} * codec, {$struct.name} * data)\n"
+"{%   else %}\n"
+"// Read struct {$struct.name} function implementation\n"
+"static void read_{$struct.name}_struct(erpc::{$codecClass} * codec, {$struct.name} * data)\n"
+"{%   endif %}\n"
+"{\n"
+"{%   if struct.hasNullableMember %}\n"
+"    bool isNull;\n"
+"{%   endif -- hasNullableMember %}\n"
+"{%   if struct.needTempVariableI32 %}\n"
+"    int32_t _tmp_local_i32;\n"
+"{%   endif %}\n"
+"{%   if struct.needTempVariableI32 || struct.hasNullableMember %}\n"
+"\n"
+"{%   endif %}\n"
+"    if(NULL == data)\n"
+"    {\n"
+"        return;\n"
+"    }\n"
+"\n"
+"{%   for mem in struct.members if (shared == \"def\" && not mem.serializedViaMember) || (mem.noSharedMem && shared == \"noSharedMem\") %}\n"
+"{%    if mem.isNullable %}\n"
+"    codec->readNullFlag(isNull);\n"
+"    if (!isNull)\n"
+"    {\n"
+"{%     if source == \"server\" %}\n"
+"{$> addIndent(\"        \", allocMem(mem.coderCall.memberAllocation))}\n"
+"{%     endif %}\n"
+"{$ addIndent(\"        \", mem.coderCall.decode(mem.coderCall))}\n"
+"    }\n"
+"    else\n"
+"    {\n"
+"        {$mem.coderCall.name}{$mem.structElements} = NULL;\n"
+"        {$mem.coderCall.name}{$mem.structElementsCount} = 0;\n"
+"    }{$loop.addNewLineIfNotLast}\n"
+"{%    else -- notNullable %}\n"
+"{% if source == \"server\" %}\n"
+"{$> addIndent(\"    \", allocMem(mem.coderCall.memberAllocation))}\n"
+"{% endif %}\n"
+"{$addIndent(\"    \", mem.coderCall.decode(mem.coderCall))}{$loop.addNewLineIfNotLast}\n"
+"{%    endif -- notNullable %}\n"
+"{%   endfor -- struct.members %}\n"
+"}\n"
+"{% enddef -- structDeserialSource %}\n"
+"\n"
+"{# ---------------- structSerialSource ---------------- #}\n"
+"{% def structSerialSource(struct, shared) %}\n"
+"{%   if struct.noSharedMem && shared == \"noSharedMem\" %}\n"
+"// Write no shared member of shared struct {$struct.name} function implementation\n"
+"static void write_{$struct.name}_struct_shared(erpc::{$codecClass} * codec, const {$struct.name} * data)\n"
+"{%   else %}\n"
+"// Write struct {$struct.name} function implementation\n"
+"static void write_{$struct.name}_struct(erpc::{$codecClass} * codec, const {$struct.name} * data)\n"
+"{%   endif %}\n"
+"{\n"
+"    if(NULL == data)\n"
+"    {\n"
+"        return;\n"
+"    }\n"
+"\n"
+"{%   for mem in struct.members if (shared == \"def\" && not mem.serializedViaMember) || (mem.noSharedMem && shared == \"noSharedMem\") %}\n"
+"{%    if mem.isNullable %}\n"
+"    if ({$mem.coderCall.name}{$mem.structElements} == NULL)\n"
+"    {\n"
+"        codec->writeNullFlag(true);\n"
+"    }\n"
+"    else\n"
+"    {\n"
+"        codec->writeNullFlag(false);\n"
+"{$addIndent(\"        \", mem.coderCall.encode(mem.coderCall))}\n"
+"    }{$loop.addNewLineIfNotLast}\n"
+"{%    else -- notNullable %}\n"
+"{$addIndent(\"    \", mem.coderCall.encode(mem.coderCall))}{$loop.addNewLineIfNotLast}\n"
+"{%    endif -- notNullable %}\n"
+"{%   endfor -- struct.members %}\n"
+"}\n"
+"{% enddef -- structSerialSource %}\n"
+"\n"
+"{# ---------------- structFreeSpaceHeader ---------------- #}\n"
+"{% def structFreeSpaceHeader(struct, shared) %}\n"
+"{%   if struct.noSharedMem && shared == \"noSharedMem\" %}\n"
+"//! @brief Function to free space allocated inside no shared member of shared struct {$struct.name}\n"
+"static void free_{$struct.name}_struct_shared({$struct.name} * data);\n"
+"{%   else %}\n"
+"//! @brief Function to free space allocated inside struct {$struct.name}\n"
+"static void free_{$struct.name}_struct({$struct.name} * data);\n"
+"{%   endif %}\n"
+"{% enddef  -- structFreeSpaceHeader %}\n"
+"\n"
+"{# ---------------- structFreeSpaceSource ---------------- #}\n"
+"{% def structFreeSpaceSource(struct, shared) %}\n"
+"{%   if struct.noSharedMem && shared == \"noSharedMem\" %}\n"
+"// Free space allocated inside no shared member of shared struct {$struct.name} function implementation\n"
+"static void free_{$struct.name}_struct_shared({$struct.name} * data)\n"
+"{%   else %}\n"
+"// Free space allocated inside struct {$struct.name} function implementation\n"
+"static void free_{$struct.name}_struct({$struct.name} * data)\n"
+"{%   endif %}\n"
+"{\n"
+"{%   set needFreeNewline = \"false\" %}\n"
+"{%   for mem in struct.membersToFree if (shared == \"def\" && not mem.serializedViaMember) || (mem.noSharedMem && shared == \"noSharedMem\") %}\n"
+"{%    if needFreeNewline == \"true\" %}\n"
+"\n"
+"{%    else %}\n"
+"{%     set needFreeNewline = \"true\" %}\n"
+"{%    endif -- needFreeNewline == \"true\" %}\n"
+"{$addIndent(\"    \", mem.coderCall.freeingCall(mem.coderCall))}\n"
+"{%    if empty(mem.coderCall.memberAllocation) == false %}\n"
+"{$addIndent(\"    \", mem.coderCall.freeingCall2(mem.coderCall))}\n"
+"{%    endif %}\n"
+"{%   endfor -- struct.members %}\n"
+"}\n"
+"{% enddef -- structFreeSpaceSource %}\n"
+"\n"
+"{# ---------------- unionDeserialHeader ---------------- #}\n"
+"{% def unionDeserialHeader(union, shared) %}\n"
+"{%   if union.noSharedMem && shared == \"noSharedMem\" %}\n"
+"//! @brief Function to read  no shared member of shared union {$union.name}\n"
+"static void read_{$union.name}_union_shared(erpc::{$codecClass} * codec, int32_t & discriminator, {$union.name} * data);\n"
+"{%   else %}\n"
+"//! @brief Function to read union {$union.name}\n"
+"static void read_{$union.name}_union(erpc::{$codecClass} * codec, int32_t & discriminator, {$union.name} * data);\n"
+"{%   endif %}\n"
+"{% enddef -- unionDeserialHeader %}\n"
+"\n"
+"{# ---------------- unionSerialHeader ---------------- #}\n"
+"{% def unionSerialHeader(union, shared) %}\n"
+"{%   if union.noSharedMem && shared == \"noSharedMem\" %}\n"
+"//! @brief Function to write  no shared member of shared union {$union.name}\n"
+"static void write_{$union.name}_union_shared(erpc::{$codecClass} * codec, int32_t discriminator, const {$union.name} * data);\n"
+"{%   else %}\n"
+"//! @brief Function to write union {$union.name}\n"
+"static void write_{$union.name}_union(erpc::{$codecClass} * codec, int32_t discriminator, const {$union.name} * data);\n"
+"{%   endif %}\n"
+"{% enddef  -- unionSerialHeader %}\n"
+"\n"
+"{# ---------------- unionDeserialSource ---------------- #}\n"
+"{% def unionDeserialSource(union, shared) %}\n"
+"{%   if union.noSharedMem && shared == \"noSharedMem\" %}\n"
+"// Read no shared member of shared union {$union.name} function implementation\n"
+"static void read_{$union.name}_union_shared(erpc::{$codecClass} * codec, int32_t & discriminator, {$union.name} * data)\n"
+"{%   else %}\n"
+"// Read union {$union.name} function implementation\n"
+"static void read_{$union.name}_union(erpc::{$codecClass} * codec, int32_t & discriminator, {$union.name} * data)\n"
+"{%   endif %}\n"
+"{\n"
+"{%   if union.needTempVariableI32 %}\n"
+"    int32_t _tmp_local_i32;\n"
+"\n"
+"{%   endif %}\n"
+"    if(NULL == data)\n"
+"    {\n"
+"        return;\n"
+"    }\n"
+"\n"
+"{$addIndent(\"    \", decodeUnionType(union.coderCall))}\n"
+"}\n"
+"{% enddef -- unionDeserialSource %}\n"
+"\n"
+"{# ---------------- unionSerialSource ---------------- #}\n"
+"{% def unionSerialSource(union, shared) %}\n"
+"{%   if union.noSharedMem && shared == \"noSharedMem\" %}\n"
+"// Write no shared member of shared union {$union.name} function implementation\n"
+"static void write_{$union.name}_union_shared(erpc::{$codecClass} * codec, int32_t discriminator, const {$union.name} * data)\n"
+"{%   else %}\n"
+"// Write union {$union.name} function implementation\n"
+"static void write_{$union.name}_union(erpc::{$codecClass} * codec, int32_t discriminator, const {$union.name} * data)\n"
+"{%   endif %}\n"
+"{\n"
+"    if(NULL == data)\n"
+"    {\n"
+"        return;\n"
+"    }\n"
+"\n"
+"{$addIndent(\"    \", encodeUnionType(union.coderCall))}\n"
+"}\n"
+"{% enddef -- unionSerialSource %}\n"
+"\n"
+"{# ---------------- unionFreeSpaceHeader ---------------- #}\n"
+"{% def unionFreeSpaceHeader(union, shared) %}\n"
+"{%   if union.noSharedMem && shared == \"noSharedMem\" %}\n"
+"//! @brief Function to free space allocated inside no shared member of shared union {$union.name}\n"
+"static void free_{$union.name}_union_shared(int32_t discriminator, {$union.name} * data);\n"
+"{%   else %}\n"
+"//! @brief Function to free space allocated inside union {$union.name}\n"
+"static void free_{$union.name}_union(int32_t discriminator, {$union.name} * data);\n"
+"{%   endif %}\n"
+"{% enddef  -- unionFreeSpaceHeader %}\n"
+"\n"
+"{# ---------------- unionFreeSpaceSource ---------------- #}\n"
+"{% def unionFreeSpaceSource(union, shared) %}\n"
+"{%   if union.noSharedMem && shared == \"noSharedMem\" %}\n"
+"// Free space allocated inside no shared member of shared union {$union.name} function implementation\n"
+"static void free_{$union.name}_union_shared(int32_t discriminator, {$union.name} * data)\n"
+"{%   else %}\n"
+"// Free space allocated inside union {$union.name} function implementation\n"
+"static void free_{$union.name}_union(int32_t discriminator, {$union.name} * data)\n"
+"{%   endif %}\n"
+"{\n"
+"{$addIndent(\"    \", freeUnion(union.coderCall))}\n"
+"}\n"
+"{% enddef -- unionFreeSpaceSource %}\n"
+"\n"
+"{# ---------------- allocMem ---------------- #}\n"
+"{% def allocMem(info) %}\n"
+"{% if empty(info) == false %}\n"
+"{$info.name} = ({$info.typePointerValue}) erpc_malloc({$info.size}sizeof({$info.typeValue}));\n"
+"{%  if generateAllocErrorChecks == true %}\n"
+"if ({$info.name} == NULL)\n"
+"{\n"
+"    codec->updateStatus(kErpcStatus_MemoryError);\n"
+"}\n"
+"{%   if info.isOutChar == true %}\n"
+"else\n"
+"{\n"
+"    {$info.name}[{$info.chSize}] = '\\0';\n"
+"}\n"
+"{%   endif --info.isOutChar == true %}\n"
+"{%  else -- generateAllocErrorChecks == true %}\n"
+"{%   if info.isOutChar == true %}\n"
+"{$info.name}[{$info.chSize}] = '\\0';\n"
+"{%   endif --info.isOutChar == true %}\n"
+"{%  endif -- generateAllocErrorChecks == true %}\n"
+"{% endif -- empty(info) == false %}\n"
+"{% enddef ------------------------------- allocMem %}\n"
+"\n"
+"{# ---------------- freeData ---------------- #}\n"
+"{% def freeData(info) %}\n"
+"erpc_free({$info.freeName});\n"
+"{% enddef ------------------------------- freeData %}\n"
+"\n"
+"{# ---------------- freeStruct ---------------- #}\n"
+"{% def freeStruct(info) %}\n"
+"{% if info.inDataContainer %}\n"
+"free_{$info.typeName}_struct(&{$info.name});\n"
+"{% else -- not inDataContainer %}\n"
+"if ({$info.name})\n"
+"{\n"
+"    free_{$info.typeName}_struct({$info.name});\n"
+"}\n"
+"{% endif -- inDataContainer %}\n"
+"{% enddef ------------------------------- freeStruct %}\n"
+"\n"
+"{# ---------------- freeList ---------------- #}\n"
+"{% def freeList(info) %}\n"
+"{% if info.needFreeingCall == true %}\n"
+"{$freeArray(info)}\n"
+"{% endif %}\n"
+"erpc_free({$info.name});\n"
+"{% enddef ------------------------------- freeList %}\n"
+"\n"
+"{# ---------------- freeArray ---------------- #}\n"
+"{% def freeArray(info) %}\n"
+"for (uint32_t {$info.forLoopCount} = 0; {$info.forLoopCount} < {$info.size}; ++{$info.forLoopCount})\n"
+"{\n"
+"{$addIndent(\"    \", info.protoNext.freeingCall(info.protoNext))}\n"
+"}\n"
+"{% enddef ------------------------------- freeArray %}\n"
+"\n"
+"{# ---------------- freeUnion ---------------- #}\n"
+"{% def freeUnion(info) %}\n"
+"switch ({$info.dataLiteral}{$info.discriminatorName})\n"
+"{\n"
+"{%if info.needCaseEmptyFreeingCall %}{% for case in info.cases %}\n"
+"{%  if case.needCaseFreeingCall == false %}\n"
+"    {%   if case.name != \"default\" %}case {% endif %}{% if case.name != \"\" %}{$case.name}{% else %}{$case.value}{% endif %}:\n"
+"{%  endif %}\n"
+"{% endfor -- cases %}\n"
+"    {\n"
+"        break;\n"
+"    }{%    endif -- needCaseEmptyFreeingCall %}\n"
+"{% for case in info.cases %}\n"
+"{%  if case.needCaseFreeingCall == true %}\n"
+"    {%   if case.name != \"default\" %}case {% endif %}{% if case.name != \"\" %}{$case.name}{% else %}{$case.value}{% endif %}:\n"
+"    {\n"
+"{%   for member in case.members %}\n"
+"{%    if member.isNeedFreeingCall %}\n"
+"{$addIndent(\"        \", member.coderCall.freeingCall(member.coderCall))}\n"
+"{%    endif %}\n"
+"{%    if empty(member.coderCall.memberAllocation) == false %}\n"
+"{$addIndent(\"        \", member.coderCall.freeingCall2(member.coderCall))}\n"
+"{%    endif %}\n"
+"{%   endfor -- members %}\n"
+"        break;\n"
+"    }\n"
+"{%  endif %}\n"
+"{% endfor -- cases %}\n"
+"}\n"
+"{% enddef ------------------------------- freeUnion %}\n"
+"\n"
+"{% def freeUnionType(info) %}\n"
+"{% if info.inDataContainer %}\n"
+"free_{$info.typeName}_union({% if info.castDiscriminator %}static_cast<int32_t>({% endif %}{$info.dataLiteral}{$info.discriminatorName}{% if info.castDiscriminator %}){% endif %}, &{$info.name});\n"
+"{% else -- not inDataContainer %}\n"
+"if ({$info.name})\n"
+"{\n"
+"    free_{$info.typeName}_union({% if info.castDiscriminator %}static_cast<int32_t>({% endif %}{$info.discriminatorName}{% if info.castDiscriminator %}){% endif %}, {$info.name});\n"
+"}\n"
+"{% endif -- inDataContainer %}\n"
+"{% enddef ------------------------------- freeUnionType %}\n"
+"\n"
+"{% def setSharedMemAddresses() %}\n"
+"{% if sharedMemBeginAddr != \"\" %}\n"
+"#define ERPC_SHARED_MEMORY_BEGIN {$sharedMemBeginAddr}\n"
+"#define ERPC_SHARED_MEMORY_END {$sharedMemEndAddr}\n"
+"{% endif %}\n"
+"{% enddef ------------------------------- setSharedMemAddresses %}\n"
+"\n"
+"{% def unionMembersDeclaration(info) %}\n"
+"{% for unionCase in info.unionCases %}\n"
+"{%  if count(unionCase) > 1 %}\n"
+"struct\n"
+"{\n"
+"{%   set indent = \"    \" %}\n"
+"{%  else %}\n"
+"{%   set indent = \"\" %}\n"
+"{%  endif %}\n"
+"{%  for unionMember in unionCase %}\n"
+"{$indent}{$unionMember.typenameName};\n"
+"{%  endfor %}\n"
+"{%  if count(unionCase) > 1 %}\n"
+"};\n"
+"{%  endif %}\n"
+"{% endfor %}\n"
+"{% enddef ------------------------------- unionMembersDeclaration %}\n"
+"\n"
+"{% def f_paramIsNullableEncode(param) %}\n"
+"{% if ((source == \"client\") && (param.direction != ReturnDirection) && (empty(param.lengthName) == false)) %}\n"
+"{%  set lengthNameCon = \") || (\" & param.lengthName & \" == NULL)\" >%}\n"
+"{% else %}\n"
+"{%  set lengthNameCon = \"\" >%}\n"
+"{% endif %}\n"
+"if ({% if lengthNameCon != \"\" %}({% endif %}{$param.nullableName} == NULL{$lengthNameCon})\n"
+"{\n"
+"    codec->writeNullFlag(true);\n"
+"}\n"
+"else\n"
+"{\n"
+"    codec->writeNullFlag(false);\n"
+"{# Out will send only null information from client to server that it is not null #}\n"
+"{% if param.direction != OutDirection %}\n"
+"{$addIndent(\"    \", param.coderCall.encode(param.coderCall))}\n"
+"{% endif -- param.direction != OutDirection %}\n"
+"}\n"
+"{% enddef ------------------------------- f_paramIsNullableEncode %}\n"
+"\n"
+"{% def f_paramIsNullableDecode(param) %}\n"
+"codec->readNullFlag(isNull);\n"
+"if (!isNull)\n"
+"{\n"
+"{% if source == \"server\" %}\n"
+"{$> addIndent(\"    \", allocMem(param.mallocServer))}\n"
+"{% endif %}\n"
+"{$> addIndent(\"    \", allocMem(param.firstAlloc))}\n"
+"{# Out will receive only null information from client to server that it is not null #}\n"
+"{% if param.direction != OutDirection %}\n"
+"{$addIndent(\"    \", param.coderCall.decode(param.coderCall))}\n"
+"{% endif -- param.direction != OutDirection %}\n"
+"{% if source == \"server\" && empty(param.nullVariable) == false %}\n"
+"    _{$param.nullableName} = &{$param.nullableName};\n"
+"{% endif %}\n"
+"}\n"
+"else\n"
+"{\n"
+"    {% if source == \"server\" && !empty(param.nullVariable) %}_{% endif %}{$param.nullableName} = NULL;\n"
+"}\n"
+"{% enddef ------------------------------- f_paramIsNullableDecode %}\n"
+"\n"
+"{% def getFunctionDeclarationMacroName() %}\n"
+"ERPC_FUNCTIONS_DEFINITIONS{% if group.name %}_{% endif %}{$upper(group.name)}{%>%}\n"
+"{% enddef ------------------------------- getFunctionDeclarationMacroName %}\n"
+"\n"
+"{% def getClassFunctionIdName(fn) %}\n"
+"m_{$fn.name}Id{%>%}\n"
+"{% enddef ------------------------------- getClassFunctionIdName %}\n"
+;
+
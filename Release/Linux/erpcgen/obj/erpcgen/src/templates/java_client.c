@@ -0,0 +1,98 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/java_client.template
+extern const char * const kJavaClient;
+
+const char * const kJavaClient = 
+"/** \n"
+" * Generated by erpcgen {$erpcVersion} on {$todaysDate}.\n"
+" * \n"
+" * AUTOGENERATED - DO NOT EDIT\n"
+" */\n"
+" {% set iface = interface %}\n"
+"package {$groupPackage}.client;\n"
+"\n"
+"import {$groupPackage}.interfaces.I{$iface.name};\n"
+"{% if not empty(group.symbolsMap.structs) %}import {$groupPackage}.common.structs.*;{% elif not empty(structs)%}import {$groupPackage}.common.structs.*;{% endif %}\n"
+"{% if not empty(enums)%}import {$groupPackage}.common.enums.*;{% endif %}\n"
+"\n"
+"{%  for inc in includes %}\n"
+"import {$inc};\n"
+"{%  endfor -- includes %}\n"
+"\n"
+"import io.github.embeddedrpc.erpc.auxiliary.MessageType;\n"
+"import io.github.embeddedrpc.erpc.auxiliary.MessageInfo;\n"
+"import io.github.embeddedrpc.erpc.auxiliary.RequestContext;\n"
+"import io.github.embeddedrpc.erpc.auxiliary.Reference;\n"
+"import io.github.embeddedrpc.erpc.auxiliary.Utils;\n"
+"import io.github.embeddedrpc.erpc.client.ClientManager;\n"
+"import io.github.embeddedrpc.erpc.codec.Codec;\n"
+"\n"
+"import java.util.ArrayList;\n"
+"import java.util.List;\n"
+"\n"
+"public class {$iface.name}Client implements I{$iface.name} {\n"
+"    private final ClientManager clientManager;\n"
+"\n"
+"    public {$iface.name}Client(ClientManager clientManager) {\n"
+"        this.clientManager = clientManager;\n"
+"    }\n"
+"{% for fn in iface.functions %}\n"
+"{$loop.addNewLineIfNotLast}\n"
+"    @Override\n"
+"    public {$fn.prototype} {\n"
+"        // Create request\n"
+"        RequestContext request = clientManager.createRequest({% if fn.isOneway %}true{% else %}false{% endif %});\n"
+"        Codec codec = request.codec();\n"
+"\n"
+"        // Write message info\n"
+"        codec.startWriteMessage(new MessageInfo(\n"
+"                MessageType.{% if fn.isReturnValue %}kInvocationMessage{% else %}kOnewayMessage{% endif %},\n"
+"                this.SERVICE_ID,\n"
+"                this.{$upper(fn.name)}_ID,\n"
+"                request.sequence()));\n"
+"\n"
+"        // Write message data\n"
+"{%  for p in fn.inParameters if not p.serializedViaMember %}\n"
+"{%     if p.isNullable %}\n"
+"        if({$p.name} == null) {\n"
+"            codec.writeNullFlag(1);\n"
+"        } else {\n"
+"            codec.writeNullFlag(0);\n"
+"{$          addIndent(\"            \", p.call.encode(p.call))}\n"
+"        }\n"
+"{%     else %}\n"
+"        Utils.checkNotNull({$p.name}, \"{$p.name} is null\");\n"
+"        {% if p.call.isReference%}Utils.checkNotNull({$p.name}.get(), \"{$p.name}.value is null\");{% endif %}\n"
+"{$      addIndent(\"        \", p.call.encode(p.call))}\n"
+"{%     endif -- isNullable %}\n"
+"{% endfor -- inParams %}\n"
+"\n"
+"        // Perform request\n"
+"        clientManager.performRequest(request);\n"
+"\n"
+"{%  if not fn.isOneway %}\n"
+"        // Read out parameters\n"
+"{% for p in fn.outParameters if not p.serializedViaMember %}\n"
+"{%     if p.isNullable %}\n"
+"        if(!codec.readNullFlag()) {\n"
+"{$         addIndent(\"            \", p.call.decode(p.call))}\n"
+"        }\n"
+"{%     else %}\n"
+"{$         addIndent(\"        \", p.call.decode(p.call))}\n"
+"{%     endif -- isNullable %}\n"
+"{% endfor -- outParams %}\n"
+"{%      if fn.isReturnValue && fn.returnValue.type.type != \"void\" %}\n"
+"\n"
+"        // Read return value\n"
+"{$      addIndent(\"        \",  fn.returnValue.call.decode(fn.returnValue.call))}\n"
+"        return {$fn.returnValue.call.name};\n"
+"{%      endif -- returnValue %}\n"
+"{%  endif -- oneway %}\n"
+"    }\n"
+"{% endfor -- fn %}\n"
+"}\n"
+;
+
@@ -0,0 +1,37 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/java_const.template
+extern const char * const kJavaConst;
+
+const char * const kJavaConst = 
+"/** \n"
+" * Generated by erpcgen {$erpcVersion} on {$todaysDate}.\n"
+" * \n"
+" * AUTOGENERATED - DO NOT EDIT\n"
+" */\n"
+" package {$groupPackage}.common;\n"
+"\n"
+"{% if not empty(group.symbolsMap.structs) %}import {$groupPackage}.common.structs.*;{% elif not empty(structs)%}import {$groupPackage}.common.structs.*;{% endif %}\n"
+"{% if not empty(enums)%}import {$groupPackage}.common.enums.*;{% endif %}\n"
+"\n"
+"{%  for inc in includes %}\n"
+"import {$inc};\n"
+"{%  endfor -- includes %}\n"
+"\n"
+"import java.util.ArrayList;\n"
+"import java.util.List;\n"
+"\n"
+"public final class Constants {\n"
+"{% for c in consts %}\n"
+"    {$>c.mlComment}\n"
+"    public static final {$c.type.typeName} {$c.name} = {$c.value}{$getTypeValuePosfix(c.type)};{% if c.ilComment %} {$c.ilComment}{% endif %}\n"
+"{% endfor %}\n"
+"\n"
+"    private Constants() {\n"
+"    }\n"
+"}\n"
+"\n"
+;
+
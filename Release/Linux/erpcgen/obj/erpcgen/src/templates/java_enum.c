@@ -0,0 +1,61 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/java_enum.template
+extern const char * const kJavaEnum;
+
+const char * const kJavaEnum = 
+"{% if mlComment != \"\" %}\n"
+"{$mlComment}\n"
+"\n"
+"{% endif %}\n"
+"/** \n"
+" * Generated by erpcgen {$erpcVersion} on {$todaysDate}.\n"
+" * \n"
+" * AUTOGENERATED - DO NOT EDIT\n"
+" */\n"
+"\n"
+"package {$groupPackage}.common.enums;\n"
+"\n"
+"import io.github.embeddedrpc.erpc.codec.Codec;\n"
+"\n"
+"{$>(enum.mlComment or enum.ilComment)}\n"
+"public enum {$enum.name}{\n"
+"{%  for member in enum.members %}\n"
+"{%  if member.mlComment %}\n"
+"    {$member.mlComment}\n"
+"{%  endif %}\n"
+"    {$member.name}({$member.value}){% if !loop.last %},{% else %};{% endif %} {% if member.ilComment %}{$member.ilComment}{% endif %}\n"
+"{%  endfor -- member %}\n"
+"\n"
+"    private final Integer value;\n"
+"\n"
+"    {$enum.name}(Integer value) {\n"
+"        this.value = value;\n"
+"    }\n"
+"\n"
+"    public int getValue() {\n"
+"        return value;\n"
+"    }\n"
+"\n"
+"    public static {$enum.name} get(int value) {\n"
+"{%      for member in enum.members %}\n"
+"        if (value == {$member.value}) {\n"
+"            return {$member.name};\n"
+"        }\n"
+"        \n"
+"{%      endfor %}\n"
+"        return null;\n"
+"    }\n"
+"\n"
+"    public static {$enum.name} read(Codec codec) {\n"
+"        return get(codec.readInt32());\n"
+"    }\n"
+"\n"
+"    public void write(Codec codec) {\n"
+"        codec.writeInt32(this.getValue());\n"
+"    }\n"
+"}"
+;
+
@@ -0,0 +1,52 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/java_interface.template
+extern const char * const kJavaInterface;
+
+const char * const kJavaInterface = 
+"{% if mlComment != \"\" %}\n"
+"{$mlComment}\n"
+"\n"
+"{% endif %}\n"
+"/** \n"
+" * Generated by erpcgen {$erpcVersion} on {$todaysDate}.\n"
+" * \n"
+" * AUTOGENERATED - DO NOT EDIT\n"
+" */ \n"
+"\n"
+"package {$groupPackage}.interfaces;\n"
+"{% if not empty(group.symbolsMap.structs) %}import {$groupPackage}.common.structs.*;{% elif not empty(structs)%}import {$groupPackage}.common.structs.*;{% endif %}\n"
+"{% if not empty(enums)%}import {$groupPackage}.common.enums.*;{% endif %}\n"
+"\n"
+"{%  for inc in includes %}\n"
+"import {$inc};\n"
+"{%  endfor -- includes %}\n"
+"\n"
+"import io.github.embeddedrpc.erpc.auxiliary.Reference;\n"
+"\n"
+"import java.util.List;\n"
+"\n"
+"{% if interface.mlComment %}\n"
+"{$interface.mlComment}\n"
+"{% else %}\n"
+"{% endif %}\n"
+"public interface I{$interface.name} {\n"
+"    int SERVICE_ID = {$interface.id};\n"
+"{% for fn in interface.functions %}\n"
+"    int {$upper(fn.name)}_ID = {$fn.id};\n"
+"{% endfor -- fn %}\n"
+"\n"
+"{% for fn in interface.functions %}\n"
+"{% if fn.mlComment %}\n"
+"{$fn.mlComment}\n"
+"{% endif %}\n"
+"    {$fn.prototype};\n"
+"{% endfor -- fn %}\n"
+"}\n"
+"\n"
+"\n"
+"\n"
+;
+
@@ -0,0 +1,23 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/py_global_init.template
+extern const char * const kPyGlobalInit;
+
+const char * const kPyGlobalInit = 
+"{% if mlComment != \"\" %}\n"
+"{$mlComment}\n"
+"\n"
+"{% endif %}\n"
+"#\n"
+"# Generated by erpcgen {$erpcVersion} on {$todaysDate}.\n"
+"#\n"
+"# AUTOGENERATED - DO NOT EDIT\n"
+"#\n"
+"\n"
+"{% if empty(crc16) == false %}\n"
+"ERPC_GENERATED_SHIM_CODE_CRC = {$crc16}\n"
+"{% endif  -- empty(crc16) == false %}\n"
+;
+
@@ -0,0 +1,42 @@
+/*
+ * AUTOMATICALLY GENERATED FILE - DO NOT EDIT
+ */
+
+// Generated from /root/repo/erpcgen/src/templates/py_interface.template
+extern const char * const kPyInterface;
+
+const char * const kPyInterface = 
+"{% if mlComment != \"\" %}\n"
+"{$mlComment}\n"
+"\n"
+"{% endif %}\n"
+"#\n"
+"# Generated by erpcgen {$erpcVersion} on {$todaysDate}.\n"
+"#\n"
+"# AUTOGENERATED - DO NOT EDIT\n"
+"#\n"
+"\n"
+"{% for iface in group.interfaces %}\n"
+"{% if iface.mlComment %}\n"
+"{$iface.mlComment}\n"
+"{% else %}\n"
+"# Abstract base class for {$iface.name}\n"
+"{% endif %}\n"
+"class I{$iface.name}(object):\n"
+"    SERVICE_ID = {$iface.id}\n"
+"{% for fn in iface.functions %}\n"
+"    {$upper(fn.name)}_ID = {$fn.id}\n"
+"{% endfor -- fn %}\n"
+"\n"
+"{% for fn in iface.functions if fn.isNonExternalFunction == true %}\n"
+"{% if fn.mlComment %}\n"
+"   {$fn.mlComment}\n"
+"{% endif %}\n"
+"    def {$fn.prototype}:\n"
+"        raise NotImplementedError()\n"
+"\n"
+"{% endfor -- fn %}\n"
+"\n"
+"{% endfor -- iface %}\n"
+;
+
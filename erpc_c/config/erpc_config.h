@@ -54,6 +54,9 @@
 
 #define ERPC_PRE_POST_ACTION_DEFAULT_DISABLED (0U) //!< Pre post shim default callbacks functions disabled.
 #define ERPC_PRE_POST_ACTION_DEFAULT_ENABLED (1U)  //!< Pre post shim default callback functions enabled.
+
+#define ERPC_SERVICE_TABLE_DISABLED (0U) //!< Services are looked up by walking the service list.
+#define ERPC_SERVICE_TABLE_ENABLED (1U)  //!< Services are looked up in a direct-indexed table.
 //@}
 
 //! @name Configuration options
@@ -94,6 +97,12 @@
 //! ERPC_ALLOCATION_POLICY_STATIC. Default value 1 (Most of current cases).
 // #define ERPC_CLIENTS_THREADS_AMOUNT (1U)
 
+//! @def ERPC_TCP_TRANSPORTS_COUNT
+//!
+//! @brief Set amount of TCP transport objects used simultaneously in case of ERPC_ALLOCATION_POLICY is set to
+//! ERPC_ALLOCATION_POLICY_STATIC. A sharded TCP server needs one transport per shard. Default value 1.
+// #define ERPC_TCP_TRANSPORTS_COUNT (1U)
+
 //! @def ERPC_THREADS
 //!
 //! @brief Select threading model.
@@ -105,6 +114,23 @@
 //! Otherwise, the default is no threading.
 //#define ERPC_THREADS (ERPC_THREADS_FREERTOS)
 
+//! @def ERPC_SEMAPHORE_SPIN_COUNT
+//!
+//! @brief Count of attempts to take a semaphore before its thread goes to sleep.
+//!
+//! Used by pthreads port on Linux, where semaphores are built on futex. Spinning saves the sleep and wake up when
+//! the semaphore is put shortly, e.g. by a reply arriving on another core. Keep zero on single core systems.
+//! Default value is 0.
+//#define ERPC_SEMAPHORE_SPIN_COUNT (0U)
+
+//! @def ERPC_THREADS_SCHED_POLICY
+//!
+//! @brief Scheduling policy of pthreads threads created with non zero priority.
+//!
+//! SCHED_FIFO or SCHED_RR. Real-time policies need privilege (e.g. CAP_SYS_NICE), without it threads keep
+//! default scheduling. Default value is SCHED_FIFO.
+//#define ERPC_THREADS_SCHED_POLICY (SCHED_FIFO)
+
 //! @def ERPC_DEFAULT_BUFFER_SIZE
 //!
 //! Uncomment to change the size of buffers allocated by one of MessageBufferFactory.
@@ -149,6 +175,19 @@
 //! Uncomment for using logging feature.
 //#define ERPC_MESSAGE_LOGGING (ERPC_MESSAGE_LOGGING_ENABLED)
 
+//! @def ERPC_MESSAGE_LOGGING_ASYNC
+//!
+//! Pass logged messages to loggers from a logging thread. Messages are copied to a queue of
+//! ERPC_MESSAGE_LOGGING_QUEUE_SIZE slots of ERPC_DEFAULT_BUFFER_SIZE bytes per client and server, so slow loggers do not
+//! delay calls. Messages are dropped and counted when the queue is full or they do not fit a slot. Errors of loggers
+//! are not reported to calls. Default value 0 (loggers are called in the thread of the call).
+//#define ERPC_MESSAGE_LOGGING_ASYNC (1U)
+
+//! @def ERPC_MESSAGE_LOGGING_QUEUE_SIZE
+//!
+//! Count of messages waiting for the logging thread, must be power of two. Default value 8.
+//#define ERPC_MESSAGE_LOGGING_QUEUE_SIZE (8U)
+
 //! @def ERPC_TRANSPORT_MU_USE_MCMGR
 //!
 //! @brief MU transport layer configuration.
@@ -168,7 +207,8 @@
 //! @def ERPC_PRE_POST_ACTION
 //!
 //! Enable eRPC pre and post callback functions shim code. Take look into "erpc_pre_post_action.h". Can be used for
-//! detection of eRPC call freeze, ... Default set to ERPC_PRE_POST_ACTION_DISABLED.
+//! detection of eRPC call freeze, ... Default set to ERPC_PRE_POST_ACTION_DISABLED. Callbacks get no arguments, use
+//! ERPC_TRACE to see which call passes which point.
 //!
 //! Uncomment for using pre post callback feature.
 //#define ERPC_PRE_POST_ACTION (ERPC_PRE_POST_ACTION_ENABLED)
@@ -181,6 +221,160 @@
 //! Uncomment for using pre post default callback feature.
 //#define ERPC_PRE_POST_ACTION_DEFAULT (ERPC_PRE_POST_ACTION_DEFAULT_ENABLED)
 
+//! @def ERPC_SERVICE_TABLE
+//!
+//! Enable direct-indexed service dispatch table in the server. Incoming messages are then dispatched to the service
+//! with a single table lookup instead of walking the list of registered services. The table costs 256 pointers per
+//! server. Default set to ERPC_SERVICE_TABLE_ENABLED on POSIX systems, otherwise ERPC_SERVICE_TABLE_DISABLED.
+//#define ERPC_SERVICE_TABLE (ERPC_SERVICE_TABLE_ENABLED)
+
+//! @def ERPC_PRIORITY_LEVELS
+//!
+//! Number of priority levels used by the priority scheduling server. Method priorities set with the @priority
+//! annotation are clamped to this range, higher numbers are served first. Default value 4.
+//#define ERPC_PRIORITY_LEVELS (4U)
+
+//! @def ERPC_PRIORITY_QUEUE_SIZE
+//!
+//! Number of received requests which can wait in one priority level of the priority scheduling server. When a level is
+//! full, the server stops receiving until a worker takes a request from it. Default value 8.
+//#define ERPC_PRIORITY_QUEUE_SIZE (8U)
+
+//! @def ERPC_PRIORITY_AGING_LIMIT
+//!
+//! Starvation protection of the priority scheduling server. A waiting request is served regardless of its priority once
+//! this many requests of higher priority have been dispatched ahead of it. Default value 8.
+//#define ERPC_PRIORITY_AGING_LIMIT (8U)
+
+//! @def ERPC_PRIORITY_MAX_WORKERS
+//!
+//! Maximum number of worker threads (including dedicated ones) of the priority scheduling server. Default value 4.
+//#define ERPC_PRIORITY_MAX_WORKERS (4U)
+
+//! @def ERPC_ONEWAY_CREDITS
+//!
+//! Credit window for oneway messages. Client may have this many oneway messages not yet processed by server, then it
+//! waits until server returns credit (or fails with kErpcStatus_Busy when fail fast is set, which needs a transport
+//! implementing hasMessage()). Server returns credit in small control messages after each half of the window is
+//! processed. Client and server must use the same value. Client marks its oneway messages as waiting for credit and
+//! server returns credit only for marked messages, so clients which never read credit messages (arbitrated client,
+//! clients built without credits, Python and Java clients) can share the server without filling their connection.
+//! Default value 0 (credit flow control disabled).
+//#define ERPC_ONEWAY_CREDITS (16U)
+
+//! @def ERPC_SERVER_METRICS
+//!
+//! Enable per method counters of servers: calls, failed calls, request and reply bytes and histogram of processing
+//! time. Counters are read by Server::getMetrics() or remotely through the built-in eRPCStats service (see
+//! erpc_stats.erpc and erpc_stats_service_create()). Default value 0 (disabled).
+//#define ERPC_SERVER_METRICS (1U)
+
+//! @def ERPC_SERVER_METRICS_METHODS
+//!
+//! Count of methods which can have counters in one server. Calls of further methods are only counted as untracked.
+//! Default value 32.
+//#define ERPC_SERVER_METRICS_METHODS (32U)
+
+//! @def ERPC_SERVER_METRICS_SHARDS
+//!
+//! Count of copies of counters. Threads update the copy selected by their id, so that worker threads of one server
+//! do not contend on counters. Each copy takes 48 bytes per method. Default value 4.
+//#define ERPC_SERVER_METRICS_SHARDS (4U)
+
+//! @def ERPC_CLIENT_METRICS
+//!
+//! Enable per function counters of clients: calls, failed calls and histograms of time spent getting buffers,
+//! encoding, sending, waiting for reply and decoding. Counters are read by erpc_client_get_metrics(). Each call reads
+//! the clock six times. Default value 0 (disabled).
+//#define ERPC_CLIENT_METRICS (1U)
+
+//! @def ERPC_CLIENT_METRICS_FUNCTIONS
+//!
+//! Count of functions which can have counters in one client, each takes about 500 bytes. Calls of further functions
+//! are only counted as untracked. Default value 16.
+//#define ERPC_CLIENT_METRICS_FUNCTIONS (16U)
+
+//! @def ERPC_TRACE
+//!
+//! Enable trace points along the path of each call (see erpc_trace.h). Records are kept in per thread rings and
+//! drained by erpc_trace_drain() or a background thread, the recording thread never blocks. Supersedes
+//! ERPC_PRE_POST_ACTION for timing analysis. Default value 0 (disabled).
+//#define ERPC_TRACE (1U)
+
+//! @def ERPC_TRACE_BUFFER_SIZE
+//!
+//! Count of 16 byte records in ring of one thread, must be power of two. Default value 256.
+//#define ERPC_TRACE_BUFFER_SIZE (256U)
+
+//! @def ERPC_TRACE_THREADS
+//!
+//! Count of threads which can record at the same time. A ring is taken by a thread on its first record and kept until
+//! the thread exits (see erpc_trace_thread_exit()). Default value 8.
+//#define ERPC_TRACE_THREADS (8U)
+
+//! @def ERPC_TRANSPORT_STATS
+//!
+//! Enable counters of transports: messages, bytes, failed transfers, CRC and framing errors, frame sizes and for
+//! socket transports system calls, would block results, partial transfers, connects and connection drops. Counters
+//! are read by erpc_transport_get_stats(). Each counter update is one atomic add. Default value 0 (disabled).
+//#define ERPC_TRANSPORT_STATS (1U)
+
+//! @def ERPC_MEMORY_ACCOUNTING
+//!
+//! Enable accounting of memory allocated by erpc_malloc() and operator new: count of allocations, current and peak
+//! bytes in total, per category (buffers, codecs, decoded parameters, arbitrator nodes, other) and per function for
+//! decoded parameters. Counters are read by erpc_memory_get_stats(). Each allocation grows by a header of two
+//! pointers, so memory from erpc_malloc() must be freed by erpc_free(). Default value 0 (disabled).
+//#define ERPC_MEMORY_ACCOUNTING (1U)
+
+//! @def ERPC_MEMORY_ACCOUNTING_FUNCTIONS
+//!
+//! Count of functions which can have own counters of decoded parameters. Parameters of further functions are only
+//! counted in their category. Default value 16.
+//#define ERPC_MEMORY_ACCOUNTING_FUNCTIONS (16U)
+
+//! @def ERPC_INTER_THREAD_BUFFER_SLOTS
+//!
+//! Count of messages which can be pending for one side of inter thread buffer transport, power of two. Sender blocks
+//! when all slots are full. Default value 4.
+//#define ERPC_INTER_THREAD_BUFFER_SLOTS (4U)
+
+//! @def ERPC_SERIAL_RX_BUFFER_SIZE
+//!
+//! Size of receive buffer of serial transport on POSIX hosts. Serial transport reads all bytes available on the tty at
+//! once into this buffer and framing takes its data from it. Default value 256.
+//#define ERPC_SERIAL_RX_BUFFER_SIZE (256U)
+
+//! @def ERPC_SOCK_IO_URING
+//!
+//! Enable io_uring receive back end of server side socket transports (Linux only). One multishot receive stays posted
+//! on the socket and received data are taken from registered buffers without a system call per message. The ring and
+//! its buffers are allocated by the first receive of a server, clients keep using read(). On kernels older than 6.0
+//! transports fall back to read(). Default value 0 (disabled).
+//#define ERPC_SOCK_IO_URING (1U)
+
+//! @def ERPC_SOCK_IO_URING_BUFFERS
+//!
+//! Count of receive buffers registered with io_uring per server socket transport, power of two. Default value 16.
+//#define ERPC_SOCK_IO_URING_BUFFERS (16U)
+
+//! @def ERPC_SOCK_IO_URING_BUFFER_SIZE
+//!
+//! Size of one io_uring receive buffer. Default value 4096.
+//#define ERPC_SOCK_IO_URING_BUFFER_SIZE (4096U)
+
+//! @def ERPC_UDP_BATCH_SIZE
+//!
+//! Count of datagrams UDP transport receives by one recvmmsg() call and most datagrams it can gather for one
+//! sendmmsg() call. Default value 8.
+//#define ERPC_UDP_BATCH_SIZE (8U)
+
+//! @def ERPC_UDP_MAX_DATAGRAM_SIZE
+//!
+//! Size of largest datagram handled by UDP transport, including its 8 bytes header. Larger datagrams are dropped.
+//! Default value is ERPC_DEFAULT_BUFFER_SIZE.
+//#define ERPC_UDP_MAX_DATAGRAM_SIZE (256U)
+
 //! @name Assert function definition
 //@{
 //! User custom asser defition. Include header file if needed before bellow line. If assert is not enabled, default will
@@ -66,7 +66,7 @@ void ArbitratedClientManager::performClientRequest(RequestContext &request)
 #if ERPC_MESSAGE_LOGGING
     if (request.getCodec()->isStatusOk() == true)
     {
-        err = logMessage(request.getCodec()->getBuffer());
+        err = logMessage(&request.getCodec()->getBufferRef());
         request.getCodec()->updateStatus(err);
     }
 #endif
@@ -74,10 +74,16 @@ void ArbitratedClientManager::performClientRequest(RequestContext &request)
     // Send the request.
     if (request.getCodec()->isStatusOk() == true)
     {
+        ERPC_TRACE_POINT(kErpcTrace_Send, request.getServiceId(), request.getMethodId(), request.getSequence(),
+                         request.getCodec()->getBufferRef().getUsed());
         err = m_arbitrator->send(&request.getCodec()->getBufferRef());
         request.getCodec()->updateStatus(err);
     }
 
+#if ERPC_CLIENT_METRICS
+    request.endPhase(ClientMetrics::kSendPhase);
+#endif
+
     if (!request.isOneway())
     {
         if (request.getCodec()->isStatusOk() == true)
@@ -90,7 +96,7 @@ void ArbitratedClientManager::performClientRequest(RequestContext &request)
 #if ERPC_MESSAGE_LOGGING
         if (request.getCodec()->isStatusOk() == true)
         {
-            err = logMessage(request.getCodec()->getBuffer());
+            err = logMessage(&request.getCodec()->getBufferRef());
             request.getCodec()->updateStatus(err);
         }
 #endif
@@ -99,6 +105,12 @@ void ArbitratedClientManager::performClientRequest(RequestContext &request)
         {
             // Check the reply.
             verifyReply(request);
+            ERPC_TRACE_POINT(kErpcTrace_ReplyReceived, request.getServiceId(), request.getMethodId(),
+                             request.getSequence(), request.getCodec()->getBufferRef().getUsed());
         }
+
+#if ERPC_CLIENT_METRICS
+        request.endPhase(ClientMetrics::kWaitPhase);
+#endif
     }
 }
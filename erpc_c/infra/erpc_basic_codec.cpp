@@ -36,6 +36,10 @@ void BasicCodec::startWriteMessage(message_type_t type, uint32_t service, uint32
     uint32_t header =
         (kBasicCodecVersion << 24u) | ((service & 0xffu) << 16u) | ((request & 0xffu) << 8u) | ((uint32_t)type & 0xffu);
 
+#if ERPC_MEMORY_ACCOUNTING
+    m_memoryTag = ERPC_MEMORY_TAG_FUNCTION(service, request);
+#endif
+
     write(header);
 
     write(sequence);
@@ -181,6 +185,9 @@ void BasicCodec::startReadMessage(message_type_t &type, uint32_t &service, uint3
         service = ((header >> 16) & 0xffU);
         request = ((header >> 8) & 0xffU);
         type = static_cast<message_type_t>(header & 0xffU);
+#if ERPC_MEMORY_ACCOUNTING
+        m_memoryTag = ERPC_MEMORY_TAG_FUNCTION(service, request);
+#endif
 
         read(sequence);
     }
@@ -369,7 +376,7 @@ void BasicCodec::readNullFlag(bool &isNull)
     }
 }
 
-ERPC_MANUALLY_CONSTRUCTED_ARRAY_STATIC(BasicCodec, s_basicCodecManual, ERPC_CODEC_COUNT);
+ERPC_STATIC_OBJECT_POOL(BasicCodec, s_basicCodecPool, ERPC_CODEC_COUNT);
 
 BasicCodecFactory::BasicCodecFactory(void) : CodecFactory() {}
 
@@ -377,10 +384,10 @@ BasicCodecFactory::~BasicCodecFactory(void) {}
 
 Codec *BasicCodecFactory::create(void)
 {
-    ERPC_CREATE_NEW_OBJECT(BasicCodec, s_basicCodecManual, ERPC_CODEC_COUNT)
+    ERPC_CREATE_NEW_OBJECT(BasicCodec, s_basicCodecPool, ERPC_CODEC_COUNT)
 }
 
 void BasicCodecFactory::dispose(Codec *codec)
 {
-    ERPC_DESTROY_OBJECT(codec, s_basicCodecManual, ERPC_CODEC_COUNT)
+    ERPC_DESTROY_OBJECT(codec, s_basicCodecPool, ERPC_CODEC_COUNT)
 }
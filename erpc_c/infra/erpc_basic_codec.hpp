@@ -53,6 +53,8 @@ public:
      */
     virtual ~BasicCodec(void);
 
+    ERPC_MEMORY_CATEGORY_OPERATORS(kErpcMemory_Codecs)
+
     //! @name Encoding
     //@{
     /*!
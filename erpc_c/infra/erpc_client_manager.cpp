@@ -10,6 +10,10 @@
 
 #include "erpc_client_manager.h"
 
+#if ERPC_CLIENT_METRICS
+#include "erpc_utils.hpp"
+#endif
+
 using namespace erpc;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -26,16 +30,39 @@ bool nestingDetection = false;
 
 RequestContext ClientManager::createRequest(bool isOneway)
 {
+#if ERPC_CLIENT_METRICS
+    uint32_t startTime = getTimeUsecs();
+#endif
+
     // Create codec to read and write the request.
     Codec *codec = createBufferAndCodec();
 
-    return RequestContext(++m_sequence, codec, isOneway);
+    RequestContext request(++m_sequence, codec, isOneway);
+
+    // Function is not known before encoding, trace records are matched by sequence.
+    ERPC_TRACE_POINT(kErpcTrace_RequestCreate, 0, 0, request.getSequence(), 0);
+
+#if ERPC_CLIENT_METRICS
+    request.setPhaseStart(startTime);
+    request.endPhase(ClientMetrics::kAcquirePhase);
+#endif
+
+    return request;
 }
 
 void ClientManager::performRequest(RequestContext &request)
 {
     bool performRequest;
 
+#if ERPC_CLIENT_METRICS
+    request.endPhase(ClientMetrics::kEncodePhase);
+#endif
+#if ERPC_CLIENT_METRICS || ERPC_TRACE
+    readRequestFunction(request);
+#endif
+    ERPC_TRACE_POINT(kErpcTrace_EncodeDone, request.getServiceId(), request.getMethodId(), request.getSequence(),
+                     request.getCodec()->getBufferRef().getUsed());
+
     // Check the codec status
     performRequest = request.getCodec()->isStatusOk();
 
@@ -67,21 +94,42 @@ void ClientManager::performClientRequest(RequestContext &request)
     }
 #endif
 
+#if ERPC_ONEWAY_CREDITS
+    if (request.isOneway() && (request.getCodec()->isStatusOk() == true))
+    {
+        markCreditedOneway(request);
+    }
+#endif
+
 #if ERPC_MESSAGE_LOGGING
     if (request.getCodec()->isStatusOk() == true)
     {
-        err = logMessage(request.getCodec()->getBuffer());
+        err = logMessage(&request.getCodec()->getBufferRef());
         request.getCodec()->updateStatus(err);
     }
 #endif
 
+#if ERPC_ONEWAY_CREDITS
+    // Oneway request can be sent only with credit from server.
+    if (request.isOneway() && (request.getCodec()->isStatusOk() == true))
+    {
+        takeOnewayCredit(request);
+    }
+#endif
+
     // Send invocation request to server.
     if (request.getCodec()->isStatusOk() == true)
     {
+        ERPC_TRACE_POINT(kErpcTrace_Send, request.getServiceId(), request.getMethodId(), request.getSequence(),
+                         request.getCodec()->getBufferRef().getUsed());
         err = m_transport->send(&request.getCodec()->getBufferRef());
         request.getCodec()->updateStatus(err);
     }
 
+#if ERPC_CLIENT_METRICS
+    request.endPhase(ClientMetrics::kSendPhase);
+#endif
+
     // If the request is oneway, then there is nothing more to do.
     if (!request.isOneway())
     {
@@ -92,10 +140,19 @@ void ClientManager::performClientRequest(RequestContext &request)
             request.getCodec()->updateStatus(err);
         }
 
+#if ERPC_ONEWAY_CREDITS
+        // Credit messages can arrive before the reply.
+        while ((request.getCodec()->isStatusOk() == true) && readCredit(request.getCodec()))
+        {
+            err = m_transport->receive(&request.getCodec()->getBufferRef());
+            request.getCodec()->updateStatus(err);
+        }
+#endif
+
 #if ERPC_MESSAGE_LOGGING
         if (request.getCodec()->isStatusOk() == true)
         {
-            err = logMessage(request.getCodec()->getBuffer());
+            err = logMessage(&request.getCodec()->getBufferRef());
             request.getCodec()->updateStatus(err);
         }
 #endif
@@ -104,7 +161,13 @@ void ClientManager::performClientRequest(RequestContext &request)
         if (request.getCodec()->isStatusOk() == true)
         {
             verifyReply(request);
+            ERPC_TRACE_POINT(kErpcTrace_ReplyReceived, request.getServiceId(), request.getMethodId(),
+                             request.getSequence(), request.getCodec()->getBufferRef().getUsed());
         }
+
+#if ERPC_CLIENT_METRICS
+        request.endPhase(ClientMetrics::kWaitPhase);
+#endif
     }
 }
 
@@ -118,7 +181,7 @@ void ClientManager::performNestedClientRequest(RequestContext &request)
 #if ERPC_MESSAGE_LOGGING
     if (request.getCodec()->isStatusOk() == true)
     {
-        err = logMessage(request.getCodec()->getBuffer());
+        err = logMessage(&request.getCodec()->getBufferRef());
         request.getCodec()->updateStatus(err);
     }
 #endif
@@ -126,10 +189,16 @@ void ClientManager::performNestedClientRequest(RequestContext &request)
     // Send invocation request to server.
     if (request.getCodec()->isStatusOk() == true)
     {
+        ERPC_TRACE_POINT(kErpcTrace_Send, request.getServiceId(), request.getMethodId(), request.getSequence(),
+                         request.getCodec()->getBufferRef().getUsed());
         err = m_transport->send(&request.getCodec()->getBufferRef());
         request.getCodec()->updateStatus(err);
     }
 
+#if ERPC_CLIENT_METRICS
+    request.endPhase(ClientMetrics::kSendPhase);
+#endif
+
     // If the request is oneway, then there is nothing more to do.
     if (!request.isOneway())
     {
@@ -144,7 +213,7 @@ void ClientManager::performNestedClientRequest(RequestContext &request)
 #if ERPC_MESSAGE_LOGGING
         if (request.getCodec()->isStatusOk() == true)
         {
-            err = logMessage(request.getCodec()->getBuffer());
+            err = logMessage(&request.getCodec()->getBufferRef());
             request.getCodec()->updateStatus(err);
         }
 #endif
@@ -153,7 +222,13 @@ void ClientManager::performNestedClientRequest(RequestContext &request)
         if (request.getCodec()->isStatusOk() == true)
         {
             verifyReply(request);
+            ERPC_TRACE_POINT(kErpcTrace_ReplyReceived, request.getServiceId(), request.getMethodId(),
+                             request.getSequence(), request.getCodec()->getBufferRef().getUsed());
         }
+
+#if ERPC_CLIENT_METRICS
+        request.endPhase(ClientMetrics::kWaitPhase);
+#endif
     }
 }
 #endif
@@ -175,13 +250,128 @@ void ClientManager::verifyReply(RequestContext &request)
     if (request.getCodec()->isStatusOk() == true)
     {
         // Verify that this is a reply to the request we just sent.
-        if ((msgType != message_type_t::kReplyMessage) || (sequence != request.getSequence()))
+        if (sequence != request.getSequence())
+        {
+            request.getCodec()->updateStatus(kErpcStatus_ExpectedReply);
+        }
+        else if (msgType == message_type_t::kBusyMessage)
+        {
+            request.getCodec()->updateStatus(kErpcStatus_Busy);
+        }
+        else if (msgType != message_type_t::kReplyMessage)
         {
             request.getCodec()->updateStatus(kErpcStatus_ExpectedReply);
         }
     }
 }
 
+#if ERPC_ONEWAY_CREDITS
+void ClientManager::markCreditedOneway(RequestContext &request)
+{
+    Codec *codec = request.getCodec();
+    MessageBuffer &buffer = codec->getBufferRef();
+    uint16_t used = buffer.getUsed();
+    uint8_t reserved = m_transport->reserveHeaderSize();
+    message_type_t msgType;
+    uint32_t service;
+    uint32_t requestNumber;
+    uint32_t sequence;
+
+    codec->reset(reserved);
+    codec->startReadMessage(msgType, service, requestNumber, sequence);
+
+    if ((codec->isStatusOk() == true) && (msgType == message_type_t::kOnewayMessage))
+    {
+        // Header is written again in place, parameters after it stay.
+        codec->reset(reserved);
+        buffer.setUsed(reserved);
+        codec->startWriteMessage(message_type_t::kCreditedOnewayMessage, service, requestNumber, sequence);
+        buffer.setUsed(used);
+    }
+}
+
+void ClientManager::takeOnewayCredit(RequestContext &request)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    Codec *codec = NULL;
+
+    while ((err == kErpcStatus_Success) && (m_onewayCredits == 0U))
+    {
+        if (m_onewayFailFast && !m_transport->hasMessage())
+        {
+            err = kErpcStatus_Busy;
+        }
+        else
+        {
+            if (codec == NULL)
+            {
+                codec = createBufferAndCodec();
+                if (codec == NULL)
+                {
+                    err = kErpcStatus_MemoryError;
+                }
+            }
+
+            if (err == kErpcStatus_Success)
+            {
+                err = m_transport->receive(&codec->getBufferRef());
+            }
+
+            // Other messages are not expected here and are dropped.
+            if (err == kErpcStatus_Success)
+            {
+                (void)readCredit(codec);
+            }
+        }
+    }
+
+    if (codec != NULL)
+    {
+        m_messageFactory->dispose(&codec->getBufferRef());
+        m_codecFactory->dispose(codec);
+    }
+
+    if (err == kErpcStatus_Success)
+    {
+        --m_onewayCredits;
+    }
+    else
+    {
+        request.getCodec()->updateStatus(err);
+    }
+}
+
+bool ClientManager::readCredit(Codec *codec)
+{
+    message_type_t msgType;
+    uint32_t service;
+    uint32_t requestNumber;
+    uint32_t sequence;
+    uint32_t credit = 0U;
+    bool isCredit = false;
+
+    codec->reset(m_transport->reserveHeaderSize());
+    codec->startReadMessage(msgType, service, requestNumber, sequence);
+
+    if ((codec->isStatusOk() == true) && (msgType == message_type_t::kCreditMessage))
+    {
+        codec->read(credit);
+        if (codec->isStatusOk() == true)
+        {
+            // Credit of oneway messages sent before reconnection can be returned too.
+            m_onewayCredits += credit;
+            if (m_onewayCredits > ERPC_ONEWAY_CREDITS)
+            {
+                m_onewayCredits = ERPC_ONEWAY_CREDITS;
+            }
+            isCredit = true;
+        }
+    }
+
+    return isCredit;
+}
+#endif
+
 Codec *ClientManager::createBufferAndCodec(void)
 {
     Codec *codec = m_codecFactory->create();
@@ -208,6 +398,19 @@ Codec *ClientManager::createBufferAndCodec(void)
 
 void ClientManager::releaseRequest(RequestContext &request)
 {
+#if ERPC_CLIENT_METRICS
+    if ((request.getCodec() != NULL) && request.m_functionKnown)
+    {
+        request.endPhase(ClientMetrics::kDecodePhase);
+        m_metrics.record(request.m_serviceId, request.m_methodId, request.getCodec()->getStatus(),
+                         request.m_phaseUsecs);
+    }
+    else
+    {
+        m_metrics.addUntracked();
+    }
+#endif
+
     if (request.getCodec() != NULL)
     {
         m_messageFactory->dispose(&request.getCodec()->getBufferRef());
@@ -215,6 +418,40 @@ void ClientManager::releaseRequest(RequestContext &request)
     }
 }
 
+#if ERPC_CLIENT_METRICS || ERPC_TRACE
+void ClientManager::readRequestFunction(RequestContext &request)
+{
+    Codec *codec = request.getCodec();
+    erpc_status_t status = codec->getStatus();
+    message_type_t msgType;
+    uint32_t service;
+    uint32_t requestNumber;
+    uint32_t sequence;
+
+    // Encoding error is kept, the header was written before it.
+    codec->reset(m_transport->reserveHeaderSize());
+    codec->startReadMessage(msgType, service, requestNumber, sequence);
+
+    if ((codec->isStatusOk() == true) && (sequence == request.getSequence()))
+    {
+        request.setFunction(service, requestNumber);
+    }
+
+    codec->reset(m_transport->reserveHeaderSize());
+    codec->updateStatus(status);
+}
+#endif
+
+#if ERPC_CLIENT_METRICS
+void RequestContext::endPhase(ClientMetrics::phase_t phase)
+{
+    uint32_t now = getTimeUsecs();
+
+    m_phaseUsecs[phase] = now - m_phaseStart;
+    m_phaseStart = now;
+}
+#endif
+
 void ClientManager::callErrorHandler(erpc_status_t err, uint32_t functionID)
 {
     if (m_errorHandler != NULL)
@@ -13,6 +13,10 @@
 
 #ifdef __cplusplus
 #include "erpc_client_server_common.hpp"
+#if ERPC_CLIENT_METRICS
+#include "erpc_client_metrics.hpp"
+#endif
+#include "erpc_trace.h"
 #if ERPC_NESTED_CALLS
 #include "erpc_server.hpp"
 #include "erpc_threading.h"
@@ -66,6 +70,14 @@ public:
 #if ERPC_NESTED_CALLS
     ,
     m_server(NULL), m_serverThreadId(NULL)
+#endif
+#if ERPC_ONEWAY_CREDITS
+    ,
+    m_onewayCredits(ERPC_ONEWAY_CREDITS), m_onewayFailFast(false)
+#endif
+#if ERPC_CLIENT_METRICS
+    ,
+    m_metrics()
 #endif
     {
     }
@@ -113,6 +125,29 @@ public:
      */
     void callErrorHandler(erpc_status_t err, uint32_t functionID);
 
+#if ERPC_ONEWAY_CREDITS
+    /*!
+     * @brief This function sets behavior when there is no credit for oneway message.
+     *
+     * Fail fast relies on Transport::hasMessage() to find pending credit without blocking. Only transports which
+     * implement it (socket based TCP/UDP/Unix, shared memory, loopback, MU and RPMsg transports) support fail fast.
+     * Other transports inherit hasMessage() returning true, then the client blocks in receive until credit arrives
+     * as if fail fast was off.
+     *
+     * @param[in] failFast True to fail with #kErpcStatus_Busy, false to wait for credit from server.
+     */
+    void setOnewayFailFast(bool failFast) { m_onewayFailFast = failFast; }
+#endif
+
+#if ERPC_CLIENT_METRICS
+    /*!
+     * @brief Return per function counters of this client.
+     *
+     * @return Counters of calls.
+     */
+    ClientMetrics &getMetrics(void) { return m_metrics; }
+#endif
+
 #if ERPC_NESTED_CALLS
     /*!
      * @brief This function sets server used for nested calls.
@@ -136,6 +171,13 @@ protected:
     Server *m_server;                     //!< Server used for nested calls.
     Thread::thread_id_t m_serverThreadId; //!< Thread in which server run function is called.
 #endif
+#if ERPC_ONEWAY_CREDITS
+    uint32_t m_onewayCredits; //!< Count of oneway messages which can be sent.
+    bool m_onewayFailFast;    //!< Fail instead of waiting for credit.
+#endif
+#if ERPC_CLIENT_METRICS
+    ClientMetrics m_metrics; //!< Counters of calls.
+#endif
 
     /*!
      * @brief This function performs request.
@@ -161,6 +203,38 @@ protected:
     //! @brief Validate that an incoming message is a reply.
     virtual void verifyReply(RequestContext &request);
 
+#if ERPC_ONEWAY_CREDITS
+    /*!
+     * @brief Mark encoded oneway message as waiting for credit.
+     *
+     * Message type in the header is changed to message_type_t::kCreditedOnewayMessage, the encoded parameters are
+     * kept. Server returns credit only for marked messages, so clients without credits never get credit messages.
+     *
+     * @param[in] request Oneway request to send.
+     */
+    void markCreditedOneway(RequestContext &request);
+
+    /*!
+     * @brief Take credit for sending oneway message.
+     *
+     * Receives credit messages from server until there is credit. Sets request status to #kErpcStatus_Busy in fail fast
+     * mode when there is no credit and no message to receive.
+     *
+     * @param[in] request Oneway request to send.
+     */
+    void takeOnewayCredit(RequestContext &request);
+
+    /*!
+     * @brief Read received message as credit message.
+     *
+     * @param[in] codec Codec holding received message.
+     *
+     * @retval true Message was credit message, its credit was added.
+     * @retval false Message is other message.
+     */
+    bool readCredit(Codec *codec);
+#endif
+
     /*!
      * @brief Create message buffer and codec.
      *
@@ -171,6 +245,17 @@ protected:
      */
     Codec *createBufferAndCodec(void);
 
+#if ERPC_CLIENT_METRICS || ERPC_TRACE
+    /*!
+     * @brief Read service and function of encoded request from its header.
+     *
+     * Codec keeps its status, its cursor is moved.
+     *
+     * @param[in] request Encoded request.
+     */
+    void readRequestFunction(RequestContext &request);
+#endif
+
 private:
     ClientManager(const ClientManager &other);            //!< Disable copy ctor.
     ClientManager &operator=(const ClientManager &other); //!< Disable copy ctor.
@@ -195,6 +280,14 @@ public:
      */
     RequestContext(uint32_t sequence, Codec *codec, bool argIsOneway) :
     m_sequence(sequence), m_codec(codec), m_oneway(argIsOneway)
+#if ERPC_CLIENT_METRICS || ERPC_TRACE
+    ,
+    m_serviceId(0), m_methodId(0), m_functionKnown(false)
+#endif
+#if ERPC_CLIENT_METRICS
+    ,
+    m_phaseStart(0), m_phaseUsecs()
+#endif
     {
     }
 
@@ -226,10 +319,67 @@ public:
      */
     void setIsOneway(bool oneway) { m_oneway = oneway; }
 
+#if ERPC_CLIENT_METRICS || ERPC_TRACE
+    /*!
+     * @brief Set called function.
+     *
+     * @param[in] serviceId Service of the function.
+     * @param[in] methodId Function id.
+     */
+    void setFunction(uint32_t serviceId, uint32_t methodId)
+    {
+        m_serviceId = serviceId;
+        m_methodId = methodId;
+        m_functionKnown = true;
+    }
+
+    /*!
+     * @brief Get service of called function.
+     *
+     * @return Service id, zero until the function is set.
+     */
+    uint32_t getServiceId(void) const { return m_serviceId; }
+
+    /*!
+     * @brief Get called function.
+     *
+     * @return Function id, zero until the function is set.
+     */
+    uint32_t getMethodId(void) const { return m_methodId; }
+#endif
+
+#if ERPC_CLIENT_METRICS
+
+    /*!
+     * @brief Set start time of first phase.
+     *
+     * @param[in] time Time in microseconds.
+     */
+    void setPhaseStart(uint32_t time) { m_phaseStart = time; }
+
+    /*!
+     * @brief Measure time of phase which ends now. Next phase starts now.
+     *
+     * @param[in] phase Ending phase.
+     */
+    void endPhase(ClientMetrics::phase_t phase);
+#endif
+
 protected:
     uint32_t m_sequence; //!< Sequence number. To be sure that reply belong to current request.
     Codec *m_codec;      //!< Inout codec. Codec for receiving and sending data.
     bool m_oneway;       //!< When true, request context will be oneway type (only send data).
+#if ERPC_CLIENT_METRICS || ERPC_TRACE
+    uint32_t m_serviceId;                                //!< Service of called function.
+    uint32_t m_methodId;                                 //!< Called function.
+    bool m_functionKnown;                                //!< Called function was set.
+
+    friend class ClientManager;
+#endif
+#if ERPC_CLIENT_METRICS
+    uint32_t m_phaseStart;                               //!< Start time of current phase.
+    uint32_t m_phaseUsecs[ClientMetrics::kPhaseCount];   //!< Times of finished phases.
+#endif
 };
 
 } // namespace erpc
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_client_metrics.hpp"
+
+#if ERPC_CLIENT_METRICS
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+ClientMetrics::ClientMetrics(void) :
+m_index(), m_untracked(0), m_counters()
+{
+}
+
+void ClientMetrics::record(uint32_t serviceId, uint32_t methodId, erpc_status_t status,
+                           const uint32_t usecs[kPhaseCount])
+{
+    uint32_t slot;
+    uint32_t phase;
+    uint32_t total = 0;
+
+    if (m_index.findSlot(serviceId, methodId, &slot))
+    {
+        Counters &counters = m_counters[slot];
+
+        (void)__atomic_fetch_add(&counters.calls, 1U, __ATOMIC_RELAXED);
+        if (status != kErpcStatus_Success)
+        {
+            (void)__atomic_fetch_add(&counters.errors, 1U, __ATOMIC_RELAXED);
+            __atomic_store_n(&counters.lastError, (uint32_t)status, __ATOMIC_RELAXED);
+        }
+
+        for (phase = 0; phase < (uint32_t)kTotalPhase; ++phase)
+        {
+            total += usecs[phase];
+            (void)__atomic_fetch_add(&counters.latency[phase][getLatencyBucket(usecs[phase])], 1U,
+                                     __ATOMIC_RELAXED);
+        }
+        (void)__atomic_fetch_add(&counters.latency[kTotalPhase][getLatencyBucket(total)], 1U, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        addUntracked();
+    }
+}
+
+bool ClientMetrics::getFunctionStats(uint32_t index, FunctionStats *stats) const
+{
+    uint32_t slot;
+    uint32_t phase;
+    uint32_t bucket;
+    bool found = m_index.getSlot(index, &slot, &stats->serviceId, &stats->methodId);
+
+    if (found)
+    {
+        const Counters &counters = m_counters[slot];
+
+        stats->calls = __atomic_load_n(&counters.calls, __ATOMIC_RELAXED);
+        stats->errors = __atomic_load_n(&counters.errors, __ATOMIC_RELAXED);
+        stats->lastError = (erpc_status_t)__atomic_load_n(&counters.lastError, __ATOMIC_RELAXED);
+        for (phase = 0; phase < (uint32_t)kPhaseCount; ++phase)
+        {
+            for (bucket = 0; bucket < kLatencyBuckets; ++bucket)
+            {
+                stats->latency[phase][bucket] = __atomic_load_n(&counters.latency[phase][bucket], __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+    return found;
+}
+
+void ClientMetrics::reset(void)
+{
+    uint32_t slot;
+    uint32_t phase;
+    uint32_t bucket;
+
+    for (slot = 0; slot < ERPC_CLIENT_METRICS_FUNCTIONS; ++slot)
+    {
+        Counters &counters = m_counters[slot];
+
+        __atomic_store_n(&counters.calls, 0U, __ATOMIC_RELAXED);
+        __atomic_store_n(&counters.errors, 0U, __ATOMIC_RELAXED);
+        __atomic_store_n(&counters.lastError, 0U, __ATOMIC_RELAXED);
+        for (phase = 0; phase < (uint32_t)kPhaseCount; ++phase)
+        {
+            for (bucket = 0; bucket < kLatencyBuckets; ++bucket)
+            {
+                __atomic_store_n(&counters.latency[phase][bucket], 0U, __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+    __atomic_store_n(&m_untracked, 0U, __ATOMIC_RELAXED);
+}
+
+uint32_t ClientMetrics::getLatencyBucket(uint32_t usecs)
+{
+    uint32_t bucket = 0;
+
+    // Bucket is the bit length of the time.
+    while ((usecs != 0U) && (bucket < (kLatencyBuckets - 1U)))
+    {
+        usecs >>= 1;
+        ++bucket;
+    }
+
+    return bucket;
+}
+
+#endif // ERPC_CLIENT_METRICS
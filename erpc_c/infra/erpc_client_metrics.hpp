@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__CLIENT_METRICS_H_
+#define _EMBEDDED_RPC__CLIENT_METRICS_H_
+
+#include "erpc_common.h"
+#include "erpc_config_internal.h"
+#include "erpc_metrics_index.hpp"
+
+#include <stdint.h>
+
+/*!
+ * @addtogroup infra_client
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Per function timing and error counters of a client.
+ *
+ * Each call is split into phases measured from the caller's side: getting codec and buffer, encoding arguments,
+ * sending (including waits for oneway credit and for the transport), waiting for the reply and decoding it. Time of
+ * each phase and of the whole call goes into a histogram with power of two buckets: bucket 0 counts calls under
+ * 1 us, bucket n counts calls from 2^(n-1) to 2^n us and the last bucket counts all slower calls.
+ *
+ * Functions are assigned slots on their first call without locking and counters are updated by relaxed atomic
+ * adds, so calls from several threads of an arbitrated client do not block each other. Counters wrap around.
+ *
+ * @ingroup infra_client
+ */
+class ClientMetrics
+{
+public:
+    //! @brief Measured phases of a call.
+    enum phase_t
+    {
+        kAcquirePhase = 0, //!< Getting codec and message buffer.
+        kEncodePhase,      //!< Encoding of arguments.
+        kSendPhase,        //!< Sending of request.
+        kWaitPhase,        //!< Waiting for reply.
+        kDecodePhase,      //!< Decoding of reply.
+        kTotalPhase,       //!< Whole call.
+        kPhaseCount        //!< Count of phases.
+    };
+
+    //! @brief Count of buckets of latency histograms.
+    static const uint32_t kLatencyBuckets = 20U;
+
+    //! @brief Counters of one function.
+    struct FunctionStats
+    {
+        uint32_t serviceId;                             /*!< Service of the function. */
+        uint32_t methodId;                              /*!< Function id. */
+        uint32_t calls;                                 /*!< Count of calls. */
+        uint32_t errors;                                /*!< Count of failed calls. */
+        erpc_status_t lastError;                        /*!< Status of last failed call. */
+        uint32_t latency[kPhaseCount][kLatencyBuckets]; /*!< Histograms of phase times. */
+    };
+
+    /*!
+     * @brief Constructor.
+     */
+    ClientMetrics(void);
+
+    /*!
+     * @brief Record one call.
+     *
+     * @param[in] serviceId Service of the called function.
+     * @param[in] methodId Called function.
+     * @param[in] status Final status of the call.
+     * @param[in] usecs Times of phases in microseconds, #kTotalPhase is ignored and computed as their sum.
+     */
+    void record(uint32_t serviceId, uint32_t methodId, erpc_status_t status, const uint32_t usecs[kPhaseCount]);
+
+    /*!
+     * @brief Return count of functions with counters.
+     *
+     * @return Count of functions which were called at least once since construction.
+     */
+    uint32_t getFunctionCount(void) const { return m_index.getCount(); }
+
+    /*!
+     * @brief Read counters of one function.
+     *
+     * Functions keep their index, new functions get higher indexes.
+     *
+     * @param[in] index Index of function, lower than getFunctionCount().
+     * @param[out] stats Counters of the function.
+     *
+     * @retval true Counters were read.
+     * @retval false Index is out of range.
+     */
+    bool getFunctionStats(uint32_t index, FunctionStats *stats) const;
+
+    /*!
+     * @brief Return count of calls not recorded because all #ERPC_CLIENT_METRICS_FUNCTIONS slots are taken or the
+     * function of the call is not known.
+     *
+     * @return Count of unrecorded calls.
+     */
+    uint32_t getUntrackedCount(void) const { return __atomic_load_n(&m_untracked, __ATOMIC_RELAXED); }
+
+    /*!
+     * @brief Count call which could not be recorded.
+     */
+    void addUntracked(void) { (void)__atomic_fetch_add(&m_untracked, 1U, __ATOMIC_RELAXED); }
+
+    /*!
+     * @brief Zero all counters.
+     *
+     * Functions keep their slots. Calls recorded concurrently may be partially lost.
+     */
+    void reset(void);
+
+    /*!
+     * @brief Return histogram bucket for time.
+     *
+     * @param[in] usecs Time in microseconds.
+     *
+     * @return Index of bucket.
+     */
+    static uint32_t getLatencyBucket(uint32_t usecs);
+
+protected:
+    //! @brief Counters of one function.
+    struct Counters
+    {
+        uint32_t calls;                                 /*!< Count of calls. */
+        uint32_t errors;                                /*!< Count of failed calls. */
+        uint32_t lastError;                             /*!< Status of last failed call. */
+        uint32_t latency[kPhaseCount][kLatencyBuckets]; /*!< Histograms of phase times. */
+    };
+
+    MetricsIndex<ERPC_CLIENT_METRICS_FUNCTIONS> m_index;   /*!< Slots of functions. */
+    uint32_t m_untracked;                                  /*!< Count of calls without slot. */
+    Counters m_counters[ERPC_CLIENT_METRICS_FUNCTIONS];    /*!< Counters by slot. */
+};
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__CLIENT_METRICS_H_
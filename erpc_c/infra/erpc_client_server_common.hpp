@@ -102,6 +102,13 @@ public:
      */
     void setMessageBufferFactory(MessageBufferFactory * factory) { m_messageFactory = factory; }
 
+    /*!
+     * @brief This function gets message buffer factory in use.
+     *
+     * @return MessageBufferFactory * Message buffer factory in use.
+     */
+    MessageBufferFactory *getMessageBufferFactory(void) { return m_messageFactory; }
+
     /*!
      * @brief This function sets codec factory to use.
      *
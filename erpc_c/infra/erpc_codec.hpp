@@ -13,6 +13,7 @@
 
 #include "erpc_common.h"
 #include "erpc_message_buffer.hpp"
+#include "erpc_port.h"
 #include "erpc_transport.hpp"
 
 #include <cstdint>
@@ -37,7 +38,10 @@ enum class message_type_t
     kInvocationMessage = 0,
     kOnewayMessage,
     kReplyMessage,
-    kNotificationMessage
+    kNotificationMessage,
+    kBusyMessage,          //!< Reply of overloaded server which refused the request.
+    kCreditMessage,        //!< Oneway credit returned by server.
+    kCreditedOnewayMessage //!< Oneway message of client which waits for its credit to be returned.
 };
 
 typedef void *funPtr;          // Pointer to functions
@@ -58,7 +62,14 @@ public:
      *
      * This function initializes object attributes.
      */
-    Codec(void) : m_cursor(), m_status(kErpcStatus_Success) {}
+    Codec(void) :
+    m_cursor(), m_status(kErpcStatus_Success)
+#if ERPC_MEMORY_ACCOUNTING
+    ,
+    m_memoryTag(kErpcMemory_Params)
+#endif
+    {
+    }
 
     /*!
      * @brief Codec destructor
@@ -395,9 +406,23 @@ public:
      */
     virtual void readNullFlag(bool &isNull) = 0;
 
+#if ERPC_MEMORY_ACCOUNTING
+    /*!
+     * @brief Return memory accounting tag of the function whose message is processed.
+     *
+     * Used by generated code to count decoded parameters per function.
+     *
+     * @return Tag made by ERPC_MEMORY_TAG_FUNCTION().
+     */
+    uint32_t getMemoryTag(void) const { return m_memoryTag; }
+#endif
+
 protected:
     Cursor m_cursor;        /*!< Copy data to message buffers. */
     erpc_status_t m_status; /*!< Status of serialized data. */
+#if ERPC_MEMORY_ACCOUNTING
+    uint32_t m_memoryTag; /*!< Tag of allocations for decoded parameters of current message. */
+#endif
 };
 
 /*!
@@ -78,7 +78,10 @@ enum _erpc_status
     kErpcStatus_NestedCallFailure,
 
     //! When sending address from bigger architecture to smaller.
-    kErpcStatus_BadAddressScale
+    kErpcStatus_BadAddressScale,
+
+    //! Server is overloaded and refused the request. Caller should back off and try again later.
+    kErpcStatus_Busy
 };
 
 /*! @brief Type used for all status and error return values. */
@@ -23,7 +23,12 @@ Crc16::~Crc16(void) {}
 
 uint16_t Crc16::computeCRC16(const uint8_t *data, uint32_t lengthInBytes)
 {
-    uint32_t crc = m_crcStart;
+    return updateCRC16(static_cast<uint16_t>(m_crcStart), data, lengthInBytes);
+}
+
+uint16_t Crc16::updateCRC16(uint16_t crcPrevious, const uint8_t *data, uint32_t lengthInBytes)
+{
+    uint32_t crc = crcPrevious;
     uint32_t j;
     uint32_t i;
     uint32_t byte;
@@ -56,6 +56,17 @@ public:
      */
     uint16_t computeCRC16(const uint8_t *data, uint32_t lengthInBytes);
 
+    /*!
+     * @brief Continue CRC-16 computation with next part of the data.
+     *
+     * @param[in] crcPrevious CRC-16 returned for previous parts of the data.
+     * @param[in] data Pointer to next part of the data.
+     * @param[in] lengthInBytes Length of the part.
+     *
+     * @return CRC-16 over all parts, same as computeCRC16() over the whole data.
+     */
+    uint16_t updateCRC16(uint16_t crcPrevious, const uint8_t *data, uint32_t lengthInBytes);
+
     /*!
      * @brief Set crc start number.
      *
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_fragmenting_transport.hpp"
+
+#include ENDIANNESS_HEADER
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Offsets of fragment header fields.
+#define FRAGMENT_ID_OFFSET (0U)
+#define FRAGMENT_OFFSET_OFFSET (2U)
+#define FRAGMENT_TOTAL_OFFSET (4U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+FragmentingTransport::FragmentingTransport(Transport *transport, uint16_t mtu) :
+Transport(), m_transport(transport), m_fragmentFactory(NULL), m_mtu(mtu), m_sendMessageId(0), m_droppedCount(0)
+#if !ERPC_THREADS_IS(NONE)
+,
+m_sendLock(false), m_receiveLock(false)
+#endif
+{
+    erpc_assert(transport != NULL);
+    erpc_assert(mtu > kHeaderSize);
+}
+
+FragmentingTransport::~FragmentingTransport(void) {}
+
+bool FragmentingTransport::prepareFragment(MessageBuffer &fragment)
+{
+    if (fragment.get() == NULL)
+    {
+        MessageBuffer created = m_fragmentFactory->create();
+        fragment.swap(&created);
+    }
+
+    return fragment.get() != NULL;
+}
+
+erpc_status_t FragmentingTransport::send(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    MessageBuffer fragment;
+    uint8_t *header;
+    uint16_t length = message->getUsed();
+    uint16_t offset = 0;
+    uint16_t capacity;
+    uint16_t chunk;
+    uint16_t messageId;
+    uint16_t fragmentId;
+    uint16_t fragmentOffset;
+    uint16_t total;
+    uint8_t reserved = m_transport->reserveHeaderSize();
+
+    erpc_assert(m_fragmentFactory != NULL);
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_sendLock);
+#endif
+
+    messageId = m_sendMessageId++;
+
+    // Fragments are sent back to back, receiver detects a lost one by its offset.
+    do
+    {
+        if (!prepareFragment(fragment) || (fragment.getLength() <= (reserved + kHeaderSize)))
+        {
+            status = kErpcStatus_MemoryError;
+            break;
+        }
+
+        capacity = fragment.getLength() - reserved;
+        if (capacity > m_mtu)
+        {
+            capacity = m_mtu;
+        }
+        chunk = capacity - kHeaderSize;
+        if (chunk > (length - offset))
+        {
+            chunk = length - offset;
+        }
+
+        header = &fragment.get()[reserved];
+        fragmentId = messageId;
+        fragmentOffset = offset;
+        total = length;
+        ERPC_WRITE_AGNOSTIC_16(fragmentId);
+        ERPC_WRITE_AGNOSTIC_16(fragmentOffset);
+        ERPC_WRITE_AGNOSTIC_16(total);
+        (void)memcpy(&header[FRAGMENT_ID_OFFSET], &fragmentId, sizeof(fragmentId));
+        (void)memcpy(&header[FRAGMENT_OFFSET_OFFSET], &fragmentOffset, sizeof(fragmentOffset));
+        (void)memcpy(&header[FRAGMENT_TOTAL_OFFSET], &total, sizeof(total));
+
+        (void)memcpy(&header[kHeaderSize], &message->get()[offset], chunk);
+        fragment.setUsed(reserved + kHeaderSize + chunk);
+
+        status = m_transport->send(&fragment);
+        offset += chunk;
+    } while ((status == kErpcStatus_Success) && (offset < length));
+
+    if (fragment.get() != NULL)
+    {
+        m_fragmentFactory->dispose(&fragment);
+    }
+
+    return status;
+}
+
+erpc_status_t FragmentingTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    MessageBuffer fragment;
+    const uint8_t *header;
+    uint8_t reserved = m_transport->reserveHeaderSize();
+    bool createBuffer;
+    bool inProgress = false;
+    bool discard = false;
+    bool complete = false;
+    bool skipping = false;
+    uint16_t messageId = 0;
+    uint16_t total = 0;
+    uint16_t received = 0;
+    uint16_t skippedId = 0;
+    uint16_t fragmentId;
+    uint16_t fragmentOffset;
+    uint16_t fragmentTotal;
+    uint16_t chunk;
+
+    erpc_assert(m_fragmentFactory != NULL);
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_receiveLock);
+#endif
+
+    // Same rule as for server buffers: some transports hand over their own receive buffer.
+    createBuffer = m_fragmentFactory->createServerBuffer();
+
+    while (!complete)
+    {
+        if (createBuffer && !prepareFragment(fragment))
+        {
+            status = kErpcStatus_MemoryError;
+            break;
+        }
+
+        status = m_transport->receive(&fragment);
+        if (status != kErpcStatus_Success)
+        {
+            break;
+        }
+
+        if (fragment.getUsed() < (reserved + kHeaderSize))
+        {
+            fragmentOffset = 0;
+            fragmentTotal = 0;
+            chunk = 0;
+            fragmentId = messageId;
+            header = NULL;
+        }
+        else
+        {
+            header = &fragment.get()[reserved];
+            (void)memcpy(&fragmentId, &header[FRAGMENT_ID_OFFSET], sizeof(fragmentId));
+            (void)memcpy(&fragmentOffset, &header[FRAGMENT_OFFSET_OFFSET], sizeof(fragmentOffset));
+            (void)memcpy(&fragmentTotal, &header[FRAGMENT_TOTAL_OFFSET], sizeof(fragmentTotal));
+            ERPC_READ_AGNOSTIC_16(fragmentId);
+            ERPC_READ_AGNOSTIC_16(fragmentOffset);
+            ERPC_READ_AGNOSTIC_16(fragmentTotal);
+            chunk = fragment.getUsed() - reserved - kHeaderSize;
+        }
+
+        if ((header != NULL) && (fragmentOffset == 0U))
+        {
+            if (inProgress)
+            {
+                ++m_droppedCount;
+            }
+            inProgress = true;
+            messageId = fragmentId;
+            total = fragmentTotal;
+            received = 0;
+            discard = (total > message->getLength());
+        }
+
+        if ((header == NULL) || !inProgress || (fragmentId != messageId) || (fragmentOffset != received) ||
+            (fragmentTotal != total) || (chunk > (total - received)))
+        {
+            // Message lost a fragment, skip the rest of it until the next first fragment.
+            if (inProgress || !skipping || (fragmentId != skippedId))
+            {
+                ++m_droppedCount;
+            }
+            inProgress = false;
+            skipping = true;
+            skippedId = fragmentId;
+        }
+        else
+        {
+            if (!discard)
+            {
+                (void)memcpy(&message->get()[received], &header[kHeaderSize], chunk);
+            }
+            received += chunk;
+
+            if (received == total)
+            {
+                inProgress = false;
+                if (discard)
+                {
+                    ++m_droppedCount;
+                }
+                else
+                {
+                    message->setUsed(total);
+                    complete = true;
+                }
+            }
+        }
+
+        if (!createBuffer)
+        {
+            m_fragmentFactory->dispose(&fragment);
+            fragment.set(NULL, 0);
+        }
+    }
+
+    if (fragment.get() != NULL)
+    {
+        m_fragmentFactory->dispose(&fragment);
+    }
+
+    return status;
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__FRAGMENTING_TRANSPORT_H_
+#define _EMBEDDED_RPC__FRAGMENTING_TRANSPORT_H_
+
+#include "erpc_config_internal.h"
+#include "erpc_message_buffer.hpp"
+#include "erpc_transport.hpp"
+
+#if !ERPC_THREADS_IS(NONE)
+#include "erpc_threading.h"
+#endif
+
+/*!
+ * @addtogroup infra_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+
+/*!
+ * @brief Transport splitting messages into fragments for transports with small MTU.
+ *
+ * Wraps another transport whose messages are limited by the size of its buffers (e.g. RPMsg, SPI, I2C). Each
+ * message is sent as a sequence of fragments of at most MTU bytes, without waiting for acknowledgement of single
+ * fragments. Receiver reassembles the fragments directly into the message buffer given to receive(), which comes
+ * from the message buffer factory of the client or server.
+ *
+ * Fragments are carried in buffers of the fragment factory, which must be suitable for the wrapped transport.
+ * The wrapped transport must deliver fragments in order. Incomplete messages and messages larger than the receive
+ * buffer are dropped and counted.
+ *
+ * @ingroup infra_transport
+ */
+class FragmentingTransport : public Transport
+{
+public:
+    //! @brief Size of header at the beginning of each fragment.
+    static const uint8_t kHeaderSize = 6;
+
+    /*!
+     * @brief Constructor.
+     *
+     * @param[in] transport Wrapped transport carrying fragments.
+     * @param[in] mtu Maximum size of one fragment including the fragment header, without header of the wrapped
+     * transport. Must be bigger than #kHeaderSize.
+     */
+    FragmentingTransport(Transport *transport, uint16_t mtu);
+
+    /*!
+     * @brief Destructor.
+     */
+    virtual ~FragmentingTransport(void);
+
+    /*!
+     * @brief Set message buffer factory for fragments.
+     *
+     * Must be called before the transport is used.
+     *
+     * @param[in] factory Factory creating buffers for the wrapped transport.
+     */
+    void setFragmentFactory(MessageBufferFactory *factory) { m_fragmentFactory = factory; }
+
+    /*!
+     * @brief Return wrapped transport.
+     *
+     * @return Transport carrying fragments.
+     */
+    Transport *getTransport(void) { return m_transport; }
+
+    /*!
+     * @brief Return count of dropped messages.
+     *
+     * @return Count of incomplete messages and messages too big for the receive buffer.
+     */
+    uint32_t getDroppedCount(void) const { return m_droppedCount; }
+
+    /*!
+     * @brief Receive fragments until a message is complete.
+     *
+     * @param[out] message Buffer for the reassembled message.
+     *
+     * @return Error of the wrapped transport.
+     */
+    virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief Send message as a sequence of fragments.
+     *
+     * @param[in] message Message to send.
+     *
+     * @return Error of the wrapped transport, #kErpcStatus_MemoryError when no fragment buffer is available.
+     */
+    virtual erpc_status_t send(MessageBuffer *message) override;
+
+    /*!
+     * @brief Poll for an incoming fragment.
+     *
+     * @retval True when the wrapped transport has data to receive.
+     */
+    virtual bool hasMessage(void) override { return m_transport->hasMessage(); }
+
+    /*!
+     * @brief This functions sets the CRC-16 implementation of the wrapped transport.
+     *
+     * @param[in] crcImpl Object containing crc-16 compute function.
+     */
+    virtual void setCrc16(Crc16 *crcImpl) override { m_transport->setCrc16(crcImpl); }
+
+    /*!
+     * @brief This functions gets the CRC-16 object of the wrapped transport.
+     *
+     * @return Crc16* Pointer to CRC-16 object containing crc-16 compute function.
+     */
+    virtual Crc16 *getCrc16(void) override { return m_transport->getCrc16(); }
+
+protected:
+    Transport *m_transport;                  //!< Wrapped transport carrying fragments.
+    MessageBufferFactory *m_fragmentFactory; //!< Factory of fragment buffers.
+    uint16_t m_mtu;                          //!< Maximum size of fragment including fragment header.
+    uint16_t m_sendMessageId;                //!< Identifier of the next sent message.
+    uint32_t m_droppedCount;                 //!< Count of dropped received messages.
+#if !ERPC_THREADS_IS(NONE)
+    Mutex m_sendLock;    //!< Keeps fragments of one message together.
+    Mutex m_receiveLock; //!< Mutex protecting receive.
+#endif
+
+    /*!
+     * @brief Prepare buffer for next fragment.
+     *
+     * The wrapped transport may take the buffer over while sending or receiving, so a new one is created whenever
+     * the previous one is gone.
+     *
+     * @param[in,out] fragment Fragment buffer.
+     *
+     * @return True when the buffer is available.
+     */
+    bool prepareFragment(MessageBuffer &fragment);
+
+private:
+    FragmentingTransport(const FragmentingTransport &other);            /*!< Disable copy ctor. */
+    FragmentingTransport &operator=(const FragmentingTransport &other); /*!< Disable copy ctor. */
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__FRAGMENTING_TRANSPORT_H_
@@ -26,7 +26,7 @@ FramedTransport::FramedTransport(void) :
 Transport(), m_crcImpl(NULL)
 #if !ERPC_THREADS_IS(NONE)
 ,
-m_sendLock(), m_receiveLock()
+m_sendLock(false), m_receiveLock(false)
 #endif
 {
 }
@@ -90,11 +90,10 @@ erpc_status_t FramedTransport::receive(MessageBuffer *message)
             ERPC_READ_AGNOSTIC_16(h.m_messageSize);
             ERPC_READ_AGNOSTIC_16(h.m_crcBody);
 
-            computedCrc =
-                m_crcImpl->computeCRC16(reinterpret_cast<const uint8_t *>(&h.m_messageSize), sizeof(h.m_messageSize)) +
-                m_crcImpl->computeCRC16(reinterpret_cast<const uint8_t *>(&h.m_crcBody), sizeof(h.m_crcBody));
+            computedCrc = computeHeaderCrc(h.m_messageSize, h.m_crcBody);
             if (computedCrc != h.m_crcHeader)
             {
+                countStat(&erpc_transport_stats_t::crcErrors);
                 retVal = kErpcStatus_CrcCheckFailed;
             }
         }
@@ -104,6 +103,7 @@ erpc_status_t FramedTransport::receive(MessageBuffer *message)
             // received size can't be larger then buffer length.
             if ((h.m_messageSize + reserveHeaderSize()) > message->getLength())
             {
+                countStat(&erpc_transport_stats_t::framingErrors);
                 retVal = kErpcStatus_ReceiveFailed;
             }
         }
@@ -125,10 +125,13 @@ erpc_status_t FramedTransport::receive(MessageBuffer *message)
         computedCrc = m_crcImpl->computeCRC16(&message->get()[offset], h.m_messageSize);
         if (computedCrc != h.m_crcBody)
         {
+            countStat(&erpc_transport_stats_t::crcErrors);
             retVal = kErpcStatus_CrcCheckFailed;
         }
     }
 
+    countReceive(retVal, h.m_messageSize + reserveHeaderSize());
+
     return retVal;
 }
 
@@ -136,19 +139,28 @@ erpc_status_t FramedTransport::send(MessageBuffer *message)
 {
     erpc_status_t ret;
     uint16_t messageLength;
-    Header h;
-    uint8_t offset;
 
     erpc_assert((m_crcImpl != NULL) && ("Uninitialized Crc16 object." != NULL));
 
     messageLength = message->getUsed() - reserveHeaderSize();
 
     // Send header first.
-    h.m_messageSize = messageLength;
-    h.m_crcBody = m_crcImpl->computeCRC16(&message->get()[reserveHeaderSize()], messageLength);
-    h.m_crcHeader =
-        m_crcImpl->computeCRC16(reinterpret_cast<const uint8_t *>(&h.m_messageSize), sizeof(h.m_messageSize)) +
-        m_crcImpl->computeCRC16(reinterpret_cast<const uint8_t *>(&h.m_crcBody), sizeof(h.m_crcBody));
+    writeHeader(message, messageLength, m_crcImpl->computeCRC16(&message->get()[reserveHeaderSize()], messageLength));
+
+    ret = underlyingSend(message, message->getUsed(), 0);
+    countSend(ret, messageLength + reserveHeaderSize());
+
+    return ret;
+}
+
+void FramedTransport::writeHeader(MessageBuffer *message, uint16_t messageSize, uint16_t crcBody)
+{
+    Header h;
+    uint8_t offset;
+
+    h.m_messageSize = messageSize;
+    h.m_crcBody = crcBody;
+    h.m_crcHeader = computeHeaderCrc(h.m_messageSize, h.m_crcBody);
 
     ERPC_WRITE_AGNOSTIC_16(h.m_crcHeader);
     ERPC_WRITE_AGNOSTIC_16(h.m_messageSize);
@@ -161,10 +173,12 @@ erpc_status_t FramedTransport::send(MessageBuffer *message)
     offset += sizeof(h.m_messageSize);
     static_cast<void>(
         memcpy(&message->get()[offset], reinterpret_cast<const uint8_t *>(&h.m_crcBody), sizeof(h.m_crcBody)));
+}
 
-    ret = underlyingSend(message, message->getUsed(), 0);
-
-    return ret;
+uint16_t FramedTransport::computeHeaderCrc(uint16_t messageSize, uint16_t crcBody)
+{
+    return m_crcImpl->computeCRC16(reinterpret_cast<const uint8_t *>(&messageSize), sizeof(messageSize)) +
+           m_crcImpl->computeCRC16(reinterpret_cast<const uint8_t *>(&crcBody), sizeof(crcBody));
 }
 
 erpc_status_t FramedTransport::underlyingSend(MessageBuffer *message, uint32_t size, uint32_t offset)
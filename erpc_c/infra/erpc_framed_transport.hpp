@@ -132,6 +132,25 @@ protected:
     Mutex m_receiveLock; //!< Mutex protecting receive.
 #endif
 
+    /*!
+     * @brief Compute CRC-16 protecting the frame header.
+     *
+     * @param[in] messageSize Size of the message in the header.
+     * @param[in] crcBody CRC-16 of the message in the header.
+     *
+     * @return Expected value of Header::m_crcHeader.
+     */
+    uint16_t computeHeaderCrc(uint16_t messageSize, uint16_t crcBody);
+
+    /*!
+     * @brief Write frame header to space reserved at the beginning of the message buffer.
+     *
+     * @param[in] message Message buffer to send.
+     * @param[in] messageSize Size of the message excluding the header.
+     * @param[in] crcBody CRC-16 over the message data.
+     */
+    void writeHeader(MessageBuffer *message, uint16_t messageSize, uint16_t crcBody);
+
     /*!
      * @brief Adds ability to framed transport to overwrite MessageBuffer when sending data.
      *
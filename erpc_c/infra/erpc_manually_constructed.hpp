@@ -181,6 +181,138 @@ protected:
     bool m_isConstructed = false;
 };
 
+/*!
+ * @brief Static pool of objects with constant time allocation.
+ *
+ * Free objects are kept in a lock-free list linked by object indexes, so objects can be created and destroyed from
+ * any thread without locking and without searching the storage. The list head carries a tag which changes with each
+ * update, so a head read before other threads took and returned the same object cannot be swapped in (ABA problem).
+ *
+ * Where the compiler provides 64-bit compare and swap the head is 64 bits with a 32-bit tag, which does not wrap in
+ * practice. Elsewhere (e.g. Cortex-M) the head is 32 bits with a 16-bit tag: a thread preempted between reading the
+ * head and swapping it can still corrupt the list if other threads update the head exactly a multiple of 65536 times
+ * meanwhile and leave the same object first.
+ *
+ * Objects which were never used are not in the list, they are taken in order from the storage. All members are
+ * valid when zero initialized, so the pool needs no constructor and can be used during static initialization.
+ *
+ * @ingroup infra_utility
+ */
+template <class T, uint32_t objectCount>
+class StaticObjectPool
+{
+public:
+    /*!
+     * @brief Construct object in a free slot of the pool.
+     *
+     * @param[in] args Arguments for the object's constructor.
+     *
+     * @return Pointer to constructed object, nullptr when all objects are used.
+     */
+    template <typename... Args>
+    T *create(const Args &...args)
+    {
+        uint32_t index = take();
+        T *object = nullptr;
+
+        if (index < objectCount)
+        {
+            m_objects[index].construct(args...);
+            object = m_objects[index].get();
+        }
+
+        return object;
+    }
+
+    /*!
+     * @brief Destroy object and return its slot to the pool.
+     *
+     * Pointers which were not created by this pool are ignored.
+     *
+     * @param[in] object Object to destroy, may point to a base class of T.
+     */
+    template <class U>
+    void destroy(U *object)
+    {
+        T *item = static_cast<T *>(object);
+        uintptr_t offset = reinterpret_cast<uintptr_t>(item) - reinterpret_cast<uintptr_t>(&m_objects[0]);
+        uintptr_t index = offset / sizeof(ManuallyConstructed<T>);
+
+        if ((item != nullptr) && (index < objectCount) && (m_objects[index].get() == item))
+        {
+            m_objects[index].destroy();
+            give(static_cast<uint32_t>(index));
+        }
+    }
+
+protected:
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+    typedef uint64_t head_t;                   /*!< Free list head, 32-bit tag and 32-bit index. */
+    static const uint32_t kIndexBits = 32U;    /*!< Head bits holding index of first free object plus one. */
+#else
+    typedef uint32_t head_t;                   /*!< Free list head, 16-bit tag and 16-bit index. */
+    static const uint32_t kIndexBits = 16U;    /*!< Head bits holding index of first free object plus one. */
+#endif
+    static const head_t kIndexMask = (((head_t)1U) << kIndexBits) - 1U; /*!< Index bits of head. */
+    static const head_t kTagIncrement = ((head_t)1U) << kIndexBits;      /*!< Tag change of each head update. */
+
+    static_assert(objectCount < kIndexMask, "Too many objects for StaticObjectPool.");
+
+    ManuallyConstructed<T> m_objects[objectCount]; /*!< Storage of objects. */
+    uint32_t m_next[objectCount];                  /*!< Index plus one of next free object, zero for end of list. */
+    head_t m_freeHead;                             /*!< Tag and index plus one of first free object, zero for none. */
+    uint32_t m_unused;                             /*!< Count of objects taken from the storage for the first time. */
+
+    /*!
+     * @brief Take index of a free object.
+     *
+     * @return Index of the object, objectCount when all objects are used.
+     */
+    uint32_t take(void)
+    {
+        head_t head = __atomic_load_n(&m_freeHead, __ATOMIC_ACQUIRE);
+        uint32_t index = objectCount;
+        uint32_t next;
+        bool taken = false;
+
+        while (!taken && ((head & kIndexMask) != 0U))
+        {
+            index = static_cast<uint32_t>(head & kIndexMask) - 1U;
+            next = __atomic_load_n(&m_next[index], __ATOMIC_RELAXED);
+            taken = __atomic_compare_exchange_n(&m_freeHead, &head, ((head + kTagIncrement) & ~kIndexMask) | next,
+                                                true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE);
+        }
+
+        if (!taken)
+        {
+            index = __atomic_load_n(&m_unused, __ATOMIC_RELAXED);
+            while (!taken && (index < objectCount))
+            {
+                taken = __atomic_compare_exchange_n(&m_unused, &index, index + 1U, true, __ATOMIC_RELAXED,
+                                                    __ATOMIC_RELAXED);
+            }
+        }
+
+        return taken ? index : objectCount;
+    }
+
+    /*!
+     * @brief Put index of destroyed object to the free list.
+     *
+     * @param[in] index Index of the object.
+     */
+    void give(uint32_t index)
+    {
+        head_t head = __atomic_load_n(&m_freeHead, __ATOMIC_RELAXED);
+
+        do
+        {
+            __atomic_store_n(&m_next[index], static_cast<uint32_t>(head & kIndexMask), __ATOMIC_RELAXED);
+        } while (!__atomic_compare_exchange_n(&m_freeHead, &head, ((head + kTagIncrement) & ~kIndexMask) | (index + 1U),
+                                              true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    }
+};
+
 #define ERPC_MANUALLY_CONSTRUCTED(class, variableName) static ManuallyConstructed<class> variableName
 #define ERPC_MANUALLY_CONSTRUCTED_ARRAY(class, variableName, dimension) \
     ERPC_MANUALLY_CONSTRUCTED(class, variableName)[dimension]
@@ -198,37 +330,22 @@ protected:
 #define ERPC_MANUALLY_CONSTRUCTED_ARRAY_STATIC(class, variableName, dimension)
 #endif
 
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+#define ERPC_STATIC_OBJECT_POOL(class, variableName, dimension) static StaticObjectPool<class, dimension> variableName
+#else
+#define ERPC_STATIC_OBJECT_POOL(class, variableName, dimension)
+#endif
+
 #if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
-#define ERPC_CREATE_NEW_OBJECT(class, arrayOfObjects, numberOfObjects, ...) \
+#define ERPC_CREATE_NEW_OBJECT(class, objectPool, numberOfObjects, ...) \
     return new (std::nothrow) class(__VA_ARGS__);
 
 #define ERPC_DESTROY_OBJECT(object, ...) delete object;
 
 #elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
-#define ERPC_CREATE_NEW_OBJECT(class, arrayOfObjects, numberOfObjects, ...)         \
-    uint8_t objectsIterator;                                                        \
-    class *ret = NULL;                                                              \
-    for (objectsIterator = 0; objectsIterator < numberOfObjects; objectsIterator++) \
-    {                                                                               \
-        if (!arrayOfObjects[objectsIterator].isUsed())                              \
-        {                                                                           \
-            arrayOfObjects[objectsIterator].construct(__VA_ARGS__);                 \
-            ret = arrayOfObjects[objectsIterator].get();                            \
-            break;                                                                  \
-        }                                                                           \
-    }                                                                               \
-    return ret;
-
-#define ERPC_DESTROY_OBJECT(object, arrayOfObjects, numberOfObjects)                \
-    uint8_t objectsIterator;                                                        \
-    for (objectsIterator = 0; objectsIterator < numberOfObjects; objectsIterator++) \
-    {                                                                               \
-        if (object == arrayOfObjects[objectsIterator].get())                        \
-        {                                                                           \
-            arrayOfObjects[objectsIterator].destroy();                              \
-            break;                                                                  \
-        }                                                                           \
-    }
+#define ERPC_CREATE_NEW_OBJECT(class, objectPool, numberOfObjects, ...) return objectPool.create(__VA_ARGS__);
+
+#define ERPC_DESTROY_OBJECT(object, objectPool, numberOfObjects) objectPool.destroy(object);
 #endif
 
 } // namespace erpc
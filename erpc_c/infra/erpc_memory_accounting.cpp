@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_port.h"
+
+#if ERPC_MEMORY_ACCOUNTING
+
+#include "erpc_metrics_index.hpp"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+//! @brief Slot value of allocations not counted per function.
+const uint16_t kNoSlot = 0xffffU;
+
+/*!
+ * @brief Header placed before each allocation.
+ *
+ * Size of two pointers keeps the returned memory aligned as the port aligns it.
+ */
+union AllocationHeader
+{
+    struct
+    {
+        uint32_t size;     /*!< Requested size. */
+        uint16_t category; /*!< Category of the allocation. */
+        uint16_t slot;     /*!< Function slot of decoded parameters, kNoSlot for others. */
+    } info;                /*!< Accounting data. */
+    void *align[2];        /*!< Sets size and alignment of the header. */
+};
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+static erpc_memory_stats_t s_total;
+static erpc_memory_stats_t s_categories[kErpcMemory_CategoryCount];
+static erpc_memory_stats_t s_functions[ERPC_MEMORY_ACCOUNTING_FUNCTIONS];
+static MetricsIndex<ERPC_MEMORY_ACCOUNTING_FUNCTIONS> s_functionIndex;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+static void countAllocation(erpc_memory_stats_t *stats, uint32_t size)
+{
+    uint32_t current = __atomic_add_fetch(&stats->currentBytes, size, __ATOMIC_RELAXED);
+    uint32_t peak = __atomic_load_n(&stats->peakBytes, __ATOMIC_RELAXED);
+
+    (void)__atomic_fetch_add(&stats->allocations, 1U, __ATOMIC_RELAXED);
+    while ((current > peak) &&
+           !__atomic_compare_exchange_n(&stats->peakBytes, &peak, current, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    {
+    }
+}
+
+static void countFree(erpc_memory_stats_t *stats, uint32_t size)
+{
+    (void)__atomic_fetch_sub(&stats->currentBytes, size, __ATOMIC_RELAXED);
+    (void)__atomic_fetch_add(&stats->frees, 1U, __ATOMIC_RELAXED);
+}
+
+static void copyStats(const erpc_memory_stats_t *counters, erpc_memory_stats_t *stats)
+{
+    stats->allocations = __atomic_load_n(&counters->allocations, __ATOMIC_RELAXED);
+    stats->frees = __atomic_load_n(&counters->frees, __ATOMIC_RELAXED);
+    stats->failures = __atomic_load_n(&counters->failures, __ATOMIC_RELAXED);
+    stats->currentBytes = __atomic_load_n(&counters->currentBytes, __ATOMIC_RELAXED);
+    stats->peakBytes = __atomic_load_n(&counters->peakBytes, __ATOMIC_RELAXED);
+}
+
+static void resetPeak(erpc_memory_stats_t *stats)
+{
+    __atomic_store_n(&stats->peakBytes, __atomic_load_n(&stats->currentBytes, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+}
+
+void *erpc_malloc_tagged(size_t size, uint32_t tag)
+{
+    AllocationHeader *header = static_cast<AllocationHeader *>(erpc_port_malloc(sizeof(AllocationHeader) + size));
+    uint32_t category = tag & 0xffU;
+    uint32_t slot;
+    void *p = NULL;
+
+    if (category >= (uint32_t)kErpcMemory_CategoryCount)
+    {
+        category = kErpcMemory_Other;
+    }
+
+    if (header == NULL)
+    {
+        (void)__atomic_fetch_add(&s_total.failures, 1U, __ATOMIC_RELAXED);
+        (void)__atomic_fetch_add(&s_categories[category].failures, 1U, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        header->info.size = static_cast<uint32_t>(size);
+        header->info.category = static_cast<uint16_t>(category);
+        header->info.slot = kNoSlot;
+
+        if ((category == kErpcMemory_Params) &&
+            s_functionIndex.findSlot((tag >> 8) & 0xffU, (tag >> 16) & 0xffU, &slot))
+        {
+            header->info.slot = static_cast<uint16_t>(slot);
+            countAllocation(&s_functions[slot], header->info.size);
+        }
+        countAllocation(&s_categories[category], header->info.size);
+        countAllocation(&s_total, header->info.size);
+
+        p = &header[1];
+    }
+
+    return p;
+}
+
+void *erpc_malloc(size_t size)
+{
+    return erpc_malloc_tagged(size, kErpcMemory_Other);
+}
+
+void erpc_free(void *ptr)
+{
+    AllocationHeader *header;
+
+    if (ptr != NULL)
+    {
+        header = &static_cast<AllocationHeader *>(ptr)[-1];
+
+        if (header->info.slot != kNoSlot)
+        {
+            countFree(&s_functions[header->info.slot], header->info.size);
+        }
+        countFree(&s_categories[header->info.category], header->info.size);
+        countFree(&s_total, header->info.size);
+
+        erpc_port_free(header);
+    }
+}
+
+void erpc_memory_get_total_stats(erpc_memory_stats_t *stats)
+{
+    erpc_assert(stats != NULL);
+
+    copyStats(&s_total, stats);
+}
+
+bool erpc_memory_get_stats(erpc_memory_category_t category, erpc_memory_stats_t *stats)
+{
+    bool valid = ((uint32_t)category < (uint32_t)kErpcMemory_CategoryCount);
+
+    erpc_assert(stats != NULL);
+
+    if (valid)
+    {
+        copyStats(&s_categories[category], stats);
+    }
+
+    return valid;
+}
+
+uint32_t erpc_memory_get_function_count(void)
+{
+    return s_functionIndex.getCount();
+}
+
+bool erpc_memory_get_function_stats(uint32_t index, uint32_t *serviceId, uint32_t *methodId,
+                                    erpc_memory_stats_t *stats)
+{
+    uint32_t slot;
+    bool found;
+
+    erpc_assert((serviceId != NULL) && (methodId != NULL) && (stats != NULL));
+
+    found = s_functionIndex.getSlot(index, &slot, serviceId, methodId);
+    if (found)
+    {
+        copyStats(&s_functions[slot], stats);
+    }
+
+    return found;
+}
+
+void erpc_memory_reset_peaks(void)
+{
+    uint32_t i;
+
+    resetPeak(&s_total);
+    for (i = 0; i < (uint32_t)kErpcMemory_CategoryCount; ++i)
+    {
+        resetPeak(&s_categories[i]);
+    }
+    for (i = 0; i < ERPC_MEMORY_ACCOUNTING_FUNCTIONS; ++i)
+    {
+        resetPeak(&s_functions[i]);
+    }
+}
+
+#endif // ERPC_MEMORY_ACCOUNTING
@@ -251,7 +251,10 @@ MessageBuffer MessageBufferFactory::create(uint8_t reserveHeaderSize)
 {
     MessageBuffer messageBuffer = create();
 
-    messageBuffer.setUsed(reserveHeaderSize);
+    if (messageBuffer.get() != NULL)
+    {
+        messageBuffer.setUsed(reserveHeaderSize);
+    }
 
     return messageBuffer;
 }
@@ -15,6 +15,9 @@
 #if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
 #include <new>
 #endif
+#if ERPC_MESSAGE_LOGGING_ASYNC
+#include <cstring>
+#endif
 
 using namespace erpc;
 using namespace std;
@@ -23,17 +26,51 @@ using namespace std;
 // Code
 ////////////////////////////////////////////////////////////////////////////////
 
-ERPC_MANUALLY_CONSTRUCTED_ARRAY_STATIC(MessageLogger, s_messageLoggersManual, ERPC_MESSAGE_LOGGERS_COUNT);
+#if ERPC_MESSAGE_LOGGING_ASYNC
+#if (ERPC_MESSAGE_LOGGING_QUEUE_SIZE & (ERPC_MESSAGE_LOGGING_QUEUE_SIZE - 1U)) != 0U
+#error "ERPC_MESSAGE_LOGGING_QUEUE_SIZE must be power of two."
+#endif
+#endif
+
+ERPC_STATIC_OBJECT_POOL(MessageLogger, s_messageLoggersPool, ERPC_MESSAGE_LOGGERS_COUNT);
+
+MessageLoggers::MessageLoggers(void) :
+m_logger(NULL)
+#if ERPC_MESSAGE_LOGGING_ASYNC
+,
+m_enqueuePos(0), m_dequeuePos(0), m_dropped(0), m_thread("erpc_logger"), m_messageSem(0), m_exitSem(0),
+m_threadStarted(false), m_stopping(false)
+#endif
+{
+#if ERPC_MESSAGE_LOGGING_ASYNC
+    uint32_t index;
+
+    for (index = 0; index < ERPC_MESSAGE_LOGGING_QUEUE_SIZE; ++index)
+    {
+        m_slots[index].sequence = index;
+    }
+#endif
+}
 
 MessageLoggers::~MessageLoggers(void)
 {
     MessageLogger *logger;
 
+#if ERPC_MESSAGE_LOGGING_ASYNC
+    if (m_threadStarted)
+    {
+        // Queued messages are logged before the thread exits.
+        __atomic_store_n(&m_stopping, true, __ATOMIC_RELEASE);
+        m_messageSem.put();
+        (void)m_exitSem.get();
+    }
+#endif
+
     while (m_logger != NULL)
     {
         logger = m_logger;
         m_logger = m_logger->getNext();
-        ERPC_DESTROY_OBJECT(logger, s_messageLoggersManual, ERPC_MESSAGE_LOGGERS_COUNT)
+        ERPC_DESTROY_OBJECT(logger, s_messageLoggersPool, ERPC_MESSAGE_LOGGERS_COUNT)
     }
 }
 
@@ -48,9 +85,10 @@ bool MessageLoggers::addMessageLogger(Transport *transport)
         logger = create(transport);
         if (logger != NULL)
         {
+            // Logger is published after its construction, logging thread and callers may walk the list now.
             if (m_logger == NULL)
             {
-                m_logger = logger;
+                __atomic_store_n(&m_logger, logger, __ATOMIC_RELEASE);
             }
             else
             {
@@ -63,6 +101,15 @@ bool MessageLoggers::addMessageLogger(Transport *transport)
                 _logger->setNext(logger);
             }
             retVal = true;
+
+#if ERPC_MESSAGE_LOGGING_ASYNC
+            if (!m_threadStarted)
+            {
+                m_threadStarted = true;
+                m_thread.init(loggingThreadEntry);
+                m_thread.start(this);
+            }
+#endif
         }
     }
 
@@ -70,9 +117,104 @@ bool MessageLoggers::addMessageLogger(Transport *transport)
 }
 
 erpc_status_t MessageLoggers::logMessage(MessageBuffer *msg)
+{
+#if ERPC_MESSAGE_LOGGING_ASYNC
+    LogSlot *slot = NULL;
+    uint32_t pos;
+    int32_t diff;
+
+    if (__atomic_load_n(&m_logger, __ATOMIC_ACQUIRE) == NULL)
+    {
+        return kErpcStatus_Success;
+    }
+
+    // Bounded multi producer queue. Slot sequence equal to the position means the slot is free for the producer of
+    // that position, sequence one higher means it holds the message of that position.
+    if (msg->getUsed() <= sizeof(slot->data))
+    {
+        pos = __atomic_load_n(&m_enqueuePos, __ATOMIC_RELAXED);
+        for (;;)
+        {
+            slot = &m_slots[pos & (ERPC_MESSAGE_LOGGING_QUEUE_SIZE - 1U)];
+            diff = static_cast<int32_t>(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - pos);
+            if (diff == 0)
+            {
+                if (__atomic_compare_exchange_n(&m_enqueuePos, &pos, pos + 1U, true, __ATOMIC_RELAXED,
+                                                __ATOMIC_RELAXED))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // Queue is full.
+                slot = NULL;
+                break;
+            }
+            else
+            {
+                pos = __atomic_load_n(&m_enqueuePos, __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+    if (slot != NULL)
+    {
+        (void)memcpy(slot->data, msg->get(), msg->getUsed());
+        slot->length = msg->getUsed();
+        __atomic_store_n(&slot->sequence, pos + 1U, __ATOMIC_RELEASE);
+        m_messageSem.put();
+    }
+    else
+    {
+        (void)__atomic_fetch_add(&m_dropped, 1U, __ATOMIC_RELAXED);
+    }
+
+    return kErpcStatus_Success;
+#else
+    return sendToLoggers(msg);
+#endif
+}
+
+#if ERPC_MESSAGE_LOGGING_ASYNC
+void MessageLoggers::loggingThread(void)
+{
+    LogSlot *slot;
+    MessageBuffer message;
+
+    while (!__atomic_load_n(&m_stopping, __ATOMIC_ACQUIRE))
+    {
+        (void)m_messageSem.get();
+
+        // Messages can complete out of order, so each wake up logs all complete messages in order.
+        for (;;)
+        {
+            slot = &m_slots[m_dequeuePos & (ERPC_MESSAGE_LOGGING_QUEUE_SIZE - 1U)];
+            if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != (m_dequeuePos + 1U))
+            {
+                break;
+            }
+            message.set(slot->data, sizeof(slot->data));
+            message.setUsed(slot->length);
+            (void)sendToLoggers(&message);
+            __atomic_store_n(&slot->sequence, m_dequeuePos + ERPC_MESSAGE_LOGGING_QUEUE_SIZE, __ATOMIC_RELEASE);
+            ++m_dequeuePos;
+        }
+    }
+
+    m_exitSem.put();
+}
+
+void MessageLoggers::loggingThreadEntry(void *arg)
+{
+    reinterpret_cast<MessageLoggers *>(arg)->loggingThread();
+}
+#endif
+
+erpc_status_t MessageLoggers::sendToLoggers(MessageBuffer *msg)
 {
     erpc_status_t err = kErpcStatus_Success;
-    MessageLogger *_logger = m_logger;
+    MessageLogger *_logger = __atomic_load_n(&m_logger, __ATOMIC_ACQUIRE);
 
     while (_logger != NULL)
     {
@@ -92,7 +234,7 @@ erpc_status_t MessageLoggers::logMessage(MessageBuffer *msg)
 
 MessageLogger *MessageLoggers::create(Transport *transport)
 {
-    ERPC_CREATE_NEW_OBJECT(MessageLogger, s_messageLoggersManual, ERPC_MESSAGE_LOGGERS_COUNT, transport)
+    ERPC_CREATE_NEW_OBJECT(MessageLogger, s_messageLoggersPool, ERPC_MESSAGE_LOGGERS_COUNT, transport)
 }
 
 #endif /* ERPC_MESSAGE_LOGGING */
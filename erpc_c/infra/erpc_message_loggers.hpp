@@ -10,6 +10,9 @@
 #define _EMBEDDED_RPC__LOGEVENTLISTENERS_H_
 
 #include "erpc_transport.hpp"
+#if ERPC_MESSAGE_LOGGING_ASYNC
+#include "erpc_threading.h"
+#endif
 
 /*!
  * @addtogroup infra_transport
@@ -46,14 +49,16 @@ public:
      *
      * @return Pointer to next logger.
      */
-    MessageLogger *getNext(void) { return m_next; }
+    MessageLogger *getNext(void) { return __atomic_load_n(&m_next, __ATOMIC_ACQUIRE); }
 
     /*!
      * @brief Set next logger.
      *
+     * Release store, so a logging thread walking the list sees the next logger fully constructed.
+     *
      * @param[in] next Pointer to next logger.
      */
-    void setNext(MessageLogger *next) { m_next = next; }
+    void setNext(MessageLogger *next) { __atomic_store_n(&m_next, next, __ATOMIC_RELEASE); }
 
     /*!
      * @brief Returns next transport object used for logging messages.
@@ -70,6 +75,10 @@ protected:
 /*!
  * @brief Logging messages functionality.
  *
+ * With ERPC_MESSAGE_LOGGING_ASYNC, messages are copied to a bounded lock-free queue and passed to the loggers by a
+ * logging thread, which is started with the first logger. Calls never wait for the loggers, messages which do not fit
+ * into the queue are dropped.
+ *
  * @ingroup infra_utility
  */
 class MessageLoggers
@@ -78,7 +87,7 @@ public:
     /*!
      * @brief Constructor.
      */
-    MessageLoggers(void) : m_logger(NULL){};
+    MessageLoggers(void);
 
     /*!
      * @brief Transport destructor
@@ -88,6 +97,9 @@ public:
     /*!
      * @brief This function add given transport to newly created MessageLogger object.
      *
+     * The logger is appended by an atomic store, so loggers can be added while messages are being logged. Loggers
+     * must not be added from several threads at once.
+     *
      * @param[in] transport Transport used for logging messages
      *
      * @retval True When transport was successfully added.
@@ -95,11 +107,44 @@ public:
      */
     bool addMessageLogger(Transport *transport);
 
+#if ERPC_MESSAGE_LOGGING_ASYNC
+    /*!
+     * @brief Return count of messages which were not logged because the queue was full or they were too big.
+     *
+     * @return Count of dropped messages.
+     */
+    uint32_t getDroppedCount(void) const { return __atomic_load_n(&m_dropped, __ATOMIC_RELAXED); }
+#endif
+
 protected:
     MessageLogger *m_logger; /*!< Pointer to first logger. */
 
+#if ERPC_MESSAGE_LOGGING_ASYNC
     /*!
-     * @brief This function add given transport to newly created MessageLogger object.
+     * @brief Copy of logged message.
+     */
+    struct LogSlot
+    {
+        uint32_t sequence;                       /*!< Position the slot is free or full for, see logMessage(). */
+        uint16_t length;                         /*!< Length of message. */
+        uint8_t data[ERPC_DEFAULT_BUFFER_SIZE]; /*!< Message. */
+    };
+
+    LogSlot m_slots[ERPC_MESSAGE_LOGGING_QUEUE_SIZE]; /*!< Queue of messages. */
+    uint32_t m_enqueuePos;                            /*!< Count of messages put to the queue. */
+    uint32_t m_dequeuePos;                            /*!< Count of messages taken from the queue. */
+    uint32_t m_dropped;                               /*!< Count of dropped messages. */
+    Thread m_thread;                                  /*!< Logging thread. */
+    Semaphore m_messageSem;                           /*!< Counts messages in the queue. */
+    Semaphore m_exitSem;                              /*!< Signalled by exiting logging thread. */
+    bool m_threadStarted;                             /*!< Logging thread was started. */
+    bool m_stopping;                                  /*!< Logging thread should exit. */
+#endif
+
+    /*!
+     * @brief Log message by all loggers.
+     *
+     * With ERPC_MESSAGE_LOGGING_ASYNC the message is only queued and the function always succeeds.
      *
      * @param[in] msg Buffer which will be logged.
      *
@@ -108,6 +153,29 @@ protected:
     erpc_status_t logMessage(MessageBuffer *msg);
 
 private:
+    /*!
+     * @brief Pass message to all loggers.
+     *
+     * @param[in] msg Buffer which will be logged.
+     *
+     * @return The eRPC status of first failed logger.
+     */
+    erpc_status_t sendToLoggers(MessageBuffer *msg);
+
+#if ERPC_MESSAGE_LOGGING_ASYNC
+    /*!
+     * @brief Pass queued messages to loggers until stopped.
+     */
+    void loggingThread(void);
+
+    /*!
+     * @brief Entry point of logging thread.
+     *
+     * @param[in] arg Pointer to the loggers.
+     */
+    static void loggingThreadEntry(void *arg);
+#endif
+
     /**
      * @brief This function create new MessageLogger object
      *
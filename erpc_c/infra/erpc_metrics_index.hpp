@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__METRICS_INDEX_H_
+#define _EMBEDDED_RPC__METRICS_INDEX_H_
+
+#include <stdint.h>
+
+/*!
+ * @addtogroup infra_utility
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Template class assigning counter slots to service and method pairs without locking.
+ *
+ * Pairs get a slot on first use by compare and swap in an open addressing table, slots are never freed. Slots can
+ * be listed by index in order of their assignment.
+ *
+ * @ingroup infra_utility
+ */
+template <uint32_t slotCount>
+class MetricsIndex
+{
+public:
+    /*!
+     * @brief Constructor.
+     */
+    MetricsIndex(void) : m_keys(), m_order(), m_count(0) {}
+
+    /*!
+     * @brief Find slot of service and method, assign free slot on first use.
+     *
+     * @param[in] serviceId Service id.
+     * @param[in] methodId Method id.
+     * @param[out] slot Slot of the pair.
+     *
+     * @retval true Slot was found.
+     * @retval false All slots are taken.
+     */
+    bool findSlot(uint32_t serviceId, uint32_t methodId, uint32_t *slot)
+    {
+        uint32_t key = kKeyUsed | ((serviceId & 0x7fffU) << 16) | (methodId & 0xffffU);
+        uint32_t index = (key * 2654435761U) % slotCount;
+        uint32_t probe;
+        uint32_t current;
+        bool found = false;
+
+        for (probe = 0; probe < slotCount; ++probe)
+        {
+            current = __atomic_load_n(&m_keys[index], __ATOMIC_RELAXED);
+            if (current == 0U)
+            {
+                if (__atomic_compare_exchange_n(&m_keys[index], &current, key, false, __ATOMIC_RELAXED,
+                                                __ATOMIC_RELAXED))
+                {
+                    uint32_t order = __atomic_fetch_add(&m_count, 1U, __ATOMIC_RELAXED);
+                    __atomic_store_n(&m_order[order], index + 1U, __ATOMIC_RELEASE);
+                    current = key;
+                }
+            }
+
+            if (current == key)
+            {
+                *slot = index;
+                found = true;
+                break;
+            }
+
+            index = (index + 1U) % slotCount;
+        }
+
+        return found;
+    }
+
+    /*!
+     * @brief Return count of assigned slots.
+     *
+     * @return Count of assigned slots.
+     */
+    uint32_t getCount(void) const
+    {
+        uint32_t count = __atomic_load_n(&m_count, __ATOMIC_RELAXED);
+
+        return (count < slotCount) ? count : slotCount;
+    }
+
+    /*!
+     * @brief Return slot assigned as index-th one.
+     *
+     * @param[in] index Index of assignment, lower than getCount().
+     * @param[out] slot Slot.
+     * @param[out] serviceId Service id of the slot.
+     * @param[out] methodId Method id of the slot.
+     *
+     * @retval true Slot was returned.
+     * @retval false Index is out of range.
+     */
+    bool getSlot(uint32_t index, uint32_t *slot, uint32_t *serviceId, uint32_t *methodId) const
+    {
+        uint32_t order = 0;
+        uint32_t key;
+
+        if (index < getCount())
+        {
+            // Slot is stored shortly after it is counted.
+            order = __atomic_load_n(&m_order[index], __ATOMIC_ACQUIRE);
+        }
+
+        if (order != 0U)
+        {
+            *slot = order - 1U;
+            key = __atomic_load_n(&m_keys[*slot], __ATOMIC_RELAXED);
+            *serviceId = (key >> 16) & 0x7fffU;
+            *methodId = key & 0xffffU;
+        }
+
+        return (order != 0U);
+    }
+
+protected:
+    //! @brief Marks used slot in m_keys, so that service 0 method 0 differs from free slot.
+    static const uint32_t kKeyUsed = 0x80000000U;
+
+    uint32_t m_keys[slotCount];  /*!< Service and method of each slot, zero for free slot. */
+    uint32_t m_order[slotCount]; /*!< Slots plus one in order of assignment, zero until stored. */
+    uint32_t m_count;            /*!< Count of assigned slots. */
+};
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__METRICS_INDEX_H_
@@ -0,0 +1,417 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_priority_server.hpp"
+
+#if ERPC_THREADS_IS(NONE)
+#error "Priority server code does not work in no-threading configuration."
+#endif
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+PriorityServer::PriorityServer(void) :
+SimpleServer(), m_overtaken(), m_queuesMutex(false), m_requestSem(0), m_dedicatedSem(0), m_spaceSem(0), m_exitSem(0),
+m_receiverWaiting(false), m_workersCount(1U), m_dedicatedWorkersCount(0U), m_workersStarted(false), m_workerPriority(0U),
+m_workerStackSize(0U), m_workerCpuMask(0U), m_admissionLimit(0U), m_inFlight(0U), m_busyCount(0U),
+m_droppedCount(0U)
+{
+}
+
+PriorityServer::~PriorityServer(void)
+{
+    uint32_t i;
+
+    if (m_workersStarted)
+    {
+        stop();
+        for (i = 0U; i < (m_workersCount + m_dedicatedWorkersCount); ++i)
+        {
+            (void)m_exitSem.get();
+        }
+    }
+}
+
+erpc_status_t PriorityServer::setWorkers(uint32_t workers, uint32_t dedicatedWorkers)
+{
+    erpc_status_t err = kErpcStatus_Success;
+
+    if (m_workersStarted || (workers == 0U) || ((workers + dedicatedWorkers) > ERPC_PRIORITY_MAX_WORKERS))
+    {
+        err = kErpcStatus_InvalidArgument;
+    }
+    else
+    {
+        m_workersCount = workers;
+        m_dedicatedWorkersCount = dedicatedWorkers;
+    }
+
+    return err;
+}
+
+erpc_status_t PriorityServer::setWorkerAttributes(uint32_t priority, uint32_t stackSize, uint32_t cpuMask)
+{
+    erpc_status_t err = kErpcStatus_Success;
+
+    if (m_workersStarted)
+    {
+        err = kErpcStatus_InvalidArgument;
+    }
+    else
+    {
+        m_workerPriority = priority;
+        m_workerStackSize = stackSize;
+        m_workerCpuMask = cpuMask;
+    }
+
+    return err;
+}
+
+erpc_status_t PriorityServer::run(void)
+{
+    erpc_status_t err = kErpcStatus_Success;
+
+    startWorkers();
+
+    while ((err == kErpcStatus_Success) && m_isServerOn)
+    {
+        err = receiveRequest();
+    }
+
+    return err;
+}
+
+erpc_status_t PriorityServer::poll(void)
+{
+    erpc_status_t err;
+
+    if (m_isServerOn)
+    {
+        startWorkers();
+
+        if (m_transport->hasMessage() == true)
+        {
+            err = receiveRequest();
+        }
+        else
+        {
+            err = kErpcStatus_Success;
+        }
+    }
+    else
+    {
+        err = kErpcStatus_ServerIsDown;
+    }
+
+    return err;
+}
+
+void PriorityServer::stop(void)
+{
+    uint32_t i;
+    bool wakeReceiver;
+
+    SimpleServer::stop();
+
+    // Wake up all workers, so they can exit once the queues are empty.
+    for (i = 0U; i < m_workersCount; ++i)
+    {
+        m_requestSem.put();
+    }
+    for (i = 0U; i < m_dedicatedWorkersCount; ++i)
+    {
+        m_dedicatedSem.put();
+    }
+
+    {
+        Mutex::Guard lock(m_queuesMutex);
+        wakeReceiver = m_receiverWaiting;
+        m_receiverWaiting = false;
+    }
+    if (wakeReceiver)
+    {
+        m_spaceSem.put();
+    }
+}
+
+void PriorityServer::startWorkers(void)
+{
+    uint32_t i;
+
+    if (!m_workersStarted)
+    {
+        m_workersStarted = true;
+
+        for (i = 0U; i < (m_workersCount + m_dedicatedWorkersCount); ++i)
+        {
+            m_workers[i].setName("erpc_worker");
+            m_workers[i].init((i < m_workersCount) ? workerEntry : dedicatedWorkerEntry, m_workerPriority,
+                              m_workerStackSize);
+#if ERPC_THREADS_IS(PTHREADS)
+            (void)m_workers[i].setCpuAffinity(m_workerCpuMask);
+#endif
+            m_workers[i].start(this);
+        }
+    }
+}
+
+uint32_t PriorityServer::getPriorityLevel(uint32_t serviceId, uint32_t methodId)
+{
+    uint32_t priority = 0U;
+    Service *service = findServiceWithId(serviceId);
+
+    if (service != NULL)
+    {
+        priority = service->getMethodPriority(methodId);
+    }
+
+    if (priority >= ERPC_PRIORITY_LEVELS)
+    {
+        priority = ERPC_PRIORITY_LEVELS - 1U;
+    }
+
+    return priority;
+}
+
+erpc_status_t PriorityServer::receiveRequest(void)
+{
+    MessageBuffer buff;
+    Request request = {};
+    uint32_t level;
+    bool queued = false;
+    bool wait;
+
+    erpc_status_t err = runInternalBegin(&request.codec, buff, request.msgType, request.serviceId, request.methodId,
+                                         request.sequence);
+    if (err == kErpcStatus_Success)
+    {
+        level = getPriorityLevel(request.serviceId, request.methodId);
+
+        while (!queued)
+        {
+            wait = false;
+            {
+                Mutex::Guard lock(m_queuesMutex);
+                if ((m_admissionLimit == 0U) || (m_inFlight < m_admissionLimit))
+                {
+                    queued = m_queues[level].add(request);
+                }
+                if (queued)
+                {
+                    ++m_inFlight;
+                }
+                else if ((m_admissionLimit == 0U) && m_isServerOn)
+                {
+                    // Workers signal space only while the receiver waits for it.
+                    m_receiverWaiting = true;
+                    wait = true;
+                }
+            }
+
+            if (queued)
+            {
+                if ((level == (ERPC_PRIORITY_LEVELS - 1U)) && (m_dedicatedWorkersCount > 0U))
+                {
+                    m_dedicatedSem.put();
+                }
+                else
+                {
+                    m_requestSem.put();
+                }
+            }
+            else if (m_admissionLimit > 0U)
+            {
+                err = shedRequest(request);
+                break;
+            }
+            else if (wait)
+            {
+                // Queue of this priority is full, wait until a worker takes a request.
+                (void)m_spaceSem.get();
+            }
+            else
+            {
+                disposeBufferAndCodec(request.codec);
+                err = kErpcStatus_ServerIsDown;
+                break;
+            }
+        }
+    }
+
+    return err;
+}
+
+erpc_status_t PriorityServer::shedRequest(const Request &request)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    Codec *codec = request.codec;
+
+    if ((request.msgType == message_type_t::kOnewayMessage) ||
+        (request.msgType == message_type_t::kCreditedOnewayMessage))
+    {
+        (void)__atomic_fetch_add(&m_droppedCount, 1U, __ATOMIC_RELAXED);
+#if ERPC_ONEWAY_CREDITS
+        // Dropped message does not hold the credit anymore.
+        if (request.msgType == message_type_t::kCreditedOnewayMessage)
+        {
+            err = returnOnewayCredit(codec, request.serviceId, request.methodId);
+        }
+#endif
+    }
+    else
+    {
+        (void)__atomic_fetch_add(&m_busyCount, 1U, __ATOMIC_RELAXED);
+
+        err = m_messageFactory->prepareServerBufferForSend(codec->getBufferRef(), m_transport->reserveHeaderSize());
+        if (err == kErpcStatus_Success)
+        {
+            codec->reset(m_transport->reserveHeaderSize());
+            codec->startWriteMessage(message_type_t::kBusyMessage, request.serviceId, request.methodId,
+                                     request.sequence);
+            err = codec->getStatus();
+        }
+
+#if ERPC_MESSAGE_LOGGING
+        if (err == kErpcStatus_Success)
+        {
+            err = logMessage(&codec->getBufferRef());
+        }
+#endif
+
+        if (err == kErpcStatus_Success)
+        {
+            err = m_transport->send(&codec->getBufferRef());
+        }
+    }
+
+    disposeBufferAndCodec(codec);
+
+    return err;
+}
+
+bool PriorityServer::takeRequest(bool dedicated, Request *request)
+{
+    const uint32_t topLevel = ERPC_PRIORITY_LEVELS - 1U;
+    uint32_t level;
+    uint32_t firstLevel;
+    uint32_t selected = ERPC_PRIORITY_LEVELS;
+
+    if (dedicated)
+    {
+        if (m_queues[topLevel].size() > 0U)
+        {
+            selected = topLevel;
+        }
+    }
+    else
+    {
+        // Highest level is left to dedicated workers when there are any.
+        firstLevel = (m_dedicatedWorkersCount > 0U) ? topLevel : ERPC_PRIORITY_LEVELS;
+
+        // Starving level goes first, otherwise the most urgent one.
+        for (level = firstLevel; level > 0U; --level)
+        {
+            if ((m_queues[level - 1U].size() > 0U) && (m_overtaken[level - 1U] >= ERPC_PRIORITY_AGING_LIMIT))
+            {
+                selected = level - 1U;
+                break;
+            }
+        }
+        if (selected == ERPC_PRIORITY_LEVELS)
+        {
+            for (level = firstLevel; level > 0U; --level)
+            {
+                if (m_queues[level - 1U].size() > 0U)
+                {
+                    selected = level - 1U;
+                    break;
+                }
+            }
+        }
+
+        // Waiting requests of lower levels were overtaken.
+        for (level = 0U; level < selected; ++level)
+        {
+            if (m_queues[level].size() > 0U)
+            {
+                ++m_overtaken[level];
+            }
+        }
+    }
+
+    if (selected < ERPC_PRIORITY_LEVELS)
+    {
+        (void)m_queues[selected].get(request);
+        m_overtaken[selected] = 0U;
+    }
+
+    return (selected < ERPC_PRIORITY_LEVELS);
+}
+
+void PriorityServer::workerLoop(bool dedicated)
+{
+    Semaphore &semaphore = dedicated ? m_dedicatedSem : m_requestSem;
+    Request request;
+    bool taken;
+    bool wakeReceiver;
+
+    while (true)
+    {
+        (void)semaphore.get();
+
+        {
+            Mutex::Guard lock(m_queuesMutex);
+            taken = takeRequest(dedicated, &request);
+            wakeReceiver = taken && m_receiverWaiting;
+            if (wakeReceiver)
+            {
+                m_receiverWaiting = false;
+            }
+        }
+
+        if (taken)
+        {
+            if (wakeReceiver)
+            {
+                m_spaceSem.put();
+            }
+            (void)runInternalEnd(request.codec, request.msgType, request.serviceId, request.methodId,
+                                 request.sequence);
+
+            Mutex::Guard lock(m_queuesMutex);
+            --m_inFlight;
+        }
+        else if (!m_isServerOn)
+        {
+            break;
+        }
+    }
+
+    m_exitSem.put();
+}
+
+void PriorityServer::workerEntry(void *arg)
+{
+    reinterpret_cast<PriorityServer *>(arg)->workerLoop(false);
+}
+
+void PriorityServer::dedicatedWorkerEntry(void *arg)
+{
+    reinterpret_cast<PriorityServer *>(arg)->workerLoop(true);
+}
@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__PRIORITY_SERVER_H_
+#define _EMBEDDED_RPC__PRIORITY_SERVER_H_
+
+#include "erpc_simple_server.hpp"
+#include "erpc_static_queue.hpp"
+#include "erpc_threading.h"
+
+/*!
+ * @addtogroup infra_server
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Server which serves requests by priority of the invoked method.
+ *
+ * The thread calling run() only receives requests and sorts them into one queue per priority level. Requests are
+ * processed and answered by worker threads, which always take the most urgent waiting request. A waiting request which
+ * was overtaken #ERPC_PRIORITY_AGING_LIMIT times by more urgent ones is served next, so that low priority methods
+ * cannot starve. Optionally the highest priority level can be served by dedicated workers only.
+ *
+ * Method priorities come from Service::getMethodPriority(), which erpcgen generates from the @priority annotation.
+ *
+ * With an admission limit set, requests over the limit are not queued. Invocations are refused with a busy reply,
+ * which clients report as #kErpcStatus_Busy, and oneway messages are dropped.
+ * Nested calls are not supported by this server.
+ *
+ * @ingroup infra_server
+ */
+class PriorityServer : public SimpleServer
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * This function initializes object attributes.
+     */
+    PriorityServer(void);
+
+    /*!
+     * @brief Destructor.
+     *
+     * Stops the server and waits until all workers exit.
+     */
+    virtual ~PriorityServer(void);
+
+    /*!
+     * @brief Set count of worker threads.
+     *
+     * Must be called before the server is run. Sum of both counts is limited by #ERPC_PRIORITY_MAX_WORKERS.
+     *
+     * @param[in] workers Count of workers serving all priority levels.
+     * @param[in] dedicatedWorkers Count of workers serving only the highest priority level. When non zero, the highest
+     * level is served by these workers only.
+     *
+     * @retval kErpcStatus_Success Worker counts were set.
+     * @retval kErpcStatus_InvalidArgument Counts are out of range or workers are already running.
+     */
+    erpc_status_t setWorkers(uint32_t workers, uint32_t dedicatedWorkers);
+
+    /*!
+     * @brief Set attributes of worker threads.
+     *
+     * Must be called before the server is run.
+     *
+     * @param[in] priority Priority of workers, zero for default of the port.
+     * @param[in] stackSize Stack size of workers in units of the port, zero for default.
+     * @param[in] cpuMask CPUs workers can run on, bit n for CPU n, zero for all. Used by pthreads port only.
+     *
+     * @retval kErpcStatus_Success Attributes were set.
+     * @retval kErpcStatus_InvalidArgument Workers are already running.
+     */
+    erpc_status_t setWorkerAttributes(uint32_t priority, uint32_t stackSize, uint32_t cpuMask);
+
+    /*!
+     * @brief Set admission limit.
+     *
+     * Each request holds a message buffer from receiving until it is answered. Keep the limit below the count of
+     * buffers of the message buffer factory, so the server can still receive and refuse requests under load.
+     *
+     * @param[in] maxRequests Maximum count of queued and processed requests. Zero disables admission control, then
+     * receiving blocks while the queue of the request's priority is full.
+     */
+    void setAdmissionLimit(uint32_t maxRequests) { m_admissionLimit = maxRequests; }
+
+    /*!
+     * @brief Return count of invocations refused with busy reply.
+     *
+     * @return Count of refused invocations.
+     */
+    uint32_t getBusyCount(void) const { return __atomic_load_n(&m_busyCount, __ATOMIC_RELAXED); }
+
+    /*!
+     * @brief Return count of dropped oneway messages.
+     *
+     * @return Count of dropped oneway messages.
+     */
+    uint32_t getDroppedCount(void) const { return __atomic_load_n(&m_droppedCount, __ATOMIC_RELAXED); }
+
+    /*!
+     * @brief Receive and queue requests until the server is stopped or an error occurs.
+     *
+     * @return Error of the transport or the codec which stopped receiving.
+     */
+    virtual erpc_status_t run(void) override;
+
+    /*!
+     * @brief Receive and queue one request if there is any to receive.
+     *
+     * @return Error of the transport or the codec, #kErpcStatus_ServerIsDown when server is stopped.
+     */
+    virtual erpc_status_t poll(void) override;
+
+    /*!
+     * @brief Return whether poll() processes the received request before returning.
+     *
+     * @return False, requests are processed by worker threads.
+     */
+    virtual bool isSynchronous(void) const override { return false; }
+
+    /*!
+     * @brief Stop the server.
+     *
+     * Workers finish the queued requests and exit.
+     */
+    virtual void stop(void) override;
+
+protected:
+    /*!
+     * @brief Received request waiting for a worker.
+     */
+    struct Request
+    {
+        Codec *codec;           /*!< Codec holding the received message. */
+        message_type_t msgType; /*!< Type of received message. */
+        uint32_t serviceId;     /*!< To identify interface. */
+        uint32_t methodId;      /*!< To identify function in interface. */
+        uint32_t sequence;      /*!< To connect correct answer with correct request. */
+    };
+
+    //! @brief Queue of one priority level. StaticQueue keeps one slot free.
+    typedef StaticQueue<Request, ERPC_PRIORITY_QUEUE_SIZE + 1U> RequestQueue;
+
+    RequestQueue m_queues[ERPC_PRIORITY_LEVELS]; /*!< Waiting requests, index is the priority level. */
+    uint32_t m_overtaken[ERPC_PRIORITY_LEVELS];  /*!< How many times waiting requests of a level were overtaken. */
+    Mutex m_queuesMutex;                         /*!< Guards the queues and aging counters. */
+    Semaphore m_requestSem;                      /*!< Counts requests for workers serving all levels. */
+    Semaphore m_dedicatedSem;                    /*!< Counts requests for dedicated workers. */
+    Semaphore m_spaceSem;                        /*!< Signalled when a request leaves a queue. */
+    Semaphore m_exitSem;                         /*!< Signalled by each exiting worker. */
+    bool m_receiverWaiting;                      /*!< Receiver waits on m_spaceSem, guarded by m_queuesMutex. */
+
+    Thread m_workers[ERPC_PRIORITY_MAX_WORKERS]; /*!< Worker threads. */
+    uint32_t m_workersCount;                     /*!< Count of workers serving all levels. */
+    uint32_t m_dedicatedWorkersCount;            /*!< Count of workers serving the highest level only. */
+    bool m_workersStarted;                       /*!< Workers were started. */
+    uint32_t m_workerPriority;                   /*!< Priority of workers. */
+    uint32_t m_workerStackSize;                  /*!< Stack size of workers. */
+    uint32_t m_workerCpuMask;                    /*!< CPUs workers can run on. */
+
+    uint32_t m_admissionLimit; /*!< Maximum count of requests in server, zero for no limit. */
+    uint32_t m_inFlight;       /*!< Count of queued and processed requests. */
+    uint32_t m_busyCount;      /*!< Count of invocations refused with busy reply, accessed atomically. */
+    uint32_t m_droppedCount;   /*!< Count of dropped oneway messages, accessed atomically. */
+
+    /*!
+     * @brief Start worker threads if not started yet.
+     */
+    void startWorkers(void);
+
+    /*!
+     * @brief Receive one request and put it to the queue of its priority.
+     *
+     * Without admission limit blocks while the queue of the request's priority is full, otherwise refuses the
+     * request.
+     *
+     * @return Error of the transport or the codec.
+     */
+    erpc_status_t receiveRequest(void);
+
+    /*!
+     * @brief Refuse request without processing it.
+     *
+     * Invocation is answered with busy reply, oneway message is dropped.
+     *
+     * @param[in] request Request to refuse.
+     *
+     * @return Error of sending the busy reply.
+     */
+    erpc_status_t shedRequest(const Request &request);
+
+    /*!
+     * @brief Return priority level for invoked method.
+     *
+     * @param[in] serviceId To identify interface.
+     * @param[in] methodId To identify function in interface.
+     *
+     * @return Priority level clamped to #ERPC_PRIORITY_LEVELS.
+     */
+    uint32_t getPriorityLevel(uint32_t serviceId, uint32_t methodId);
+
+    /*!
+     * @brief Take next request to serve from the queues.
+     *
+     * Must be called with m_queuesMutex locked.
+     *
+     * @param[in] dedicated True when called by a dedicated worker.
+     * @param[out] request Taken request.
+     *
+     * @retval true Request was taken.
+     * @retval false No request is waiting.
+     */
+    bool takeRequest(bool dedicated, Request *request);
+
+    /*!
+     * @brief Worker loop.
+     *
+     * @param[in] dedicated True for worker serving only the highest priority level.
+     */
+    void workerLoop(bool dedicated);
+
+    /*!
+     * @brief Entry point of worker serving all levels.
+     *
+     * @param[in] arg Pointer to the server.
+     */
+    static void workerEntry(void *arg);
+
+    /*!
+     * @brief Entry point of worker serving the highest level only.
+     *
+     * @param[in] arg Pointer to the server.
+     */
+    static void dedicatedWorkerEntry(void *arg);
+
+private:
+    // Disable copy ctor.
+    PriorityServer(const PriorityServer &other);            /*!< Disable copy ctor. */
+    PriorityServer &operator=(const PriorityServer &other); /*!< Disable copy ctor. */
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__PRIORITY_SERVER_H_
@@ -10,6 +10,10 @@
 
 #include "erpc_server.hpp"
 
+#if ERPC_SERVER_METRICS
+#include "erpc_utils.hpp"
+#endif
+
 using namespace erpc;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +27,16 @@ bool nestingDetection = false;
 
 void Server::addService(Service *service)
 {
+#if ERPC_SERVICE_TABLE
+    uint32_t serviceId = service->getServiceId();
+
+    // First registered service with given ID is served, same as when walking the list.
+    if ((serviceId < kServiceTableSize) && (m_serviceTable[serviceId] == NULL))
+    {
+        m_serviceTable[serviceId] = service;
+    }
+#endif
+
     if (m_firstService == NULL)
     {
         m_firstService = service;
@@ -60,12 +74,28 @@ void Server::removeService(Service *service)
             link = link->getNext();
         }
     }
+
+#if ERPC_SERVICE_TABLE
+    uint32_t serviceId = service->getServiceId();
+
+    if ((serviceId < kServiceTableSize) && (m_serviceTable[serviceId] == service))
+    {
+        // Let another registered service with the same ID take over.
+        link = m_firstService;
+        while ((link != NULL) && (link->getServiceId() != serviceId))
+        {
+            link = link->getNext();
+        }
+        m_serviceTable[serviceId] = link;
+    }
+#endif
 }
 
 erpc_status_t Server::readHeadOfMessage(Codec *codec, message_type_t &msgType, uint32_t &serviceId, uint32_t &methodId,
                                         uint32_t &sequence)
 {
     codec->startReadMessage(msgType, serviceId, methodId, sequence);
+    ERPC_TRACE_POINT(kErpcTrace_Receive, serviceId, methodId, sequence, codec->getBufferRef().getUsed());
     return codec->getStatus();
 }
 
@@ -75,7 +105,8 @@ erpc_status_t Server::processMessage(Codec *codec, message_type_t msgType, uint3
     erpc_status_t err = kErpcStatus_Success;
     Service *service;
 
-    if ((msgType != message_type_t::kInvocationMessage) && (msgType != message_type_t::kOnewayMessage))
+    if ((msgType != message_type_t::kInvocationMessage) && (msgType != message_type_t::kOnewayMessage) &&
+        (msgType != message_type_t::kCreditedOnewayMessage))
     {
         err = kErpcStatus_InvalidArgument;
     }
@@ -91,7 +122,23 @@ erpc_status_t Server::processMessage(Codec *codec, message_type_t msgType, uint3
 
     if (err == kErpcStatus_Success)
     {
+#if ERPC_SERVER_METRICS
+        uint32_t startTime = getTimeUsecs();
+        uint32_t requestBytes = codec->getBufferRef().getUsed();
+        uint32_t replyBytes = 0;
+#endif
+
+        ERPC_TRACE_POINT(kErpcTrace_Dispatch, serviceId, methodId, sequence, 0);
         err = service->handleInvocation(methodId, sequence, codec, m_messageFactory, m_transport);
+
+#if ERPC_SERVER_METRICS
+        if ((err == kErpcStatus_Success) && (msgType == message_type_t::kInvocationMessage))
+        {
+            replyBytes = codec->getBufferRef().getUsed();
+        }
+        m_metrics.record(serviceId, methodId, (err != kErpcStatus_Success), requestBytes, replyBytes,
+                         getTimeUsecs() - startTime);
+#endif
     }
 
     return err;
@@ -99,15 +146,27 @@ erpc_status_t Server::processMessage(Codec *codec, message_type_t msgType, uint3
 
 Service *Server::findServiceWithId(uint32_t serviceId)
 {
-    Service *service = m_firstService;
-    while (service != NULL)
+    Service *service;
+
+#if ERPC_SERVICE_TABLE
+    if (serviceId < kServiceTableSize)
+    {
+        service = m_serviceTable[serviceId];
+    }
+    else
+#endif
     {
-        if (service->getServiceId() == serviceId)
+        service = m_firstService;
+        while (service != NULL)
         {
-            break;
-        }
+            if (service->getServiceId() == serviceId)
+            {
+                break;
+            }
 
-        service = service->getNext();
+            service = service->getNext();
+        }
     }
+
     return service;
 }
@@ -16,6 +16,10 @@
 #if ERPC_NESTED_CALLS
 #include "erpc_client_manager.h"
 #endif
+#if ERPC_SERVER_METRICS
+#include "erpc_server_metrics.hpp"
+#endif
+#include "erpc_trace.h"
 
 /*!
  * @addtogroup infra_server
@@ -85,6 +89,21 @@ public:
     virtual erpc_status_t handleInvocation(uint32_t methodId, uint32_t sequence, Codec *codec,
                                            MessageBufferFactory *messageFactory, Transport *transport) = 0;
 
+    /*!
+     * @brief Return scheduling priority of a method.
+     *
+     * Generated services return the value of the method's @priority annotation. Higher numbers are more urgent.
+     *
+     * @param[in] methodId Id number of function.
+     *
+     * @return Priority of the method, 0 by default.
+     */
+    virtual uint32_t getMethodPriority(uint32_t methodId) const
+    {
+        (void)methodId;
+        return 0;
+    }
+
 protected:
     uint32_t m_serviceId; /*!< Service unique id. */
     Service *m_next;      /*!< Pointer to next service. */
@@ -103,7 +122,18 @@ public:
      *
      * This function initializes object attributes.
      */
-    Server(void) : ClientServerCommon(), m_firstService(NULL) {}
+    Server(void) :
+    ClientServerCommon(), m_firstService(NULL)
+#if ERPC_SERVICE_TABLE
+    ,
+    m_serviceTable()
+#endif
+#if ERPC_SERVER_METRICS
+    ,
+    m_metrics()
+#endif
+    {
+    }
 
     /*!
      * @brief Server destructor
@@ -134,9 +164,29 @@ public:
      */
     virtual void stop(void) = 0;
 
+#if ERPC_SERVER_METRICS
+    /*!
+     * @brief Return per method counters of this server.
+     *
+     * @return Counters of processed requests.
+     */
+    ServerMetrics &getMetrics(void) { return m_metrics; }
+#endif
+
 protected:
     Service *m_firstService; /*!< Contains pointer to first service. */
 
+#if ERPC_SERVICE_TABLE
+    //! @brief Size of the service dispatch table. Service IDs are encoded on 8 bits.
+    static const uint32_t kServiceTableSize = 256U;
+
+    Service *m_serviceTable[kServiceTableSize]; /*!< Services indexed by their ID. */
+#endif
+
+#if ERPC_SERVER_METRICS
+    ServerMetrics m_metrics; /*!< Counters of processed requests. */
+#endif
+
     /*!
      * @brief Process message.
      *
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_server_metrics.hpp"
+
+#if ERPC_SERVER_METRICS
+
+#if ERPC_THREADS
+#include "erpc_threading.h"
+#endif
+
+#include <stddef.h>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+ServerMetrics::ServerMetrics(void) :
+m_index(), m_untracked(0), m_counters()
+{
+}
+
+void ServerMetrics::record(uint32_t serviceId, uint32_t methodId, bool failed, uint32_t requestBytes,
+                           uint32_t replyBytes, uint32_t usecs)
+{
+    uint32_t slot;
+
+    if (m_index.findSlot(serviceId, methodId, &slot))
+    {
+        Counters &counters = m_counters[getShard()][slot];
+
+        (void)__atomic_fetch_add(&counters.calls, 1U, __ATOMIC_RELAXED);
+        if (failed)
+        {
+            (void)__atomic_fetch_add(&counters.errors, 1U, __ATOMIC_RELAXED);
+        }
+        (void)__atomic_fetch_add(&counters.requestBytes, requestBytes, __ATOMIC_RELAXED);
+        (void)__atomic_fetch_add(&counters.replyBytes, replyBytes, __ATOMIC_RELAXED);
+        (void)__atomic_fetch_add(&counters.latency[getLatencyBucket(usecs)], 1U, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        (void)__atomic_fetch_add(&m_untracked, 1U, __ATOMIC_RELAXED);
+    }
+}
+
+bool ServerMetrics::getMethodStats(uint32_t index, MethodStats *stats) const
+{
+    uint32_t slot;
+    uint32_t shard;
+    uint32_t bucket;
+    bool found = m_index.getSlot(index, &slot, &stats->serviceId, &stats->methodId);
+
+    if (found)
+    {
+        stats->calls = 0;
+        stats->errors = 0;
+        stats->requestBytes = 0;
+        stats->replyBytes = 0;
+        for (bucket = 0; bucket < kLatencyBuckets; ++bucket)
+        {
+            stats->latency[bucket] = 0;
+        }
+
+        for (shard = 0; shard < ERPC_SERVER_METRICS_SHARDS; ++shard)
+        {
+            const Counters &counters = m_counters[shard][slot];
+
+            stats->calls += __atomic_load_n(&counters.calls, __ATOMIC_RELAXED);
+            stats->errors += __atomic_load_n(&counters.errors, __ATOMIC_RELAXED);
+            stats->requestBytes += __atomic_load_n(&counters.requestBytes, __ATOMIC_RELAXED);
+            stats->replyBytes += __atomic_load_n(&counters.replyBytes, __ATOMIC_RELAXED);
+            for (bucket = 0; bucket < kLatencyBuckets; ++bucket)
+            {
+                stats->latency[bucket] += __atomic_load_n(&counters.latency[bucket], __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+    return found;
+}
+
+void ServerMetrics::reset(void)
+{
+    uint32_t shard;
+    uint32_t slot;
+    uint32_t bucket;
+
+    for (shard = 0; shard < ERPC_SERVER_METRICS_SHARDS; ++shard)
+    {
+        for (slot = 0; slot < ERPC_SERVER_METRICS_METHODS; ++slot)
+        {
+            Counters &counters = m_counters[shard][slot];
+
+            __atomic_store_n(&counters.calls, 0U, __ATOMIC_RELAXED);
+            __atomic_store_n(&counters.errors, 0U, __ATOMIC_RELAXED);
+            __atomic_store_n(&counters.requestBytes, 0U, __ATOMIC_RELAXED);
+            __atomic_store_n(&counters.replyBytes, 0U, __ATOMIC_RELAXED);
+            for (bucket = 0; bucket < kLatencyBuckets; ++bucket)
+            {
+                __atomic_store_n(&counters.latency[bucket], 0U, __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+    __atomic_store_n(&m_untracked, 0U, __ATOMIC_RELAXED);
+}
+
+uint32_t ServerMetrics::getLatencyBucket(uint32_t usecs)
+{
+    uint32_t bucket = 0;
+    uint32_t limit = 16U;
+
+    while ((bucket < (kLatencyBuckets - 1U)) && (usecs >= limit))
+    {
+        ++bucket;
+        limit <<= 2;
+    }
+
+    return bucket;
+}
+
+uint32_t ServerMetrics::getShard(void)
+{
+#if ERPC_THREADS
+    uintptr_t thread = reinterpret_cast<uintptr_t>(Thread::getCurrentThreadId());
+
+    // Thread ids are mostly aligned addresses, take well mixed high bits of the hash.
+    return ((uint32_t)(thread >> 4) * 2654435761U >> 16) % ERPC_SERVER_METRICS_SHARDS;
+#else
+    return 0;
+#endif
+}
+
+#endif // ERPC_SERVER_METRICS
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__SERVER_METRICS_H_
+#define _EMBEDDED_RPC__SERVER_METRICS_H_
+
+#include "erpc_config_internal.h"
+#include "erpc_metrics_index.hpp"
+
+#include <stdint.h>
+
+/*!
+ * @addtogroup infra_server
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Per method counters of a server.
+ *
+ * Server records each processed request: count of calls and failed calls, size of request and reply messages and
+ * processing time in a histogram with fixed buckets. Bucket n counts calls shorter than 16 << (2 * n) microseconds
+ * (16 us, 64 us, ... 65.5 ms), the last bucket counts all slower calls.
+ *
+ * Recording does not lock. Methods are assigned slots on their first call by compare and swap, counters are kept in
+ * #ERPC_SERVER_METRICS_SHARDS copies selected by the calling thread and updated by relaxed atomic adds, so threads
+ * of one server do not share counters. Reading sums the copies. Counters are 32 bits and wrap around.
+ *
+ * @ingroup infra_server
+ */
+class ServerMetrics
+{
+public:
+    //! @brief Count of buckets of latency histogram.
+    static const uint32_t kLatencyBuckets = 8U;
+
+    //! @brief Counters of one method.
+    struct MethodStats
+    {
+        uint32_t serviceId;                 /*!< Service of the method. */
+        uint32_t methodId;                  /*!< Method id. */
+        uint32_t calls;                     /*!< Count of calls. */
+        uint32_t errors;                    /*!< Count of calls which failed in server. */
+        uint32_t requestBytes;              /*!< Total size of received requests. */
+        uint32_t replyBytes;                /*!< Total size of sent replies. */
+        uint32_t latency[kLatencyBuckets];  /*!< Histogram of processing time. */
+    };
+
+    /*!
+     * @brief Constructor.
+     */
+    ServerMetrics(void);
+
+    /*!
+     * @brief Record one processed request.
+     *
+     * @param[in] serviceId Service of the invoked method.
+     * @param[in] methodId Invoked method.
+     * @param[in] failed True when processing failed.
+     * @param[in] requestBytes Size of request message.
+     * @param[in] replyBytes Size of reply message, zero for oneway messages.
+     * @param[in] usecs Processing time in microseconds.
+     */
+    void record(uint32_t serviceId, uint32_t methodId, bool failed, uint32_t requestBytes, uint32_t replyBytes,
+                uint32_t usecs);
+
+    /*!
+     * @brief Return count of methods with counters.
+     *
+     * @return Count of methods which were called at least once since construction.
+     */
+    uint32_t getMethodCount(void) const { return m_index.getCount(); }
+
+    /*!
+     * @brief Read counters of one method.
+     *
+     * Methods keep their index, new methods get higher indexes.
+     *
+     * @param[in] index Index of method, lower than getMethodCount().
+     * @param[out] stats Counters of the method.
+     *
+     * @retval true Counters were read.
+     * @retval false Index is out of range.
+     */
+    bool getMethodStats(uint32_t index, MethodStats *stats) const;
+
+    /*!
+     * @brief Return count of calls not recorded because all #ERPC_SERVER_METRICS_METHODS slots are taken.
+     *
+     * @return Count of unrecorded calls.
+     */
+    uint32_t getUntrackedCount(void) const { return __atomic_load_n(&m_untracked, __ATOMIC_RELAXED); }
+
+    /*!
+     * @brief Zero all counters.
+     *
+     * Methods keep their slots. Calls recorded concurrently may be partially lost.
+     */
+    void reset(void);
+
+    /*!
+     * @brief Return histogram bucket for processing time.
+     *
+     * @param[in] usecs Processing time in microseconds.
+     *
+     * @return Index of bucket.
+     */
+    static uint32_t getLatencyBucket(uint32_t usecs);
+
+protected:
+    //! @brief Counters of one method in one shard.
+    struct Counters
+    {
+        uint32_t calls;                    /*!< Count of calls. */
+        uint32_t errors;                   /*!< Count of failed calls. */
+        uint32_t requestBytes;             /*!< Total size of requests. */
+        uint32_t replyBytes;               /*!< Total size of replies. */
+        uint32_t latency[kLatencyBuckets]; /*!< Histogram of processing time. */
+    };
+
+    MetricsIndex<ERPC_SERVER_METRICS_METHODS> m_index; /*!< Slots of methods. */
+    uint32_t m_untracked;                              /*!< Count of calls without slot. */
+    Counters m_counters[ERPC_SERVER_METRICS_SHARDS][ERPC_SERVER_METRICS_METHODS]; /*!< Counters by shard and slot. */
+
+    /*!
+     * @brief Return shard of the calling thread.
+     *
+     * @return Index of shard.
+     */
+    static uint32_t getShard(void);
+};
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__SERVER_METRICS_H_
@@ -15,7 +15,14 @@ using namespace erpc;
 ////////////////////////////////////////////////////////////////////////////////
 // Code
 ////////////////////////////////////////////////////////////////////////////////
-SimpleServer::SimpleServer(void) : m_isServerOn(true) {}
+SimpleServer::SimpleServer(void) :
+m_isServerOn(true)
+#if ERPC_ONEWAY_CREDITS
+,
+m_onewayProcessed(0U)
+#endif
+{
+}
 
 SimpleServer::~SimpleServer(void) {}
 
@@ -152,13 +159,14 @@ erpc_status_t SimpleServer::runInternalEnd(Codec *codec, message_type_t msgType,
 
     if (err == kErpcStatus_Success)
     {
-        if (msgType != message_type_t::kOnewayMessage)
+        if (msgType == message_type_t::kInvocationMessage)
         {
 #if ERPC_MESSAGE_LOGGING
-            err = logMessage(codec->getBuffer());
+            err = logMessage(&codec->getBufferRef());
             if (err == kErpcStatus_Success)
             {
 #endif
+                ERPC_TRACE_POINT(kErpcTrace_Reply, serviceId, methodId, sequence, codec->getBufferRef().getUsed());
                 err = m_transport->send(&codec->getBufferRef());
 #if ERPC_MESSAGE_LOGGING
             }
@@ -174,6 +182,18 @@ erpc_status_t SimpleServer::runInternalEnd(Codec *codec, message_type_t msgType,
 #endif
     }
 
+#if ERPC_ONEWAY_CREDITS
+    // Clients without credits never read credit messages, they would fill the connection.
+    if (msgType == message_type_t::kCreditedOnewayMessage)
+    {
+        erpc_status_t creditErr = returnOnewayCredit(codec, serviceId, methodId);
+        if (err == kErpcStatus_Success)
+        {
+            err = creditErr;
+        }
+    }
+#endif
+
     // Dispose of buffers and codecs.
     disposeBufferAndCodec(codec);
 
@@ -202,7 +222,7 @@ erpc_status_t SimpleServer::run(RequestContext &request)
             break;
         }
 
-        if (msgType == message_type_t::kReplyMessage)
+        if ((msgType == message_type_t::kReplyMessage) || (msgType == message_type_t::kBusyMessage))
         {
             if (sequence == request.getSequence())
             {
@@ -231,6 +251,45 @@ erpc_status_t SimpleServer::run(RequestContext &request)
 }
 #endif
 
+#if ERPC_ONEWAY_CREDITS
+erpc_status_t SimpleServer::returnOnewayCredit(Codec *codec, uint32_t serviceId, uint32_t methodId)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    uint32_t credit = 0U;
+
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_creditMutex);
+#endif
+        ++m_onewayProcessed;
+        if (m_onewayProcessed >= ((ERPC_ONEWAY_CREDITS + 1U) / 2U))
+        {
+            credit = m_onewayProcessed;
+            m_onewayProcessed = 0U;
+        }
+    }
+
+    if (credit > 0U)
+    {
+        err = m_messageFactory->prepareServerBufferForSend(codec->getBufferRef(), m_transport->reserveHeaderSize());
+        if (err == kErpcStatus_Success)
+        {
+            codec->reset(m_transport->reserveHeaderSize());
+            codec->startWriteMessage(message_type_t::kCreditMessage, serviceId, methodId, 0U);
+            codec->write(credit);
+            err = codec->getStatus();
+        }
+
+        if (err == kErpcStatus_Success)
+        {
+            err = m_transport->send(&codec->getBufferRef());
+        }
+    }
+
+    return err;
+}
+#endif
+
 void SimpleServer::disposeBufferAndCodec(Codec *codec)
 {
     if (codec != NULL)
@@ -13,6 +13,10 @@
 
 #include "erpc_server.hpp"
 
+#if ERPC_ONEWAY_CREDITS && !ERPC_THREADS_IS(NONE)
+#include "erpc_threading.h"
+#endif
+
 /*!
  * @addtogroup infra_server
  * @{
@@ -27,6 +31,10 @@ namespace erpc {
 /*!
  * @brief Based server implementation.
  *
+ * Requests are processed synchronously, one at a time, and never refused. This server never sends
+ * message_type_t::kBusyMessage, so its clients do not get #kErpcStatus_Busy; use PriorityServer with an admission limit
+ * to shed load.
+ *
  * @ingroup infra_server
  */
 class SimpleServer : public Server
@@ -59,6 +67,13 @@ public:
      */
     virtual erpc_status_t poll(void);
 
+    /*!
+     * @brief Return whether poll() processes the received request before returning.
+     *
+     * @return True for this server, false for servers processing requests on their own threads.
+     */
+    virtual bool isSynchronous(void) const { return true; }
+
     /*!
      * @brief This function sets server from ON to OFF
      */
@@ -66,6 +81,26 @@ public:
 
 protected:
     bool m_isServerOn; /*!< Information if server is ON or OFF. */
+#if ERPC_ONEWAY_CREDITS
+    uint32_t m_onewayProcessed; /*!< Count of oneway messages processed since credit was last returned. */
+#if !ERPC_THREADS_IS(NONE)
+    Mutex m_creditMutex; /*!< Guards count of processed oneway messages. */
+#endif
+
+    /*!
+     * @brief Return credit of processed oneway message to client.
+     *
+     * Called for oneway messages of clients waiting for credit (message_type_t::kCreditedOnewayMessage) only. Credit
+     * message is sent after each half of the credit window is processed. It is written to buffer of the oneway message.
+     *
+     * @param[in] codec Codec holding processed oneway message.
+     * @param[in] serviceId To identify interface.
+     * @param[in] methodId To identify function in interface.
+     *
+     * @return Error of sending credit message.
+     */
+    erpc_status_t returnOnewayCredit(Codec *codec, uint32_t serviceId, uint32_t methodId);
+#endif
 
     /*!
      * @brief Run server implementation.
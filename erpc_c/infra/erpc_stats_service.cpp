@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_stats_service.hpp"
+
+#if ERPC_SERVER_METRICS
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_status_t StatsService::handleInvocation(uint32_t methodId, uint32_t sequence, Codec *codec,
+                                             MessageBufferFactory *messageFactory, Transport *transport)
+{
+    erpc_status_t err;
+
+    // startReadMessage() was already called before this shim was invoked.
+    switch (methodId)
+    {
+        case kGetMethodCountId:
+        {
+            err = startReply(methodId, sequence, codec, messageFactory, transport);
+            if (err == kErpcStatus_Success)
+            {
+                codec->write(m_metrics->getMethodCount());
+                err = codec->getStatus();
+            }
+            break;
+        }
+
+        case kGetMethodStatsId:
+        {
+            err = getMethodStats_shim(sequence, codec, messageFactory, transport);
+            break;
+        }
+
+        case kGetUntrackedCountId:
+        {
+            err = startReply(methodId, sequence, codec, messageFactory, transport);
+            if (err == kErpcStatus_Success)
+            {
+                codec->write(m_metrics->getUntrackedCount());
+                err = codec->getStatus();
+            }
+            break;
+        }
+
+        case kResetId:
+        {
+            m_metrics->reset();
+            err = startReply(methodId, sequence, codec, messageFactory, transport);
+            break;
+        }
+
+        default:
+        {
+            err = kErpcStatus_InvalidArgument;
+            break;
+        }
+    }
+
+    return err;
+}
+
+erpc_status_t StatsService::startReply(uint32_t methodId, uint32_t sequence, Codec *codec,
+                                       MessageBufferFactory *messageFactory, Transport *transport)
+{
+    // preparing MessageBuffer for serializing data
+    erpc_status_t err = messageFactory->prepareServerBufferForSend(codec->getBufferRef(), transport->reserveHeaderSize());
+
+    if (err == kErpcStatus_Success)
+    {
+        // preparing codec for serializing data
+        codec->reset(transport->reserveHeaderSize());
+
+        // Build response message.
+        codec->startWriteMessage(message_type_t::kReplyMessage, kServiceId, methodId, sequence);
+        err = codec->getStatus();
+    }
+
+    return err;
+}
+
+erpc_status_t StatsService::getMethodStats_shim(uint32_t sequence, Codec *codec, MessageBufferFactory *messageFactory,
+                                                Transport *transport)
+{
+    erpc_status_t err;
+    uint32_t index;
+    ServerMetrics::MethodStats stats = {};
+    bool result = false;
+
+    codec->read(index);
+
+    err = codec->getStatus();
+    if (err == kErpcStatus_Success)
+    {
+        result = m_metrics->getMethodStats(index, &stats);
+
+        err = startReply(kGetMethodStatsId, sequence, codec, messageFactory, transport);
+    }
+
+    if (err == kErpcStatus_Success)
+    {
+        // Fields in order of eRPCMethodStats structure, then the return value.
+        codec->write(stats.serviceId);
+        codec->write(stats.methodId);
+        codec->write(stats.calls);
+        codec->write(stats.errors);
+        codec->write(stats.requestBytes);
+        codec->write(stats.replyBytes);
+        for (uint32_t bucket = 0U; bucket < ServerMetrics::kLatencyBuckets; ++bucket)
+        {
+            codec->write(stats.latency[bucket]);
+        }
+        codec->write(result);
+
+        err = codec->getStatus();
+    }
+
+    return err;
+}
+
+#endif // ERPC_SERVER_METRICS
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__STATS_SERVICE_H_
+#define _EMBEDDED_RPC__STATS_SERVICE_H_
+
+#include "erpc_server.hpp"
+#include "erpc_server_metrics.hpp"
+
+/*!
+ * @addtogroup infra_server
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Built-in service giving remote clients per method counters of a server.
+ *
+ * Server side of the eRPCStats interface described in erpc_stats.erpc, from which clients are generated by erpcgen.
+ * Its calls are counted like calls of other services.
+ *
+ * @ingroup infra_server
+ */
+class StatsService : public Service
+{
+public:
+    //! @brief Service id of eRPCStats interface.
+    static const uint32_t kServiceId = 255U;
+
+    //! @brief Method ids of eRPCStats interface.
+    enum method_id_t
+    {
+        kGetMethodCountId = 1U,
+        kGetMethodStatsId = 2U,
+        kGetUntrackedCountId = 3U,
+        kResetId = 4U,
+    };
+
+    /*!
+     * @brief Constructor.
+     *
+     * @param[in] metrics Counters served by this service.
+     */
+    StatsService(ServerMetrics *metrics) : Service(kServiceId), m_metrics(metrics) {}
+
+    /*!
+     * @brief Destructor.
+     */
+    virtual ~StatsService(void) {}
+
+    /*!
+     * @brief Return served counters.
+     *
+     * @return Served counters.
+     */
+    ServerMetrics *getMetrics(void) { return m_metrics; }
+
+    /*!
+     * @brief Call the correct server shim based on method unique ID.
+     *
+     * @param[in] methodId Id number of function, which is requested.
+     * @param[in] sequence Sequence number. To be sure that reply from server belongs to client request.
+     * @param[in] codec For reading and writing data.
+     * @param[in] messageFactory Used for setting output buffer.
+     * @param[in] transport Transport to reserve header for.
+     *
+     * @return Status of reading request and writing reply.
+     */
+    virtual erpc_status_t handleInvocation(uint32_t methodId, uint32_t sequence, Codec *codec,
+                                           MessageBufferFactory *messageFactory, Transport *transport) override;
+
+protected:
+    ServerMetrics *m_metrics; /*!< Served counters. */
+
+    /*!
+     * @brief Prepare codec for writing reply.
+     *
+     * @param[in] methodId Id of answered method.
+     * @param[in] sequence Sequence number of the request.
+     * @param[in] codec Codec holding the request.
+     * @param[in] messageFactory Used for setting output buffer.
+     * @param[in] transport Transport to reserve header for.
+     *
+     * @return Status of preparing the buffer.
+     */
+    erpc_status_t startReply(uint32_t methodId, uint32_t sequence, Codec *codec, MessageBufferFactory *messageFactory,
+                             Transport *transport);
+
+    /*!
+     * @brief Server shim for getMethodStats.
+     *
+     * @param[in] sequence Sequence number of the request.
+     * @param[in] codec Codec holding the request.
+     * @param[in] messageFactory Used for setting output buffer.
+     * @param[in] transport Transport to reserve header for.
+     *
+     * @return Status of reading request and writing reply.
+     */
+    erpc_status_t getMethodStats_shim(uint32_t sequence, Codec *codec, MessageBufferFactory *messageFactory,
+                                      Transport *transport);
+};
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__STATS_SERVICE_H_
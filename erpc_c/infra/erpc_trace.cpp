@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_trace.h"
+
+#if ERPC_TRACE
+
+#if ERPC_THREADS
+#include "erpc_manually_constructed.hpp"
+#include "erpc_threading.h"
+#if ERPC_THREADS_IS(PTHREADS)
+#include <pthread.h>
+#endif
+#endif
+
+#include <stddef.h>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#if (ERPC_TRACE_BUFFER_SIZE & (ERPC_TRACE_BUFFER_SIZE - 1U)) != 0U
+#error "ERPC_TRACE_BUFFER_SIZE must be power of two."
+#endif
+
+#if ERPC_THREADS
+#define TRACE_RING_COUNT ERPC_TRACE_THREADS
+#else
+#define TRACE_RING_COUNT 1U
+#endif
+
+namespace {
+//! @brief Assumed size of cache line, written indexes of a ring are kept on separate lines.
+const uint32_t kCacheLineSize = 64U;
+
+/*!
+ * @brief Ring of one thread.
+ *
+ * Only the owning thread writes records and moves head, only the draining thread moves tail.
+ */
+struct TraceRing
+{
+    uint32_t head;                                         /*!< Count of written records. */
+    uint32_t cachedTail;                                   /*!< Tail last seen by owner, read again when ring looks full. */
+    uint8_t headPadding[kCacheLineSize - 8U];              /*!< Keeps tail off the line of head. */
+    uint32_t tail;                                         /*!< Count of drained records. */
+    uint8_t tailPadding[kCacheLineSize - 4U];              /*!< Keeps records off the line of tail. */
+    erpc_trace_record_t records[ERPC_TRACE_BUFFER_SIZE];   /*!< Records. */
+};
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+static TraceRing s_rings[TRACE_RING_COUNT];
+#if ERPC_THREADS
+static void *s_owners[TRACE_RING_COUNT]; // Thread owning the ring, NULL when free. Rarely written.
+#if ERPC_THREADS_IS(PTHREADS)
+static pthread_once_t s_ownerKeyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t s_ownerKey; // Set in threads owning a ring, its destructor releases the ring.
+#endif
+#endif
+static uint32_t s_dropped = 0;
+static uint32_t s_draining = 0;
+
+#if ERPC_THREADS
+static Thread s_drainThread("erpc_trace");
+ERPC_MANUALLY_CONSTRUCTED(Semaphore, s_wakeSem);
+ERPC_MANUALLY_CONSTRUCTED(Semaphore, s_exitSem);
+static erpc_trace_sink_t s_sink = NULL;
+static void *s_sinkContext = NULL;
+static uint32_t s_periodUsecs = 0;
+static bool s_running = false;
+static bool s_stopping = false;
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+#if ERPC_THREADS_IS(PTHREADS)
+/*!
+ * @brief Release ring of exiting thread.
+ *
+ * @param[in] value Not used.
+ */
+static void ownerKeyDestructor(void *value)
+{
+    (void)value;
+    erpc_trace_thread_exit();
+}
+
+/*!
+ * @brief Create key releasing rings of exiting threads.
+ */
+static void createOwnerKey(void)
+{
+    (void)pthread_key_create(&s_ownerKey, ownerKeyDestructor);
+}
+#endif
+
+/*!
+ * @brief Return index of ring owned by calling thread, take free ring on first call.
+ *
+ * @return Index of ring, TRACE_RING_COUNT when all rings are taken.
+ */
+static uint32_t getRingIndex(void)
+{
+#if ERPC_THREADS
+    void *self = Thread::getCurrentThreadId();
+    void *expected;
+    uint32_t index;
+
+    for (index = 0; index < TRACE_RING_COUNT; ++index)
+    {
+        if (__atomic_load_n(&s_owners[index], __ATOMIC_RELAXED) == self)
+        {
+            return index;
+        }
+    }
+
+    for (index = 0; index < TRACE_RING_COUNT; ++index)
+    {
+        expected = NULL;
+        if (__atomic_compare_exchange_n(&s_owners[index], &expected, self, false, __ATOMIC_ACQ_REL,
+                                        __ATOMIC_RELAXED))
+        {
+#if ERPC_THREADS_IS(PTHREADS)
+            // Any thread can record, not only erpc::Thread, so the ring is released by thread local destructor.
+            (void)pthread_once(&s_ownerKeyOnce, createOwnerKey);
+            (void)pthread_setspecific(s_ownerKey, &s_rings[index]);
+#endif
+            return index;
+        }
+    }
+
+    return TRACE_RING_COUNT;
+#else
+    return 0;
+#endif
+}
+
+void erpc_trace_record(erpc_trace_event_t event, uint32_t serviceId, uint32_t methodId, uint32_t sequence,
+                       uint32_t length, uint32_t timestamp)
+{
+    uint32_t index = getRingIndex();
+    TraceRing *ring;
+    erpc_trace_record_t *record;
+    uint32_t head;
+
+    if (index < TRACE_RING_COUNT)
+    {
+        ring = &s_rings[index];
+        head = ring->head;
+        if ((head - ring->cachedTail) >= ERPC_TRACE_BUFFER_SIZE)
+        {
+            ring->cachedTail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        }
+        if ((head - ring->cachedTail) < ERPC_TRACE_BUFFER_SIZE)
+        {
+            record = &ring->records[head & (ERPC_TRACE_BUFFER_SIZE - 1U)];
+            record->timestamp = timestamp;
+            record->sequence = sequence;
+            record->length = (length > 0xffffU) ? 0xffffU : static_cast<uint16_t>(length);
+            record->event = static_cast<uint8_t>(event);
+            record->serviceId = static_cast<uint8_t>(serviceId);
+            record->methodId = static_cast<uint8_t>(methodId);
+            record->thread = static_cast<uint8_t>(index);
+            record->reserved = 0;
+            __atomic_store_n(&ring->head, head + 1U, __ATOMIC_RELEASE);
+            return;
+        }
+    }
+
+    (void)__atomic_fetch_add(&s_dropped, 1U, __ATOMIC_RELAXED);
+}
+
+uint32_t erpc_trace_drain(erpc_trace_sink_t sink, void *context)
+{
+    uint32_t drained = 0;
+    uint32_t expected = 0;
+    uint32_t index;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t offset;
+    uint32_t count;
+    TraceRing *ring;
+
+    if (!__atomic_compare_exchange_n(&s_draining, &expected, 1U, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+    {
+        return 0;
+    }
+
+    for (index = 0; index < TRACE_RING_COUNT; ++index)
+    {
+        ring = &s_rings[index];
+        tail = ring->tail;
+        head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        while (tail != head)
+        {
+            // Pass records up to the end of the ring at once, the rest in next round.
+            offset = tail & (ERPC_TRACE_BUFFER_SIZE - 1U);
+            count = head - tail;
+            if (count > (ERPC_TRACE_BUFFER_SIZE - offset))
+            {
+                count = ERPC_TRACE_BUFFER_SIZE - offset;
+            }
+            if (sink != NULL)
+            {
+                sink(&ring->records[offset], count, context);
+            }
+            tail += count;
+            drained += count;
+            __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+        }
+    }
+
+    __atomic_store_n(&s_draining, 0U, __ATOMIC_RELEASE);
+
+    return drained;
+}
+
+uint32_t erpc_trace_get_dropped(void)
+{
+    return __atomic_load_n(&s_dropped, __ATOMIC_RELAXED);
+}
+
+void erpc_trace_thread_exit(void)
+{
+#if ERPC_THREADS
+    void *self = Thread::getCurrentThreadId();
+    void *expected;
+    uint32_t index;
+
+    for (index = 0; index < TRACE_RING_COUNT; ++index)
+    {
+        // Records stay in the ring until drained, next owner continues after them.
+        expected = self;
+        if (__atomic_compare_exchange_n(&s_owners[index], &expected, NULL, false, __ATOMIC_RELEASE,
+                                        __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
+#endif
+}
+
+#if ERPC_THREADS
+/*!
+ * @brief Entry point of draining thread.
+ *
+ * @param[in] arg Not used.
+ */
+static void drainThreadEntry(void *arg)
+{
+    (void)arg;
+
+    while (!__atomic_load_n(&s_stopping, __ATOMIC_ACQUIRE))
+    {
+        (void)erpc_trace_drain(s_sink, s_sinkContext);
+        (void)s_wakeSem->get(s_periodUsecs);
+    }
+    (void)erpc_trace_drain(s_sink, s_sinkContext);
+
+    s_exitSem->put();
+}
+
+bool erpc_trace_start(erpc_trace_sink_t sink, void *context, uint32_t periodMs, uint32_t stackSize)
+{
+    if (s_running)
+    {
+        return false;
+    }
+
+    if (s_wakeSem.get() == NULL)
+    {
+        s_wakeSem.construct(0);
+        s_exitSem.construct(0);
+    }
+
+    s_sink = sink;
+    s_sinkContext = context;
+    s_periodUsecs = ((periodMs == 0U) ? 1U : periodMs) * 1000U;
+    s_stopping = false;
+    s_running = true;
+    s_drainThread.init(drainThreadEntry, 0, stackSize);
+    s_drainThread.start(NULL);
+
+    return true;
+}
+
+void erpc_trace_stop(void)
+{
+    if (s_running)
+    {
+        __atomic_store_n(&s_stopping, true, __ATOMIC_RELEASE);
+        s_wakeSem->put();
+        (void)s_exitSem->get();
+        s_running = false;
+    }
+}
+#endif // ERPC_THREADS
+
+#endif // ERPC_TRACE
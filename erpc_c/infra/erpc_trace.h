@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__TRACE_H_
+#define _EMBEDDED_RPC__TRACE_H_
+
+#include "erpc_config_internal.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*!
+ * @addtogroup infra_utility
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//! @brief Trace points of eRPC calls.
+typedef enum erpc_trace_event
+{
+    kErpcTrace_RequestCreate = 0, /*!< Client created request (codec and buffer). */
+    kErpcTrace_EncodeDone,        /*!< Client finished encoding of request. */
+    kErpcTrace_Send,              /*!< Client passes request to transport. */
+    kErpcTrace_Receive,           /*!< Server received request. */
+    kErpcTrace_Dispatch,          /*!< Server found service of request. */
+    kErpcTrace_HandlerStart,      /*!< Server shim calls user implementation. */
+    kErpcTrace_HandlerEnd,        /*!< User implementation returned. */
+    kErpcTrace_Reply,             /*!< Server passes reply to transport. */
+    kErpcTrace_ReplyReceived      /*!< Client received and verified reply. */
+} erpc_trace_event_t;
+
+//! @brief One trace record.
+typedef struct erpc_trace_record
+{
+    uint32_t timestamp; /*!< Monotonic time in microseconds, wraps around. */
+    uint32_t sequence;  /*!< Sequence number of the request. */
+    uint16_t length;    /*!< Size of message in bytes, zero when no message is involved. */
+    uint8_t event;      /*!< Trace point, one of #erpc_trace_event_t. */
+    uint8_t serviceId;  /*!< Service id, zero when not known yet. */
+    uint8_t methodId;   /*!< Method id, zero when not known yet. */
+    uint8_t thread;     /*!< Index of recording thread, stable while the thread lives, reused after it exits. */
+    uint16_t reserved;  /*!< Reserved. */
+} erpc_trace_record_t;
+
+/*!
+ * @brief Receiver of drained trace records.
+ *
+ * Records written to a file as they are passed here, one file per process, can be converted to Chrome JSON trace by
+ * erpcsniffer -T.
+ *
+ * @param[in] records Records of one thread in order of recording.
+ * @param[in] count Count of records.
+ * @param[in] context Context given when draining.
+ */
+typedef void (*erpc_trace_sink_t)(const erpc_trace_record_t *records, uint32_t count, void *context);
+
+#if ERPC_TRACE
+/*!
+ * @brief Record trace point to ring of calling thread. Does not block.
+ *
+ * Record is dropped when the ring is full or all #ERPC_TRACE_THREADS rings are taken by other threads. A thread takes
+ * a ring on its first record and keeps it until erpc_trace_thread_exit().
+ *
+ * @param[in] event Trace point.
+ * @param[in] serviceId Service id.
+ * @param[in] methodId Method id.
+ * @param[in] sequence Sequence number.
+ * @param[in] length Size of message.
+ * @param[in] timestamp Time of the event from erpc::getTimeUsecs().
+ */
+void erpc_trace_record(erpc_trace_event_t event, uint32_t serviceId, uint32_t methodId, uint32_t sequence,
+                       uint32_t length, uint32_t timestamp);
+
+/*!
+ * @brief Pass all recorded records to sink and free them.
+ *
+ * Only one thread drains at a time, concurrent calls return zero.
+ *
+ * @param[in] sink Receiver of records.
+ * @param[in] context Passed to sink.
+ *
+ * @return Count of drained records.
+ */
+uint32_t erpc_trace_drain(erpc_trace_sink_t sink, void *context);
+
+/*!
+ * @brief Release ring of calling thread, so other threads can record.
+ *
+ * Records not drained yet stay in the ring. eRPC threads call it when their entry function returns. With pthreads it
+ * is also called when any thread which recorded exits. Other threads call it before exiting, otherwise their ring
+ * stays taken. Does nothing when the thread has no ring.
+ */
+void erpc_trace_thread_exit(void);
+
+/*!
+ * @brief Return count of records dropped since start.
+ *
+ * @return Count of dropped records.
+ */
+uint32_t erpc_trace_get_dropped(void);
+
+#if ERPC_THREADS
+/*!
+ * @brief Start thread draining trace records periodically.
+ *
+ * @param[in] sink Receiver of records, called from the draining thread.
+ * @param[in] context Passed to sink.
+ * @param[in] periodMs Time between drains in milliseconds.
+ * @param[in] stackSize Stack size of the thread, zero for default.
+ *
+ * @retval true Thread was started.
+ * @retval false Thread is already running.
+ */
+bool erpc_trace_start(erpc_trace_sink_t sink, void *context, uint32_t periodMs, uint32_t stackSize);
+
+/*!
+ * @brief Stop draining thread. Remaining records are drained before it exits.
+ */
+void erpc_trace_stop(void);
+#endif
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#if ERPC_TRACE
+#ifdef __cplusplus
+#include "erpc_utils.hpp"
+
+//! @brief Record trace point, removed when ERPC_TRACE is disabled.
+#define ERPC_TRACE_POINT(event, serviceId, methodId, sequence, length) \
+    erpc_trace_record((event), (serviceId), (methodId), (sequence), (length), erpc::getTimeUsecs())
+#endif
+#else
+#define ERPC_TRACE_POINT(event, serviceId, methodId, sequence, length)
+#endif
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__TRACE_H_
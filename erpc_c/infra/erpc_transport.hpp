@@ -11,8 +11,10 @@
 #define _EMBEDDED_RPC__TRANSPORT_H_
 
 #include "erpc_common.h"
+#include "erpc_config_internal.h"
 #include "erpc_crc16.hpp"
 #include "erpc_message_buffer.hpp"
+#include "erpc_transport_stats.h"
 
 #include <cstring>
 
@@ -39,7 +41,12 @@ public:
     /*!
      * @brief Constructor.
      */
-    Transport(void) {}
+    Transport(void)
+    {
+#if ERPC_TRANSPORT_STATS
+        (void)memset(&m_stats, 0, sizeof(m_stats));
+#endif
+    }
 
     /*!
      * @brief Transport destructor
@@ -99,6 +106,119 @@ public:
      * @return Crc16* Pointer to CRC-16 object containing crc-16 compute function.
      */
     virtual Crc16 *getCrc16(void) { return NULL; }
+
+#if ERPC_TRANSPORT_STATS
+    /*!
+     * @brief Copy counters of the transport.
+     *
+     * Counters are updated independently, the copy is not a snapshot of one moment.
+     *
+     * @param[out] stats Filled with current counters.
+     */
+    void getStats(erpc_transport_stats_t *stats) const
+    {
+        const uint32_t *counters = reinterpret_cast<const uint32_t *>(&m_stats);
+        uint32_t *copy = reinterpret_cast<uint32_t *>(stats);
+
+        for (uint32_t i = 0; i < (sizeof(m_stats) / sizeof(uint32_t)); ++i)
+        {
+            copy[i] = __atomic_load_n(&counters[i], __ATOMIC_RELAXED);
+        }
+    }
+
+    /*!
+     * @brief Set all counters of the transport to zero.
+     */
+    void resetStats(void)
+    {
+        uint32_t *counters = reinterpret_cast<uint32_t *>(&m_stats);
+
+        for (uint32_t i = 0; i < (sizeof(m_stats) / sizeof(uint32_t)); ++i)
+        {
+            __atomic_store_n(&counters[i], 0U, __ATOMIC_RELAXED);
+        }
+    }
+#endif
+
+protected:
+#if ERPC_TRANSPORT_STATS
+    erpc_transport_stats_t m_stats; /*!< Counters of the transport. */
+#endif
+
+    /*!
+     * @brief Add to one counter. Does nothing when #ERPC_TRANSPORT_STATS is disabled.
+     *
+     * @param[in] counter Counter to update, e.g. &erpc_transport_stats_t::syscalls.
+     * @param[in] value Value to add.
+     */
+    void countStat(uint32_t erpc_transport_stats_t::*counter, uint32_t value = 1U)
+    {
+#if ERPC_TRANSPORT_STATS
+        (void)__atomic_fetch_add(&(m_stats.*counter), value, __ATOMIC_RELAXED);
+#else
+        (void)counter;
+        (void)value;
+#endif
+    }
+
+    /*!
+     * @brief Count result of sending one message.
+     *
+     * @param[in] status Result of the send.
+     * @param[in] size Size of the message including frame header.
+     */
+    void countSend(erpc_status_t status, uint32_t size)
+    {
+        if (status == kErpcStatus_Success)
+        {
+            countStat(&erpc_transport_stats_t::messagesSent);
+            countStat(&erpc_transport_stats_t::bytesSent, size);
+            countFrameSize(size);
+        }
+        else
+        {
+            countStat(&erpc_transport_stats_t::sendErrors);
+        }
+    }
+
+    /*!
+     * @brief Count result of receiving one message.
+     *
+     * @param[in] status Result of the receive.
+     * @param[in] size Size of the message including frame header.
+     */
+    void countReceive(erpc_status_t status, uint32_t size)
+    {
+        if (status == kErpcStatus_Success)
+        {
+            countStat(&erpc_transport_stats_t::messagesReceived);
+            countStat(&erpc_transport_stats_t::bytesReceived, size);
+            countFrameSize(size);
+        }
+        else
+        {
+            countStat(&erpc_transport_stats_t::receiveErrors);
+        }
+    }
+
+    /*!
+     * @brief Raise maximum frame size if the frame is bigger.
+     *
+     * @param[in] size Size of the frame.
+     */
+    void countFrameSize(uint32_t size)
+    {
+#if ERPC_TRANSPORT_STATS
+        uint32_t max = __atomic_load_n(&m_stats.maxFrameSize, __ATOMIC_RELAXED);
+
+        while ((size > max) && !__atomic_compare_exchange_n(&m_stats.maxFrameSize, &max, size, true,
+                                                             __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+        }
+#else
+        (void)size;
+#endif
+    }
 };
 
 /*!
@@ -25,11 +25,10 @@ using namespace erpc;
 // Code
 ////////////////////////////////////////////////////////////////////////////////
 
-ERPC_MANUALLY_CONSTRUCTED_ARRAY_STATIC(TransportArbitrator::PendingClientInfo, s_pendingClientInfoArray,
-                                       ERPC_CLIENTS_THREADS_AMOUNT);
+ERPC_STATIC_OBJECT_POOL(TransportArbitrator::PendingClientInfo, s_pendingClientInfoPool, ERPC_CLIENTS_THREADS_AMOUNT);
 
 TransportArbitrator::TransportArbitrator(void) :
-Transport(), m_sharedTransport(NULL), m_codec(NULL), m_clientList(NULL), m_clientFreeList(NULL), m_clientListMutex()
+Transport(), m_sharedTransport(NULL), m_codec(NULL), m_clientList(NULL), m_clientFreeList(NULL), m_clientListMutex(false)
 {
 }
 
@@ -88,13 +87,14 @@ erpc_status_t TransportArbitrator::receive(MessageBuffer *message)
         }
 
         // If this message is an invocation, return it to the calling server.
-        if ((msgType == message_type_t::kInvocationMessage) || (msgType == message_type_t::kOnewayMessage))
+        if ((msgType == message_type_t::kInvocationMessage) || (msgType == message_type_t::kOnewayMessage) ||
+            (msgType == message_type_t::kCreditedOnewayMessage))
         {
             break;
         }
 
         // Just ignore messages we don't know what to do with.
-        if (msgType != message_type_t::kReplyMessage)
+        if ((msgType != message_type_t::kReplyMessage) && (msgType != message_type_t::kBusyMessage))
         {
             continue;
         }
@@ -199,7 +199,7 @@ erpc_status_t TransportArbitrator::clientReceive(client_token_t token)
 }
 
 TransportArbitrator::PendingClientInfo *TransportArbitrator::createPendingClient(void){ ERPC_CREATE_NEW_OBJECT(
-    TransportArbitrator::PendingClientInfo, s_pendingClientInfoArray, ERPC_CLIENTS_THREADS_AMOUNT) }
+    TransportArbitrator::PendingClientInfo, s_pendingClientInfoPool, ERPC_CLIENTS_THREADS_AMOUNT) }
 
 TransportArbitrator::PendingClientInfo *TransportArbitrator::addPendingClient(void)
 {
@@ -269,7 +269,7 @@ void TransportArbitrator::freeClientList(PendingClientInfo *list)
     {
         temp = info;
         info = info->m_next;
-        ERPC_DESTROY_OBJECT(temp, s_pendingClientInfoArray, ERPC_CLIENTS_THREADS_AMOUNT)
+        ERPC_DESTROY_OBJECT(temp, s_pendingClientInfoPool, ERPC_CLIENTS_THREADS_AMOUNT)
     }
 }
 
@@ -176,6 +176,8 @@ public:
          * @brief Destructor.
          */
         ~PendingClientInfo(void);
+
+        ERPC_MEMORY_CATEGORY_OPERATORS(kErpcMemory_Arbitrator)
     };
 
 protected:
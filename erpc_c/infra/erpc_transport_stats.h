@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__TRANSPORT_STATS_H_
+#define _EMBEDDED_RPC__TRANSPORT_STATS_H_
+
+#include <stdint.h>
+
+/*!
+ * @addtogroup infra_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * @brief Counters of one transport.
+ *
+ * Counters are kept when #ERPC_TRANSPORT_STATS is enabled and wrap around. A transport fills only counters which
+ * apply to it, others stay zero.
+ */
+typedef struct erpc_transport_stats
+{
+    uint32_t messagesSent;     /*!< Messages sent successfully. */
+    uint32_t messagesReceived; /*!< Messages received successfully. */
+    uint32_t bytesSent;        /*!< Bytes of sent messages including frame headers. */
+    uint32_t bytesReceived;    /*!< Bytes of received messages including frame headers. */
+    uint32_t sendErrors;       /*!< Failed sends. */
+    uint32_t receiveErrors;    /*!< Failed receives, including CRC and framing errors. */
+    uint32_t crcErrors;        /*!< Frames with wrong CRC of header or body. */
+    uint32_t framingErrors;    /*!< Frames with header not fitting the receive buffer. */
+    uint32_t maxFrameSize;     /*!< Biggest frame sent or received, including frame header. */
+    uint32_t syscalls;         /*!< Calls to the operating system or driver moving data. */
+    uint32_t wouldBlock;       /*!< Calls which moved no data and were retried (EAGAIN, EINTR, ENOBUFS). */
+    uint32_t partialTransfers; /*!< Calls which moved less data than requested. */
+    uint32_t connects;         /*!< Connections established, each reconnect counts again. */
+    uint32_t disconnects;      /*!< Connections closed by peer or broken while in use. */
+} erpc_transport_stats_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__TRANSPORT_STATS_H_
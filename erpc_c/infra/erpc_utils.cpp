@@ -8,6 +8,14 @@
 
 #include "erpc_utils.hpp"
 
+#include "erpc_config_internal.h"
+
+#if ERPC_HAS_POSIX
+#include <time.h>
+#elif ERPC_THREADS
+#include "erpc_threading.h"
+#endif
+
 bool erpc::findIndexOfFunction(const arrayOfFunctionPtr_t sourceArrayOfFunctionPtr, uint16_t sourceArrayLength,
                                const functionPtr_t functionPtr, uint16_t &retVal)
 {
@@ -24,3 +32,30 @@ bool erpc::findIndexOfFunction(const arrayOfFunctionPtr_t sourceArrayOfFunctionP
     }
     return find;
 }
+
+uint32_t erpc::getTimeUsecs(void)
+{
+#if ERPC_HAS_POSIX
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U));
+#elif ERPC_THREADS_IS(FREERTOS)
+    // portTICK_PERIOD_MS is zero for tick rates above 1 kHz, so convert from the tick rate.
+    return (uint32_t)(((uint64_t)xTaskGetTickCount() * 1000000U) / configTICK_RATE_HZ);
+#elif ERPC_THREADS_IS(ZEPHYR)
+    return k_cyc_to_us_floor32(k_cycle_get_32());
+#elif ERPC_THREADS_IS(WIN32)
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+
+    (void)QueryPerformanceCounter(&counter);
+    (void)QueryPerformanceFrequency(&frequency);
+    return (uint32_t)(((counter.QuadPart / frequency.QuadPart) * 1000000) +
+                      (((counter.QuadPart % frequency.QuadPart) * 1000000) / frequency.QuadPart));
+#elif ERPC_THREADS_IS(THREADX)
+    return (uint32_t)(((uint64_t)tx_time_get() * 1000000U) / TX_TIMER_TICKS_PER_SECOND);
+#else
+    return 0;
+#endif
+}
@@ -6,6 +6,9 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#ifndef _EMBEDDED_RPC__UTILS_H_
+#define _EMBEDDED_RPC__UTILS_H_
+
 #include <stdint.h>
 
 namespace erpc {
@@ -14,4 +17,19 @@ typedef functionPtr_t *arrayOfFunctionPtr_t;
 
 bool findIndexOfFunction(const arrayOfFunctionPtr_t sourceArrayOfFunctionPtr, uint16_t sourceArrayLength,
                          const functionPtr_t functionPtr, uint16_t &retVal);
+
+/*!
+ * @brief Return monotonic time in microseconds.
+ *
+ * Time wraps around after about 71 minutes, so compute differences of two values in uint32_t.
+ *
+ * FreeRTOS and ThreadX ports derive time from the scheduler tick, so resolution is one tick (1 / configTICK_RATE_HZ
+ * or 1 / TX_TIMER_TICKS_PER_SECOND, e.g. 1000 us at 1 kHz) and short intervals often measure as zero. When the tick
+ * counter itself wraps, time jumps once by less than the 32-bit microsecond range.
+ *
+ * @return Current time, or 0 when the port has no time source.
+ */
+uint32_t getTimeUsecs(void);
 } // namespace erpc
+
+#endif // _EMBEDDED_RPC__UTILS_H_
@@ -78,6 +78,9 @@
     #if !defined(ERPC_CLIENTS_THREADS_AMOUNT)
         #define ERPC_CLIENTS_THREADS_AMOUNT (1U)
     #endif
+    #if !defined(ERPC_TCP_TRANSPORTS_COUNT)
+        #define ERPC_TCP_TRANSPORTS_COUNT (1U)
+    #endif
 #endif
 
 // Safely detect tx_api.h.
@@ -111,6 +114,18 @@
 // support, i.e. "#if ERPC_THREADS", because ERPC_THREADS_NONE has a value of 0.
 #define ERPC_THREADS_IS(_n_) (ERPC_THREADS == (ERPC_THREADS_##_n_))
 
+// Set default count of semaphore spins.
+#if !defined(ERPC_SEMAPHORE_SPIN_COUNT)
+    //! @brief Count of attempts to take a semaphore before sleeping.
+    #define ERPC_SEMAPHORE_SPIN_COUNT (0U)
+#endif
+
+// Set default scheduling policy of threads with priority.
+#if !defined(ERPC_THREADS_SCHED_POLICY)
+    //! @brief Real-time scheduling policy of pthreads threads with non zero priority.
+    #define ERPC_THREADS_SCHED_POLICY (SCHED_FIFO)
+#endif
+
 // Set default buffer size.
 #if !defined(ERPC_DEFAULT_BUFFER_SIZE)
     //! @brief Size of buffers allocated by BasicMessageBufferFactory in setup functions.
@@ -162,6 +177,17 @@
     #define ERPC_MESSAGE_LOGGING (ERPC_MESSAGE_LOGGING_DISABLED)
 #endif
 
+// Log messages synchronously by default.
+#if !defined(ERPC_MESSAGE_LOGGING_ASYNC)
+    #define ERPC_MESSAGE_LOGGING_ASYNC (0U)
+#endif
+#if !defined(ERPC_MESSAGE_LOGGING_QUEUE_SIZE)
+    #define ERPC_MESSAGE_LOGGING_QUEUE_SIZE (8U)
+#endif
+#if ERPC_MESSAGE_LOGGING_ASYNC && !ERPC_THREADS
+    #error "ERPC_MESSAGE_LOGGING_ASYNC needs threads."
+#endif
+
 #if defined(__CC_ARM) || defined(__ARMCC_VERSION) /* Keil MDK */
     #define THROW_BADALLOC throw(std::bad_alloc)
     #define THROW throw()
@@ -196,6 +222,111 @@
     #define ERPC_PRE_POST_ACTION_DEFAULT (ERPC_PRE_POST_ACTION_DEFAULT_DISABLED)
 #endif
 
+// Enable service dispatch table on systems where memory is not tight.
+#if !defined(ERPC_SERVICE_TABLE)
+    #if ERPC_HAS_POSIX
+        #define ERPC_SERVICE_TABLE (ERPC_SERVICE_TABLE_ENABLED)
+    #else
+        #define ERPC_SERVICE_TABLE (ERPC_SERVICE_TABLE_DISABLED)
+    #endif
+#endif
+
+// Set default priority scheduling server limits.
+#if !defined(ERPC_PRIORITY_LEVELS)
+    #define ERPC_PRIORITY_LEVELS (4U)
+#endif
+#if !defined(ERPC_PRIORITY_QUEUE_SIZE)
+    #define ERPC_PRIORITY_QUEUE_SIZE (8U)
+#endif
+#if !defined(ERPC_PRIORITY_AGING_LIMIT)
+    #define ERPC_PRIORITY_AGING_LIMIT (8U)
+#endif
+#if !defined(ERPC_PRIORITY_MAX_WORKERS)
+    #define ERPC_PRIORITY_MAX_WORKERS (4U)
+#endif
+
+// Disable oneway credit flow control by default.
+#if !defined(ERPC_ONEWAY_CREDITS)
+    #define ERPC_ONEWAY_CREDITS (0U)
+#endif
+
+// Disable per method server counters by default.
+#if !defined(ERPC_SERVER_METRICS)
+    #define ERPC_SERVER_METRICS (0U)
+#endif
+#if !defined(ERPC_SERVER_METRICS_METHODS)
+    #define ERPC_SERVER_METRICS_METHODS (32U)
+#endif
+#if !defined(ERPC_SERVER_METRICS_SHARDS)
+    #define ERPC_SERVER_METRICS_SHARDS (4U)
+#endif
+
+// Disable per function client counters by default.
+#if !defined(ERPC_CLIENT_METRICS)
+    #define ERPC_CLIENT_METRICS (0U)
+#endif
+#if !defined(ERPC_CLIENT_METRICS_FUNCTIONS)
+    #define ERPC_CLIENT_METRICS_FUNCTIONS (16U)
+#endif
+
+// Disable tracing by default.
+#if !defined(ERPC_TRACE)
+    #define ERPC_TRACE (0U)
+#endif
+#if !defined(ERPC_TRACE_BUFFER_SIZE)
+    #define ERPC_TRACE_BUFFER_SIZE (256U)
+#endif
+#if !defined(ERPC_TRACE_THREADS)
+    #define ERPC_TRACE_THREADS (8U)
+#endif
+
+// Disable transport counters by default.
+#if !defined(ERPC_TRANSPORT_STATS)
+    #define ERPC_TRANSPORT_STATS (0U)
+#endif
+
+// Disable memory accounting by default.
+#if !defined(ERPC_MEMORY_ACCOUNTING)
+    #define ERPC_MEMORY_ACCOUNTING (0U)
+#endif
+#if !defined(ERPC_MEMORY_ACCOUNTING_FUNCTIONS)
+    #define ERPC_MEMORY_ACCOUNTING_FUNCTIONS (16U)
+#endif
+
+// Set default count of pending messages per side of inter thread buffer transport.
+#if !defined(ERPC_INTER_THREAD_BUFFER_SLOTS)
+    #define ERPC_INTER_THREAD_BUFFER_SLOTS (4U)
+#endif
+
+// Set default receive buffer size of serial transport.
+#if !defined(ERPC_SERIAL_RX_BUFFER_SIZE)
+    #define ERPC_SERIAL_RX_BUFFER_SIZE (256U)
+#endif
+
+// Disable io_uring back end of socket transports by default.
+#if !defined(ERPC_SOCK_IO_URING)
+    #define ERPC_SOCK_IO_URING (0U)
+#endif
+#if ERPC_SOCK_IO_URING && !defined(__linux__)
+    #error "io_uring back end of socket transports requires Linux."
+#endif
+
+// Set default io_uring receive buffers of socket transports.
+#if !defined(ERPC_SOCK_IO_URING_BUFFERS)
+    #define ERPC_SOCK_IO_URING_BUFFERS (16U)
+#endif
+#if !defined(ERPC_SOCK_IO_URING_BUFFER_SIZE)
+    #define ERPC_SOCK_IO_URING_BUFFER_SIZE (4096U)
+#endif
+
+// Set default batching and datagram size of UDP transport.
+#if !defined(ERPC_UDP_BATCH_SIZE)
+    #define ERPC_UDP_BATCH_SIZE (8U)
+#endif
+#if !defined(ERPC_UDP_MAX_DATAGRAM_SIZE)
+    #define ERPC_UDP_MAX_DATAGRAM_SIZE (ERPC_DEFAULT_BUFFER_SIZE)
+#endif
+
 #if !defined(erpc_assert)
     #if ERPC_HAS_FREERTOSCONFIG_H
         #ifdef __cplusplus
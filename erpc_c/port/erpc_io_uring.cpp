@@ -0,0 +1,426 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_io_uring.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+extern "C" {
+#if !defined(__linux__)
+#error io_uring receiver requires Linux.
+#endif
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+}
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Count of submission queue entries, receiver has at most two requests queued.
+#define URING_SQ_ENTRIES (4U)
+
+//! @brief Group of registered receive buffers.
+#define URING_BUFFER_GROUP (0U)
+
+//! @brief Tag of cancel requests. Receive requests are tagged by connection number, which is 32 bits wide.
+#define URING_CANCEL_TAG (1ULL << 32)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+static inline uint32_t loadAcquire(const uint32_t *word)
+{
+    return __atomic_load_n(word, __ATOMIC_ACQUIRE);
+}
+
+static inline void storeRelease(uint32_t *word, uint32_t value)
+{
+    __atomic_store_n(word, value, __ATOMIC_RELEASE);
+}
+
+IoUringReceiver::IoUringReceiver(void) :
+m_ringFd(-1), m_active(false), m_hadData(false), m_sqRing(MAP_FAILED), m_sqSize(0), m_cqRing(MAP_FAILED),
+m_cqSize(0), m_sqes(MAP_FAILED), m_sqesSize(0), m_sqHead(NULL), m_sqTail(NULL), m_sqMask(0), m_sqArray(NULL),
+m_cqHead(NULL), m_cqTail(NULL), m_cqMask(0), m_cqes(NULL), m_bufRing(MAP_FAILED), m_bufRingSize(0), m_buffers(NULL),
+m_bufCount(0), m_bufSize(0), m_bufTail(0), m_pending(0), m_armed(false), m_fd(-1), m_connection(0),
+m_currentBuf(-1), m_currentPos(0), m_currentEnd(0)
+{
+}
+
+IoUringReceiver::~IoUringReceiver(void)
+{
+    release();
+}
+
+bool IoUringReceiver::init(uint32_t bufferCount, uint32_t bufferSize)
+{
+    struct io_uring_params params;
+    struct io_uring_buf_reg reg;
+    uint8_t *sq;
+    uint8_t *cq;
+
+    erpc_assert((bufferCount > 0U) && ((bufferCount & (bufferCount - 1U)) == 0U) && (bufferCount <= 32768U));
+
+    release();
+
+    (void)memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    // Multishot receive can complete into each buffer before the application takes any completion.
+    params.cq_entries = bufferCount * 2U;
+
+    m_ringFd = static_cast<int>(syscall(__NR_io_uring_setup, URING_SQ_ENTRIES, &params));
+    if (m_ringFd < 0)
+    {
+        m_ringFd = -1;
+        return false;
+    }
+
+    m_sqSize = params.sq_off.array + (params.sq_entries * sizeof(uint32_t));
+    m_cqSize = params.cq_off.cqes + (params.cq_entries * sizeof(struct io_uring_cqe));
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0U)
+    {
+        if (m_cqSize > m_sqSize)
+        {
+            m_sqSize = m_cqSize;
+        }
+        m_cqSize = m_sqSize;
+    }
+
+    m_sqRing = mmap(NULL, m_sqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+    if (m_sqRing == MAP_FAILED)
+    {
+        release();
+        return false;
+    }
+
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0U)
+    {
+        m_cqRing = m_sqRing;
+    }
+    else
+    {
+        m_cqRing =
+            mmap(NULL, m_cqSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+        if (m_cqRing == MAP_FAILED)
+        {
+            release();
+            return false;
+        }
+    }
+
+    m_sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    m_sqes = mmap(NULL, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+    if (m_sqes == MAP_FAILED)
+    {
+        release();
+        return false;
+    }
+
+    sq = reinterpret_cast<uint8_t *>(m_sqRing);
+    m_sqHead = reinterpret_cast<uint32_t *>(sq + params.sq_off.head);
+    m_sqTail = reinterpret_cast<uint32_t *>(sq + params.sq_off.tail);
+    m_sqMask = *reinterpret_cast<uint32_t *>(sq + params.sq_off.ring_mask);
+    m_sqArray = reinterpret_cast<uint32_t *>(sq + params.sq_off.array);
+
+    cq = reinterpret_cast<uint8_t *>(m_cqRing);
+    m_cqHead = reinterpret_cast<uint32_t *>(cq + params.cq_off.head);
+    m_cqTail = reinterpret_cast<uint32_t *>(cq + params.cq_off.tail);
+    m_cqMask = *reinterpret_cast<uint32_t *>(cq + params.cq_off.ring_mask);
+    m_cqes = cq + params.cq_off.cqes;
+
+    // Ring of free buffers must be page aligned.
+    m_bufRingSize = bufferCount * sizeof(struct io_uring_buf);
+    m_bufRing = mmap(NULL, m_bufRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (m_bufRing == MAP_FAILED)
+    {
+        release();
+        return false;
+    }
+
+    m_buffers = static_cast<uint8_t *>(malloc(bufferCount * bufferSize));
+    if (m_buffers == NULL)
+    {
+        release();
+        return false;
+    }
+    m_bufCount = bufferCount;
+    m_bufSize = bufferSize;
+
+    (void)memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = reinterpret_cast<uint64_t>(m_bufRing);
+    reg.ring_entries = bufferCount;
+    reg.bgid = URING_BUFFER_GROUP;
+    // Fails on kernels older than 5.19.
+    if (syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+    {
+        release();
+        return false;
+    }
+
+    m_bufTail = 0;
+    for (uint32_t bufId = 0; bufId < bufferCount; ++bufId)
+    {
+        recycleBuffer(bufId);
+    }
+
+    m_active = true;
+
+    return true;
+}
+
+void IoUringReceiver::release(void)
+{
+    if (m_ringFd != -1)
+    {
+        ::close(m_ringFd);
+        m_ringFd = -1;
+    }
+    if (m_sqes != MAP_FAILED)
+    {
+        (void)munmap(m_sqes, m_sqesSize);
+        m_sqes = MAP_FAILED;
+    }
+    if ((m_cqRing != MAP_FAILED) && (m_cqRing != m_sqRing))
+    {
+        (void)munmap(m_cqRing, m_cqSize);
+    }
+    m_cqRing = MAP_FAILED;
+    if (m_sqRing != MAP_FAILED)
+    {
+        (void)munmap(m_sqRing, m_sqSize);
+        m_sqRing = MAP_FAILED;
+    }
+    if (m_bufRing != MAP_FAILED)
+    {
+        (void)munmap(m_bufRing, m_bufRingSize);
+        m_bufRing = MAP_FAILED;
+    }
+    free(m_buffers);
+    m_buffers = NULL;
+
+    m_active = false;
+    m_armed = false;
+    m_pending = 0;
+    m_currentBuf = -1;
+}
+
+void IoUringReceiver::recycleBuffer(uint32_t bufId)
+{
+    // struct io_uring_buf_ring is not used, its flexible array is misplaced in C++. Ring is an array of entries with
+    // the tail overlaid on resv field of the first entry.
+    struct io_uring_buf *bufs = reinterpret_cast<struct io_uring_buf *>(m_bufRing);
+    struct io_uring_buf *buf = &bufs[m_bufTail & (m_bufCount - 1U)];
+
+    buf->addr = reinterpret_cast<uint64_t>(&m_buffers[bufId * m_bufSize]);
+    buf->len = m_bufSize;
+    buf->bid = static_cast<uint16_t>(bufId);
+    ++m_bufTail;
+    __atomic_store_n(&bufs[0].resv, m_bufTail, __ATOMIC_RELEASE);
+}
+
+void IoUringReceiver::queueRequest(uint8_t opcode, int fd, uint64_t addr, uint64_t userData)
+{
+    uint32_t tail = *m_sqTail;
+    uint32_t index = tail & m_sqMask;
+    struct io_uring_sqe *sqe = &reinterpret_cast<struct io_uring_sqe *>(m_sqes)[index];
+
+    (void)memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = addr;
+    sqe->user_data = userData;
+    if (opcode == IORING_OP_RECV)
+    {
+        // Kernel picks a registered buffer for each completion.
+        sqe->ioprio = IORING_RECV_MULTISHOT;
+        sqe->flags = IOSQE_BUFFER_SELECT;
+        sqe->buf_group = URING_BUFFER_GROUP;
+    }
+
+    m_sqArray[index] = index;
+    storeRelease(m_sqTail, tail + 1U);
+    ++m_pending;
+}
+
+bool IoUringReceiver::takeCompletion(uint64_t *userData, int32_t *result, uint32_t *flags)
+{
+    uint32_t head = *m_cqHead;
+    const struct io_uring_cqe *cqe;
+    long ret;
+
+    // System call is needed only to submit requests or to sleep until a completion arrives.
+    while ((m_pending > 0U) || (head == loadAcquire(m_cqTail)))
+    {
+        ret = syscall(__NR_io_uring_enter, m_ringFd, m_pending, (head == loadAcquire(m_cqTail)) ? 1U : 0U,
+                      IORING_ENTER_GETEVENTS, NULL, 0);
+        if (ret >= 0)
+        {
+            m_pending -= static_cast<uint32_t>(ret);
+        }
+        else if ((errno != EINTR) && (errno != EAGAIN) && (errno != EBUSY))
+        {
+            return false;
+        }
+    }
+
+    cqe = &reinterpret_cast<const struct io_uring_cqe *>(m_cqes)[head & m_cqMask];
+    *userData = cqe->user_data;
+    *result = cqe->res;
+    *flags = cqe->flags;
+    storeRelease(m_cqHead, head + 1U);
+
+    return true;
+}
+
+void IoUringReceiver::disarm(void)
+{
+    uint64_t userData;
+    int32_t result;
+    uint32_t flags;
+
+    if (m_currentBuf >= 0)
+    {
+        recycleBuffer(static_cast<uint32_t>(m_currentBuf));
+        m_currentBuf = -1;
+    }
+
+    if (m_armed)
+    {
+        queueRequest(IORING_OP_ASYNC_CANCEL, -1, m_connection, URING_CANCEL_TAG);
+
+        // Drop completions until the last one of the cancelled receive.
+        while (m_armed)
+        {
+            if (!takeCompletion(&userData, &result, &flags))
+            {
+                // Ring is broken, receiving continues with read().
+                release();
+                break;
+            }
+            if ((flags & IORING_CQE_F_BUFFER) != 0U)
+            {
+                recycleBuffer(flags >> IORING_CQE_BUFFER_SHIFT);
+            }
+            if ((userData == m_connection) && ((flags & IORING_CQE_F_MORE) == 0U))
+            {
+                m_armed = false;
+            }
+        }
+    }
+}
+
+erpc_status_t IoUringReceiver::receive(int fd, uint32_t connection, uint8_t *data, uint32_t size)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    uint64_t userData;
+    int32_t result;
+    uint32_t flags;
+    uint32_t length;
+
+    if ((fd != m_fd) || (connection != m_connection))
+    {
+        disarm();
+        m_fd = fd;
+        m_connection = connection;
+    }
+
+    while (m_active && (size > 0U) && (status == kErpcStatus_Success))
+    {
+        if (m_currentBuf >= 0)
+        {
+            length = m_currentEnd - m_currentPos;
+            if (length > size)
+            {
+                length = size;
+            }
+            (void)memcpy(data, &m_buffers[(static_cast<uint32_t>(m_currentBuf) * m_bufSize) + m_currentPos], length);
+            data += length;
+            size -= length;
+            m_currentPos += length;
+            if (m_currentPos == m_currentEnd)
+            {
+                recycleBuffer(static_cast<uint32_t>(m_currentBuf));
+                m_currentBuf = -1;
+            }
+            continue;
+        }
+
+        if (!m_armed)
+        {
+            queueRequest(IORING_OP_RECV, fd, 0, m_connection);
+            m_armed = true;
+        }
+
+        if (!takeCompletion(&userData, &result, &flags))
+        {
+            status = kErpcStatus_ReceiveFailed;
+            break;
+        }
+
+        if (userData != m_connection)
+        {
+            // Completion of cancel request.
+            continue;
+        }
+
+        if ((flags & IORING_CQE_F_MORE) == 0U)
+        {
+            m_armed = false;
+        }
+
+        if (result > 0)
+        {
+            m_currentBuf = static_cast<int32_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+            m_currentPos = 0;
+            m_currentEnd = static_cast<uint32_t>(result);
+            m_hadData = true;
+        }
+        else if (result == 0)
+        {
+            status = kErpcStatus_ConnectionClosed;
+        }
+        else if (result == -ENOBUFS)
+        {
+            // All buffers were filled before they were taken, receive is posted again.
+        }
+        else if ((result == -EINVAL) && !m_hadData)
+        {
+            // Kernel without multishot receive, nothing was taken from the socket yet.
+            release();
+            status = kErpcStatus_ReceiveFailed;
+        }
+        else
+        {
+            status = kErpcStatus_ReceiveFailed;
+        }
+    }
+
+    if (!m_active)
+    {
+        status = kErpcStatus_ReceiveFailed;
+    }
+
+    return status;
+}
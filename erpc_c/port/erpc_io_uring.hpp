@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__IO_URING_H_
+#define _EMBEDDED_RPC__IO_URING_H_
+
+#include "erpc_common.h"
+#include "erpc_config_internal.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/*!
+ * @addtogroup sock_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Stream socket receiver based on Linux io_uring.
+ *
+ * One multishot receive stays posted on the socket. The kernel fills buffers of a ring registered with io_uring while
+ * the application processes earlier data, and completions are taken from the shared completion queue. A system call
+ * is made only when no completion is waiting.
+ *
+ * Requires Linux 6.0 or newer. When io_uring is not available, init() fails and the caller keeps using read().
+ * Not thread safe, calls must be serialized by the caller.
+ *
+ * @ingroup sock_transport
+ */
+class IoUringReceiver
+{
+public:
+    /*!
+     * @brief Constructor.
+     */
+    IoUringReceiver(void);
+
+    /*!
+     * @brief Destructor.
+     */
+    ~IoUringReceiver(void);
+
+    /*!
+     * @brief Set up io_uring instance and register receive buffers.
+     *
+     * @param[in] bufferCount Count of receive buffers, power of two.
+     * @param[in] bufferSize Size of one receive buffer.
+     *
+     * @retval true Receiver is ready.
+     * @retval false Kernel does not support needed io_uring features or out of memory.
+     */
+    bool init(uint32_t bufferCount, uint32_t bufferSize);
+
+    /*!
+     * @brief Return true when receiver can be used.
+     *
+     * Receiver becomes unusable when the kernel refuses multishot receive. It happens before any data are taken from
+     * the socket, so the caller can continue with read().
+     *
+     * @return True when receiver is ready.
+     */
+    bool isActive(void) const { return m_active; }
+
+    /*!
+     * @brief Receive exactly size bytes from stream socket.
+     *
+     * A change of socket or connection makes the receiver drop the request and data of the previous one.
+     *
+     * @param[in] fd Socket to receive from.
+     * @param[in] connection Number identifying the connection of the socket.
+     * @param[out] data Buffer for received data.
+     * @param[in] size Count of bytes to receive.
+     *
+     * @retval kErpcStatus_Success All data were received.
+     * @retval kErpcStatus_ConnectionClosed Peer closed the connection.
+     * @retval kErpcStatus_ReceiveFailed Receiving failed, or receiver became inactive (see isActive()).
+     */
+    erpc_status_t receive(int fd, uint32_t connection, uint8_t *data, uint32_t size);
+
+private:
+    int m_ringFd;     /*!< io_uring instance. */
+    bool m_active;    /*!< Receiver is usable. */
+    bool m_hadData;   /*!< Any data were received, so multishot receive is supported. */
+    void *m_sqRing;   /*!< Mapped submission queue ring. */
+    size_t m_sqSize;  /*!< Size of m_sqRing mapping. */
+    void *m_cqRing;   /*!< Mapped completion queue ring, may be the same as m_sqRing. */
+    size_t m_cqSize;  /*!< Size of m_cqRing mapping. */
+    void *m_sqes;     /*!< Mapped submission queue entries. */
+    size_t m_sqesSize; /*!< Size of m_sqes mapping. */
+
+    uint32_t *m_sqHead;  /*!< Submission queue head, written by kernel. */
+    uint32_t *m_sqTail;  /*!< Submission queue tail. */
+    uint32_t m_sqMask;   /*!< Submission queue index mask. */
+    uint32_t *m_sqArray; /*!< Submission queue index array. */
+    uint32_t *m_cqHead;  /*!< Completion queue head. */
+    uint32_t *m_cqTail;  /*!< Completion queue tail, written by kernel. */
+    uint32_t m_cqMask;   /*!< Completion queue index mask. */
+    void *m_cqes;        /*!< Completion queue entries. */
+
+    void *m_bufRing;      /*!< Ring of free receive buffers shared with kernel. */
+    size_t m_bufRingSize; /*!< Size of m_bufRing mapping. */
+    uint8_t *m_buffers;   /*!< Memory of receive buffers. */
+    uint32_t m_bufCount;  /*!< Count of receive buffers. */
+    uint32_t m_bufSize;   /*!< Size of one receive buffer. */
+    uint16_t m_bufTail;   /*!< Tail of m_bufRing. */
+
+    uint32_t m_pending;    /*!< Count of queued but not submitted entries. */
+    bool m_armed;          /*!< Multishot receive is posted. */
+    int m_fd;              /*!< Socket of the posted receive. */
+    uint32_t m_connection; /*!< Connection of the posted receive. */
+    int32_t m_currentBuf;  /*!< Buffer with data not taken yet, -1 for none. */
+    uint32_t m_currentPos; /*!< Offset of first not taken byte in current buffer. */
+    uint32_t m_currentEnd; /*!< Count of received bytes in current buffer. */
+
+    /*!
+     * @brief Release all kernel and memory resources.
+     */
+    void release(void);
+
+    /*!
+     * @brief Give receive buffer back to the kernel.
+     *
+     * @param[in] bufId Buffer to recycle.
+     */
+    void recycleBuffer(uint32_t bufId);
+
+    /*!
+     * @brief Queue submission entry. It is submitted by next takeCompletion() call.
+     *
+     * @param[in] opcode Operation.
+     * @param[in] fd Target file.
+     * @param[in] addr Address field of the operation.
+     * @param[in] userData Tag of the operation.
+     */
+    void queueRequest(uint8_t opcode, int fd, uint64_t addr, uint64_t userData);
+
+    /*!
+     * @brief Take next completion, submit queued entries and wait when no completion is waiting.
+     *
+     * @param[out] userData Tag of completed operation.
+     * @param[out] result Result of the completion.
+     * @param[out] flags Flags of the completion.
+     *
+     * @retval true Completion was taken.
+     * @retval false io_uring_enter failed.
+     */
+    bool takeCompletion(uint64_t *userData, int32_t *result, uint32_t *flags);
+
+    /*!
+     * @brief Cancel posted receive and drop its pending completions and data.
+     */
+    void disarm(void);
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__IO_URING_H_
@@ -26,7 +26,59 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+
+//! @brief Categories of allocations counted by memory accounting.
+typedef enum erpc_memory_category
+{
+    kErpcMemory_Other = 0,  /*!< Allocations without category, e.g. objects created by setup functions. */
+    kErpcMemory_Buffers,    /*!< Message buffers of dynamic message buffer factory. */
+    kErpcMemory_Codecs,     /*!< Codecs created by codec factory. */
+    kErpcMemory_Params,     /*!< Parameters decoded by generated code, also counted per function. */
+    kErpcMemory_Arbitrator, /*!< Pending client records of transport arbitrator. */
+    kErpcMemory_CategoryCount
+} erpc_memory_category_t;
+
+//! @brief Counters of memory accounting.
+typedef struct erpc_memory_stats
+{
+    uint32_t allocations;  /*!< Count of successful allocations. */
+    uint32_t frees;        /*!< Count of freed allocations. */
+    uint32_t failures;     /*!< Count of failed allocations. */
+    uint32_t currentBytes; /*!< Bytes allocated now, without accounting headers. */
+    uint32_t peakBytes;    /*!< Highest value of currentBytes since start or erpc_memory_reset_peaks(). */
+} erpc_memory_stats_t;
+
+/*!
+ * @brief Tag of allocation for parameters of a function decoded by generated code.
+ *
+ * Plain #erpc_memory_category_t value is a tag as well.
+ *
+ * @param[in] serviceId Service id.
+ * @param[in] methodId Method id.
+ */
+#define ERPC_MEMORY_TAG_FUNCTION(serviceId, methodId) \
+    ((uint32_t)kErpcMemory_Params | (((uint32_t)(serviceId)&0xffU) << 8) | (((uint32_t)(methodId)&0xffU) << 16))
+
+#if ERPC_MEMORY_ACCOUNTING
+//! @brief Name of allocation function implemented by the port, erpc_malloc() is provided by memory accounting.
+#define ERPC_PORT_MALLOC erpc_port_malloc
+//! @brief Name of free function implemented by the port, erpc_free() is provided by memory accounting.
+#define ERPC_PORT_FREE erpc_port_free
+
+//! @brief Allocate memory counted with given tag.
+#define ERPC_MALLOC_TAGGED(size, tag) erpc_malloc_tagged((size), (tag))
+#else
+//! @brief Name of allocation function implemented by the port.
+#define ERPC_PORT_MALLOC erpc_malloc
+//! @brief Name of free function implemented by the port.
+#define ERPC_PORT_FREE erpc_free
+
+//! @brief Allocate memory counted with given tag, tag is not evaluated without memory accounting.
+#define ERPC_MALLOC_TAGGED(size, tag) erpc_malloc(size)
+#endif
 
 /*!
  * @brief This function is used for allocating space.
@@ -44,10 +96,121 @@ void *erpc_malloc(size_t size);
  */
 void erpc_free(void *ptr);
 
+#if ERPC_MEMORY_ACCOUNTING
+/*!
+ * @brief Allocate memory of the port without accounting.
+ *
+ * Implemented by the port when memory accounting is enabled.
+ *
+ * @param[in] size Size of memory block which should be allocated.
+ *
+ * @return Pointer to allocated space or NULL.
+ */
+void *erpc_port_malloc(size_t size);
+
+/*!
+ * @brief Free memory allocated by erpc_port_malloc().
+ *
+ * @param[in] ptr Pointer to memory which should be freed, or NULL.
+ */
+void erpc_port_free(void *ptr);
+
+/*!
+ * @brief Allocate space counted with given tag.
+ *
+ * @param[in] size Size of memory block which should be allocated.
+ * @param[in] tag Category of the allocation or ERPC_MEMORY_TAG_FUNCTION().
+ *
+ * @return Pointer to allocated space or NULL.
+ */
+void *erpc_malloc_tagged(size_t size, uint32_t tag);
+
+/*!
+ * @brief Read counters of all allocations.
+ *
+ * @param[out] stats Filled with counters.
+ */
+void erpc_memory_get_total_stats(erpc_memory_stats_t *stats);
+
+/*!
+ * @brief Read counters of one category.
+ *
+ * @param[in] category Category of allocations.
+ * @param[out] stats Filled with counters.
+ *
+ * @retval true Counters were read.
+ * @retval false Category is out of range.
+ */
+bool erpc_memory_get_stats(erpc_memory_category_t category, erpc_memory_stats_t *stats);
+
+/*!
+ * @brief Return count of functions with own counters of decoded parameters.
+ *
+ * @return Count of functions, at most #ERPC_MEMORY_ACCOUNTING_FUNCTIONS.
+ */
+uint32_t erpc_memory_get_function_count(void);
+
+/*!
+ * @brief Read counters of decoded parameters of one function.
+ *
+ * Functions keep their index, new functions get higher indexes.
+ *
+ * @param[in] index Index of function, lower than erpc_memory_get_function_count().
+ * @param[out] serviceId Service id of the function.
+ * @param[out] methodId Method id of the function.
+ * @param[out] stats Filled with counters.
+ *
+ * @retval true Counters were read.
+ * @retval false Index is out of range.
+ */
+bool erpc_memory_get_function_stats(uint32_t index, uint32_t *serviceId, uint32_t *methodId,
+                                    erpc_memory_stats_t *stats);
+
+/*!
+ * @brief Set peak bytes of all counters to current bytes.
+ */
+void erpc_memory_reset_peaks(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
 
+#if defined(__cplusplus)
+#if ERPC_MEMORY_ACCOUNTING
+#include <new>
+
+/*!
+ * @brief Declare operators new and delete of a class, so that its objects are counted in given category.
+ *
+ * Placement new used by ManuallyConstructed stays available.
+ *
+ * @param[in] category Category of the objects.
+ */
+#define ERPC_MEMORY_CATEGORY_OPERATORS(category)                                                 \
+    static void *operator new(std::size_t size) { return erpc_malloc_tagged(size, (category)); } \
+    static void *operator new(std::size_t size, const std::nothrow_t &tag) NOEXCEPT              \
+    {                                                                                            \
+        (void)tag;                                                                               \
+        return erpc_malloc_tagged(size, (category));                                             \
+    }                                                                                            \
+    static void *operator new(std::size_t size, void *place) NOEXCEPT                            \
+    {                                                                                            \
+        (void)size;                                                                              \
+        return place;                                                                            \
+    }                                                                                            \
+    static void operator delete(void *ptr) { erpc_free(ptr); }                                   \
+    static void operator delete(void *ptr, void *place) NOEXCEPT                                 \
+    {                                                                                            \
+        (void)ptr;                                                                               \
+        (void)place;                                                                             \
+    }
+#else
+//! @brief Declare operators new and delete counting objects in given category, empty without memory accounting.
+#define ERPC_MEMORY_CATEGORY_OPERATORS(category)
+#endif
+#endif
+
 /*! @} */
 
 #endif // _EMBEDDED_RPC__PORT_H_
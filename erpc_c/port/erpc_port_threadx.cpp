@@ -54,13 +54,13 @@ void operator delete[](void *ptr) THROW
     erpc_free(ptr);
 }
 
-void *erpc_malloc(size_t size)
+void *ERPC_PORT_MALLOC(size_t size)
 {
     void *p = malloc(size);
     return p;
 }
 
-void erpc_free(void *ptr)
+void ERPC_PORT_FREE(void *ptr)
 {
     free(ptr);
 }
@@ -38,6 +38,10 @@
 
 #include "erpc_serial.h"
 
+#ifndef _WIN32
+#include <poll.h>
+#endif
+
 #ifdef _WIN32
 static OVERLAPPED s_writeOverlap;
 static OVERLAPPED s_readOverlap;
@@ -199,7 +203,35 @@ int serial_write(int fd, const char *buf, int size)
 
     return bwritten;
 #else
-    return write(fd, buf, size);
+    int len = 0;
+    int ret;
+    struct pollfd pfd;
+
+    pfd.fd = fd;
+    pfd.events = POLLOUT;
+
+    // Write whole buffer, tty may accept only part of it at once.
+    while (len < size)
+    {
+        ret = write(fd, buf + len, size - len);
+        if (ret == -1)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                (void)poll(&pfd, 1, -1);
+            }
+            else if (errno != EINTR)
+            {
+                return -1;
+            }
+
+            continue;
+        }
+
+        len += ret;
+    }
+
+    return len;
 #endif
 }
 
@@ -291,6 +323,52 @@ int serial_read(int fd, char *buf, int size)
 #endif
 }
 
+int serial_read_chunk(int fd, char *buf, int size, int timeout_ms)
+{
+#ifdef _WIN32
+    (void)timeout_ms;
+
+    return serial_read(fd, buf, size);
+#else
+    int ret;
+    struct pollfd pfd;
+
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+
+    while (true)
+    {
+        ret = poll(&pfd, 1, timeout_ms);
+        if (ret == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return -1;
+        }
+
+        if (ret == 0)
+        {
+            return 0;
+        }
+
+        ret = read(fd, buf, size);
+        if (ret > 0)
+        {
+            return ret;
+        }
+
+        // Zero length read after poll reported the tty readable means hang up.
+        if ((ret == 0) || ((errno != EINTR) && (errno != EAGAIN) && (errno != EWOULDBLOCK)))
+        {
+            return -1;
+        }
+    }
+#endif
+}
+
 int serial_open(const char *port)
 {
     int fd;
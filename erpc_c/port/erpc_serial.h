@@ -66,6 +66,12 @@ int serial_setup(int fd, speed_t speed);
 int serial_set_read_timeout(int fd, uint8_t vtime, uint8_t vmin);
 int serial_write(int fd, const char *buf, int size);
 int serial_read(int fd, char *buf, int size);
+/*
+ * Wait up to timeout_ms (negative waits forever) until data arrive and read what is available, at most size bytes.
+ * Returns count of read bytes, 0 when the timeout expired or -1 on error or hang up.
+ * Windows: reads exactly size bytes, timeout is not supported.
+ */
+int serial_read_chunk(int fd, char *buf, int size, int timeout_ms);
 int serial_open(const char *port);
 int serial_close(int fd);
 
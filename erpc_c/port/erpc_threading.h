@@ -198,6 +198,34 @@ public:
     void setStackPointer(k_thread_stack_t *stack) { m_stack = stack; }
 #endif
 
+#if ERPC_THREADS_IS(PTHREADS)
+    /*!
+     * @brief This function sets priority of thread.
+     *
+     * Non zero priority selects real-time scheduling policy #ERPC_THREADS_SCHED_POLICY with the priority clamped to
+     * range of the policy. Without privilege for real-time scheduling the thread keeps scheduling of its creator.
+     * Zero keeps scheduling of the creator. Priority of running thread is changed immediately.
+     *
+     * @param[in] priority Thread priority.
+     *
+     * @retval true When priority was set or thread is not started yet.
+     * @retval false When priority of running thread cannot be changed.
+     */
+    bool setPriority(uint32_t priority);
+
+    /*!
+     * @brief This function sets CPUs thread can run on.
+     *
+     * Affinity of running thread is changed immediately. Ignored where the system does not support affinity.
+     *
+     * @param[in] cpuMask Bit n allows CPU n. Zero allows all CPUs.
+     *
+     * @retval true When affinity was set or thread is not started yet.
+     * @retval false When affinity of running thread cannot be changed.
+     */
+    bool setCpuAffinity(uint32_t cpuMask);
+#endif
+
     /*!
      * @brief This function returns Thread instance where functions is called.
      *
@@ -231,6 +259,7 @@ private:
 #if ERPC_THREADS_IS(PTHREADS)
     static pthread_key_t s_threadObjectKey; /*!< Thread key. */
     pthread_t m_thread;                     /*!< Current thread. */
+    uint32_t m_cpuMask;                     /*!< CPUs the thread can run on, zero for all. */
 #elif ERPC_THREADS_IS(FREERTOS)
     TaskHandle_t m_task;       /*!< Current task. */
     Thread *m_next;            /*!< Pointer to next Thread. */
@@ -333,7 +362,8 @@ private:
 /*!
  * @brief Mutex.
  *
- * If the OS supports it, the mutex will be recursive.
+ * If the OS supports it, the mutex will be recursive. Mutexes guarding short sections which never lock them again
+ * can be created as non-recursive, which is cheaper where the OS distinguishes these.
  *
  * @ingroup port_threads
  */
@@ -366,6 +396,23 @@ public:
      */
     Mutex(void);
 
+#if ERPC_THREADS_IS(PTHREADS)
+    /*!
+     * @brief Constructor.
+     *
+     * @param[in] recursive False for mutex which is never locked again by its owner. Such mutex is adaptive where
+     * available, spinning shortly before sleeping.
+     */
+    explicit Mutex(bool recursive);
+#else
+    /*!
+     * @brief Constructor.
+     *
+     * @param[in] recursive Ignored, this port always creates its default mutex.
+     */
+    explicit Mutex(bool recursive) : Mutex() { (void)recursive; }
+#endif
+
     /*!
      * @brief Destructor.
      */
@@ -490,7 +537,10 @@ public:
     int getCount(void) const;
 
 private:
-#if ERPC_THREADS_IS(PTHREADS)
+#if ERPC_THREADS_IS(PTHREADS) && defined(__linux__)
+    uint32_t m_count;   /*!< Semaphore count number, also the futex word waiters sleep on. */
+    uint32_t m_waiters; /*!< Count of threads sleeping in get(), put() skips the wake up syscall without them. */
+#elif ERPC_THREADS_IS(PTHREADS)
     int m_count;           /*!< Semaphore count number. */
     pthread_cond_t m_cond; /*!< Condition variable. Allows threads to suspend execution and relinquish the processors
                               until some predicate on shared data is satisfied. */
@@ -9,6 +9,7 @@
  */
 
 #include "erpc_threading.h"
+#include "erpc_trace.h"
 
 #include <errno.h>
 
@@ -140,6 +141,9 @@ void Thread::threadEntryPointStub(void *arg)
     Thread *_this = reinterpret_cast<Thread *>(arg);
     erpc_assert((_this != NULL) && ("Reinterpreting 'void *arg' to 'Thread *' failed." != NULL));
     _this->threadEntryPoint();
+#if ERPC_TRACE
+    erpc_trace_thread_exit();
+#endif
 
     // Remove this thread from the linked list.
     taskENTER_CRITICAL();
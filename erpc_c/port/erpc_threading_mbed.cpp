@@ -11,6 +11,7 @@
  */
 
 #include "erpc_threading.h"
+#include "erpc_trace.h"
 
 #include "platform/CriticalSectionLock.h"
 
@@ -125,6 +126,9 @@ void Thread::threadEntryPointStub(void *arg)
     Thread *_this = reinterpret_cast<Thread *>(arg);
     erpc_assert(_this != NULL); // Reinterpreting 'void *arg' to 'Thread *' failed.
     _this->threadEntryPoint();
+#if ERPC_TRACE
+    erpc_trace_thread_exit();
+#endif
 
     // Remove this thread from the linked list.
     mbed::CriticalSectionLock::enable();
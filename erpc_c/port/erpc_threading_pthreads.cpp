@@ -11,11 +11,29 @@
 #include "erpc_threading.h"
 
 #include <errno.h>
-#include <sys/time.h>
+#include <limits.h>
+#include <sched.h>
 #include <time.h>
 
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 using namespace erpc;
 
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief CPU affinity is supported by the system.
+#if defined(__linux__) || defined(CONFIG_SMP)
+#define THREAD_HAS_AFFINITY (1)
+#else
+#define THREAD_HAS_AFFINITY (0)
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
@@ -34,12 +52,103 @@ const uint32_t sToUs = 1000000;
 // Code
 ////////////////////////////////////////////////////////////////////////////////
 
-Thread::Thread(const char *name) : m_name(name), m_entry(0), m_arg(0), m_stackSize(0), m_priority(0), m_thread(0) {}
+/*!
+ * @brief Compute absolute time after given timeout.
+ *
+ * @param[in] clock Clock of the deadline.
+ * @param[in] timeoutUsecs Timeout in [us].
+ * @param[out] time Deadline.
+ */
+static void deadline(clockid_t clock, uint32_t timeoutUsecs, struct timespec *time)
+{
+    (void)clock_gettime(clock, time);
+    time->tv_sec += timeoutUsecs / sToUs;
+    time->tv_nsec += static_cast<long>((timeoutUsecs % sToUs) * 1000U);
+    if (time->tv_nsec >= 1000000000L)
+    {
+        ++time->tv_sec;
+        time->tv_nsec -= 1000000000L;
+    }
+}
+
+#if defined(__linux__)
+/*!
+ * @brief Decrement semaphore count when it is not zero.
+ *
+ * @param[in,out] count Semaphore count.
+ *
+ * @retval true Semaphore was taken.
+ */
+static bool tryTake(uint32_t *count)
+{
+    uint32_t value = __atomic_load_n(count, __ATOMIC_SEQ_CST);
+
+    while (value != 0U)
+    {
+        if (__atomic_compare_exchange_n(count, &value, value - 1U, true, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
+#if THREAD_HAS_AFFINITY
+/*!
+ * @brief Convert CPU mask to CPU set.
+ *
+ * @param[in] cpuMask Bit n allows CPU n.
+ * @param[out] set CPU set.
+ */
+static void toCpuSet(uint32_t cpuMask, cpu_set_t *set)
+{
+    uint32_t cpu;
+
+    CPU_ZERO(set);
+    for (cpu = 0U; cpu < 32U; ++cpu)
+    {
+        if ((cpuMask & (1UL << cpu)) != 0U)
+        {
+            CPU_SET(cpu, set);
+        }
+    }
+}
+#endif
+
+/*!
+ * @brief Convert eRPC priority to priority of real-time scheduling policy.
+ *
+ * @param[in] priority Non zero eRPC priority.
+ *
+ * @return Scheduling parameters.
+ */
+static struct sched_param toSchedParam(uint32_t priority)
+{
+    struct sched_param param = {};
+    int min = sched_get_priority_min(ERPC_THREADS_SCHED_POLICY);
+    int max = sched_get_priority_max(ERPC_THREADS_SCHED_POLICY);
+
+    param.sched_priority = (priority > static_cast<uint32_t>(max)) ? max : static_cast<int>(priority);
+    if (param.sched_priority < min)
+    {
+        param.sched_priority = min;
+    }
+
+    return param;
+}
+
+Thread::Thread(const char *name) :
+m_name(name), m_entry(0), m_arg(0), m_stackSize(0), m_priority(0), m_stackPtr(NULL), m_thread(0), m_cpuMask(0)
+{
+}
 
 Thread::Thread(thread_entry_t entry, uint32_t priority, uint32_t stackSize, const char *name,
                thread_stack_pointer stackPtr) :
 m_name(name),
-m_entry(entry), m_arg(0), m_stackSize(stackSize), m_priority(priority), m_thread(0)
+m_entry(entry), m_arg(0), m_stackSize(stackSize), m_priority(priority), m_stackPtr(stackPtr), m_thread(0),
+m_cpuMask(0)
 {
 }
 
@@ -61,9 +170,109 @@ void Thread::start(void *arg)
     }
 
     m_arg = arg;
-    pthread_create(&m_thread, NULL, threadEntryPointStub, this);
-    pthread_setspecific(s_threadObjectKey, reinterpret_cast<void *>(this));
-    pthread_detach(m_thread);
+
+    pthread_attr_t attr;
+    struct sched_param param;
+    int err;
+
+    pthread_attr_init(&attr);
+    if (m_stackSize > 0U)
+    {
+        if (m_stackPtr != NULL)
+        {
+            pthread_attr_setstack(&attr, m_stackPtr, m_stackSize);
+        }
+        else
+        {
+            pthread_attr_setstacksize(&attr, (m_stackSize < PTHREAD_STACK_MIN) ? PTHREAD_STACK_MIN : m_stackSize);
+        }
+    }
+    if (m_priority > 0U)
+    {
+        param = toSchedParam(m_priority);
+        pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+        pthread_attr_setschedpolicy(&attr, ERPC_THREADS_SCHED_POLICY);
+        pthread_attr_setschedparam(&attr, &param);
+    }
+#if THREAD_HAS_AFFINITY
+    if (m_cpuMask != 0U)
+    {
+        cpu_set_t set;
+        toCpuSet(m_cpuMask, &set);
+        pthread_attr_setaffinity_np(&attr, sizeof(set), &set);
+    }
+#endif
+
+    err = pthread_create(&m_thread, &attr, threadEntryPointStub, this);
+    if ((err == EPERM) && (m_priority > 0U))
+    {
+        // Not allowed to use real-time scheduling, run with scheduling of the creator.
+        pthread_attr_setinheritsched(&attr, PTHREAD_INHERIT_SCHED);
+        err = pthread_create(&m_thread, &attr, threadEntryPointStub, this);
+    }
+    pthread_attr_destroy(&attr);
+
+    if (err == 0)
+    {
+        pthread_setspecific(s_threadObjectKey, reinterpret_cast<void *>(this));
+        pthread_detach(m_thread);
+    }
+    else
+    {
+        m_thread = 0;
+    }
+}
+
+bool Thread::setPriority(uint32_t priority)
+{
+    struct sched_param param = {};
+    bool retVal = true;
+
+    m_priority = priority;
+
+    if (m_thread != 0)
+    {
+        if (priority > 0U)
+        {
+            param = toSchedParam(priority);
+            retVal = (pthread_setschedparam(m_thread, ERPC_THREADS_SCHED_POLICY, &param) == 0);
+        }
+        else
+        {
+            retVal = (pthread_setschedparam(m_thread, SCHED_OTHER, &param) == 0);
+        }
+    }
+
+    return retVal;
+}
+
+bool Thread::setCpuAffinity(uint32_t cpuMask)
+{
+    bool retVal = true;
+
+    m_cpuMask = cpuMask;
+
+#if THREAD_HAS_AFFINITY
+    if (m_thread != 0)
+    {
+        cpu_set_t set;
+        if (cpuMask != 0U)
+        {
+            toCpuSet(cpuMask, &set);
+        }
+        else
+        {
+            CPU_ZERO(&set);
+            for (uint32_t cpu = 0U; cpu < CPU_SETSIZE; ++cpu)
+            {
+                CPU_SET(cpu, &set);
+            }
+        }
+        retVal = (pthread_setaffinity_np(m_thread, sizeof(set), &set) == 0);
+    }
+#endif
+
+    return retVal;
 }
 
 bool Thread::operator==(Thread &o)
@@ -120,11 +329,24 @@ void *Thread::threadEntryPointStub(void *arg)
     return 0;
 }
 
-Mutex::Mutex(void)
+Mutex::Mutex(void) : Mutex(true) {}
+
+Mutex::Mutex(bool recursive)
 {
     pthread_mutexattr_t attr;
     pthread_mutexattr_init(&attr);
-    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    if (recursive)
+    {
+        pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    }
+    else
+    {
+#if defined(PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP)
+        pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_ADAPTIVE_NP);
+#else
+        pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_NORMAL);
+#endif
+    }
 
     pthread_mutex_init(&m_mutex, &attr);
 
@@ -151,9 +373,79 @@ bool Mutex::unlock(void)
     return pthread_mutex_unlock(&m_mutex) == 0;
 }
 
-Semaphore::Semaphore(int count) : m_count(count), m_mutex()
+#if defined(__linux__)
+Semaphore::Semaphore(int count) : m_count(static_cast<uint32_t>(count)), m_waiters(0) {}
+
+Semaphore::~Semaphore(void) {}
+
+void Semaphore::put(void)
+{
+    (void)__atomic_fetch_add(&m_count, 1U, __ATOMIC_SEQ_CST);
+
+    // Waiter announces itself before its last check of the count, so it is either seen here or sees the count.
+    if (__atomic_load_n(&m_waiters, __ATOMIC_SEQ_CST) != 0U)
+    {
+        (void)syscall(SYS_futex, &m_count, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+}
+
+bool Semaphore::get(uint32_t timeoutUsecs)
+{
+    struct timespec wait;
+    bool retVal = tryTake(&m_count);
+    uint32_t spin;
+    long err;
+
+    for (spin = 0U; !retVal && (spin < ERPC_SEMAPHORE_SPIN_COUNT); ++spin)
+    {
+        retVal = tryTake(&m_count);
+    }
+
+    if (!retVal && (timeoutUsecs > 0U))
+    {
+        if (timeoutUsecs != kWaitForever)
+        {
+            deadline(CLOCK_MONOTONIC, timeoutUsecs, &wait);
+        }
+
+        (void)__atomic_fetch_add(&m_waiters, 1U, __ATOMIC_SEQ_CST);
+        while (!retVal)
+        {
+            retVal = tryTake(&m_count);
+            if (!retVal)
+            {
+                // Sleeps only while the count is still zero, deadline is absolute time of CLOCK_MONOTONIC.
+                err = syscall(SYS_futex, &m_count, FUTEX_WAIT_BITSET_PRIVATE, 0U,
+                              (timeoutUsecs == kWaitForever) ? NULL : &wait, NULL, FUTEX_BITSET_MATCH_ANY);
+                if ((err != 0) && (errno == ETIMEDOUT))
+                {
+                    retVal = tryTake(&m_count);
+                    break;
+                }
+            }
+        }
+        (void)__atomic_fetch_sub(&m_waiters, 1U, __ATOMIC_SEQ_CST);
+    }
+
+    return retVal;
+}
+
+int Semaphore::getCount(void) const
+{
+    return static_cast<int>(__atomic_load_n(&m_count, __ATOMIC_RELAXED));
+}
+#else
+Semaphore::Semaphore(int count) : m_count(count), m_mutex(false)
 {
-    pthread_cond_init(&m_cond, NULL);
+    pthread_condattr_t attr;
+
+    pthread_condattr_init(&attr);
+#if !defined(__APPLE__)
+    // Deadlines do not move with wall clock changes.
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+#endif
+    pthread_cond_init(&m_cond, &attr);
+    pthread_condattr_destroy(&attr);
 }
 
 Semaphore::~Semaphore(void)
@@ -164,10 +456,8 @@ Semaphore::~Semaphore(void)
 void Semaphore::put(void)
 {
     Mutex::Guard guard(m_mutex);
-    if (m_count == 0)
-    {
-        pthread_cond_signal(&m_cond);
-    }
+    // Signal on every put, more threads can wait for the count.
+    pthread_cond_signal(&m_cond);
     ++m_count;
 }
 
@@ -175,36 +465,38 @@ bool Semaphore::get(uint32_t timeoutUsecs)
 {
     Mutex::Guard guard(m_mutex);
     bool retVal = true;
+    struct timespec wait;
     int err;
 
+    if ((timeoutUsecs != kWaitForever) && (timeoutUsecs > 0U))
+    {
+        // Create an absolute timeout time.
+#if !defined(__APPLE__)
+        deadline(CLOCK_MONOTONIC, timeoutUsecs, &wait);
+#else
+        deadline(CLOCK_REALTIME, timeoutUsecs, &wait);
+#endif
+    }
+
     while (m_count == 0)
     {
         if (timeoutUsecs == kWaitForever)
         {
             err = pthread_cond_wait(&m_cond, m_mutex.getPtr());
-            if (err != 0)
-            {
-                retVal = false;
-                break;
-            }
+        }
+        else if (timeoutUsecs > 0U)
+        {
+            err = pthread_cond_timedwait(&m_cond, m_mutex.getPtr(), &wait);
         }
         else
         {
-            if (timeoutUsecs > 0U)
-            {
-                // Create an absolute timeout time.
-                struct timeval tv;
-                gettimeofday(&tv, NULL);
-                struct timespec wait;
-                wait.tv_sec = tv.tv_sec + (timeoutUsecs / sToUs);
-                wait.tv_nsec = (timeoutUsecs % sToUs) * 1000U;
-                err = pthread_cond_timedwait(&m_cond, m_mutex.getPtr(), &wait);
-                if (err != 0)
-                {
-                    retVal = false;
-                    break;
-                }
-            }
+            err = ETIMEDOUT;
+        }
+
+        if (err != 0)
+        {
+            retVal = false;
+            break;
         }
     }
 
@@ -220,6 +512,7 @@ int Semaphore::getCount(void) const
 {
     return m_count;
 }
+#endif // defined(__linux__)
 
 ////////////////////////////////////////////////////////////////////////////////
 // EOF
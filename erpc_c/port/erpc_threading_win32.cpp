@@ -9,6 +9,7 @@
  */
 
 #include "erpc_threading.h"
+#include "erpc_trace.h"
 
 #include <errno.h>
 #include <process.h>
@@ -129,6 +130,9 @@ unsigned WINAPI Thread::threadEntryPointStub(void *arg)
     if (_this != NULL)
     {
         _this->threadEntryPoint();
+#if ERPC_TRACE
+        erpc_trace_thread_exit();
+#endif
     }
 
     return 0;
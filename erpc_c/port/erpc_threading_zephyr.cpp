@@ -8,6 +8,7 @@
  */
 
 #include "erpc_threading.h"
+#include "erpc_trace.h"
 
 #if ERPC_THREADS_IS(ZEPHYR)
 
@@ -77,6 +78,9 @@ void Thread::threadEntryPointStub(void *arg1, void *arg2, void *arg3)
     erpc_assert((_this != NULL) && ("Reinterpreting 'void *arg1' to 'Thread *' failed." != NULL));
     k_thread_custom_data_set(arg1);
     _this->threadEntryPoint();
+#if ERPC_TRACE
+    erpc_trace_thread_exit();
+#endif
 
     // Handle a task returning from its function.
     k_thread_abort(k_current_get());
@@ -162,6 +162,17 @@ bool erpc_client_add_message_logger(erpc_client_t client, erpc_transport_t trans
 
     return clientManager->addMessageLogger(reinterpret_cast<Transport *>(transport));
 }
+
+#if ERPC_MESSAGE_LOGGING_ASYNC
+uint32_t erpc_client_get_dropped_log_messages(erpc_client_t client)
+{
+    erpc_assert(client != NULL);
+
+    ClientManager *clientManager = reinterpret_cast<ClientManager *>(client);
+
+    return clientManager->getDroppedCount();
+}
+#endif
 #endif
 
 #if ERPC_PRE_POST_ACTION
@@ -184,6 +195,60 @@ void erpc_client_add_post_cb_action(erpc_client_t client, pre_post_action_cb pos
 }
 #endif
 
+#if ERPC_CLIENT_METRICS
+uint32_t erpc_client_get_metrics(erpc_client_t client, erpc_client_function_stats_t *stats, uint32_t max_count,
+                                 uint32_t *untracked)
+{
+    erpc_assert(client != NULL);
+    erpc_assert((stats != NULL) || (max_count == 0U));
+
+    static_assert(ClientMetrics::kLatencyBuckets == ERPC_CLIENT_LATENCY_BUCKETS, "Bucket counts differ.");
+    static_assert((uint32_t)ClientMetrics::kPhaseCount == (uint32_t)kErpcClientPhase_Count, "Phases differ.");
+
+    ClientManager *clientManager = reinterpret_cast<ClientManager *>(client);
+    ClientMetrics &metrics = clientManager->getMetrics();
+    ClientMetrics::FunctionStats functionStats;
+    uint32_t count = 0;
+    uint32_t phase;
+    uint32_t bucket;
+
+    while ((count < max_count) && metrics.getFunctionStats(count, &functionStats))
+    {
+        erpc_client_function_stats_t *out = &stats[count];
+
+        out->service_id = functionStats.serviceId;
+        out->method_id = functionStats.methodId;
+        out->calls = functionStats.calls;
+        out->errors = functionStats.errors;
+        out->last_error = functionStats.lastError;
+        for (phase = 0; phase < (uint32_t)kErpcClientPhase_Count; ++phase)
+        {
+            for (bucket = 0; bucket < ERPC_CLIENT_LATENCY_BUCKETS; ++bucket)
+            {
+                out->latency[phase][bucket] = functionStats.latency[phase][bucket];
+            }
+        }
+        ++count;
+    }
+
+    if (untracked != NULL)
+    {
+        *untracked = metrics.getUntrackedCount();
+    }
+
+    return count;
+}
+
+void erpc_client_reset_metrics(erpc_client_t client)
+{
+    erpc_assert(client != NULL);
+
+    ClientManager *clientManager = reinterpret_cast<ClientManager *>(client);
+
+    clientManager->getMetrics().reset();
+}
+#endif
+
 void erpc_client_deinit(erpc_client_t client)
 {
 #if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
@@ -106,6 +106,17 @@ void erpc_client_set_server_thread_id(erpc_client_t client, void *serverThreadId
  * @retval False When transport wasn't added.
  */
 bool erpc_client_add_message_logger(erpc_client_t client, erpc_transport_t transport);
+
+#if ERPC_MESSAGE_LOGGING_ASYNC
+/*!
+ * @brief This function returns count of messages which loggers missed because the logging queue was full.
+ *
+ * @param[in] client Pointer to client structure.
+ *
+ * @return Count of dropped messages.
+ */
+uint32_t erpc_client_get_dropped_log_messages(erpc_client_t client);
+#endif
 #endif
 
 #if ERPC_PRE_POST_ACTION
@@ -128,6 +139,58 @@ void erpc_client_add_pre_cb_action(erpc_client_t client, pre_post_action_cb preC
 void erpc_client_add_post_cb_action(erpc_client_t client, pre_post_action_cb postCB);
 #endif
 
+#if ERPC_CLIENT_METRICS
+//! @brief Measured phases of client call, first index of erpc_client_function_stats_t::latency.
+typedef enum erpc_client_phase
+{
+    kErpcClientPhase_Acquire = 0, /*!< Getting codec and message buffer. */
+    kErpcClientPhase_Encode,      /*!< Encoding of arguments. */
+    kErpcClientPhase_Send,        /*!< Sending of request, including waits for transport and oneway credit. */
+    kErpcClientPhase_Wait,        /*!< Waiting for reply, including waits of arbitrated client. */
+    kErpcClientPhase_Decode,      /*!< Decoding of reply. */
+    kErpcClientPhase_Total,       /*!< Whole call. */
+    kErpcClientPhase_Count        /*!< Count of phases. */
+} erpc_client_phase_t;
+
+//! @brief Count of buckets of latency histograms. Bucket 0 counts times under 1 us, bucket n times from 2^(n-1) to
+//! 2^n us, the last bucket all longer times.
+#define ERPC_CLIENT_LATENCY_BUCKETS (20U)
+
+//! @brief Counters of one client function.
+typedef struct erpc_client_function_stats
+{
+    uint32_t service_id;      /*!< Service of the function. */
+    uint32_t method_id;       /*!< Function id. */
+    uint32_t calls;           /*!< Count of calls. */
+    uint32_t errors;          /*!< Count of failed calls. */
+    erpc_status_t last_error; /*!< Status of last failed call. */
+    uint32_t latency[kErpcClientPhase_Count][ERPC_CLIENT_LATENCY_BUCKETS]; /*!< Histograms of phase times. */
+} erpc_client_function_stats_t;
+
+/*!
+ * @brief This function reads per function counters of client.
+ *
+ * Functions keep their position between snapshots, newly called functions are appended.
+ *
+ * @param[in] client Pointer to client structure.
+ * @param[out] stats Array receiving counters of functions.
+ * @param[in] max_count Size of the array.
+ * @param[out] untracked Count of calls not recorded because ERPC_CLIENT_METRICS_FUNCTIONS is too small, can be
+ * NULL.
+ *
+ * @return Count of functions written to the array.
+ */
+uint32_t erpc_client_get_metrics(erpc_client_t client, erpc_client_function_stats_t *stats, uint32_t max_count,
+                                 uint32_t *untracked);
+
+/*!
+ * @brief This function zeroes per function counters of client.
+ *
+ * @param[in] client Pointer to client structure.
+ */
+void erpc_client_reset_metrics(erpc_client_t client);
+#endif
+
 /*!
  * @brief This function de-initializes client.
  *
@@ -18,13 +18,6 @@
  * @file
  */
 
-////////////////////////////////////////////////////////////////////////////////
-// Types
-////////////////////////////////////////////////////////////////////////////////
-
-//! @brief Opaque MessageBufferFactory object type.
-typedef struct ErpcMessageBufferFactory *erpc_mbf_t;
-
 ////////////////////////////////////////////////////////////////////////////////
 // API
 ////////////////////////////////////////////////////////////////////////////////
@@ -74,6 +67,16 @@ erpc_mbf_t erpc_mbf_static_init(void);
  */
 void erpc_mbf_static_deinit(erpc_mbf_t mbf);
 
+/*!
+ * @brief Set MessageBuffer factory for fragments of fragmenting transport.
+ *
+ * Fragment buffers must suit the wrapped transport, e.g. the RPMsg factory for RPMsg-Lite zero copy transport.
+ *
+ * @param[in] transport Transport which was returned from erpc_transport_fragmenting_init().
+ * @param[in] fragmentMbf MessageBuffer factory creating fragment buffers.
+ */
+void erpc_transport_fragmenting_set_mbf(erpc_transport_t transport, erpc_mbf_t fragmentMbf);
+
 //@}
 
 #ifdef __cplusplus
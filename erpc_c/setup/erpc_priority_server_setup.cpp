@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_server_setup.h"
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_crc16.hpp"
+#include "erpc_manually_constructed.hpp"
+#include "erpc_message_buffer.hpp"
+#include "erpc_priority_server.hpp"
+#include "erpc_transport.hpp"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+// global server variables
+ERPC_MANUALLY_CONSTRUCTED_STATIC(PriorityServer, s_priorityServer);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(BasicCodecFactory, s_codecFactory);
+ERPC_MANUALLY_CONSTRUCTED_STATIC(Crc16, s_crc16);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_server_t erpc_priority_server_init(erpc_transport_t transport, erpc_mbf_t message_buffer_factory,
+                                        uint32_t workers, uint32_t dedicated_workers)
+{
+    erpc_assert(transport != NULL);
+    erpc_assert(message_buffer_factory != NULL);
+
+    Transport *castedTransport;
+    BasicCodecFactory *codecFactory;
+    Crc16 *crc16;
+    PriorityServer *priorityServer;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_codecFactory.isUsed() || s_crc16.isUsed() || s_priorityServer.isUsed())
+    {
+        priorityServer = NULL;
+    }
+    else
+    {
+        // Init factories.
+        s_codecFactory.construct();
+        codecFactory = s_codecFactory.get();
+
+        s_crc16.construct();
+        crc16 = s_crc16.get();
+
+        // Init the server.
+        s_priorityServer.construct();
+        priorityServer = s_priorityServer.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    // Init factories.
+    codecFactory = new BasicCodecFactory();
+
+    crc16 = new Crc16();
+
+    // Init the server.
+    priorityServer = new PriorityServer();
+
+    if ((codecFactory == NULL) || (crc16 == NULL) || (priorityServer == NULL))
+    {
+        if (codecFactory != NULL)
+        {
+            delete codecFactory;
+        }
+        if (crc16 != NULL)
+        {
+            delete crc16;
+        }
+        if (priorityServer != NULL)
+        {
+            delete priorityServer;
+        }
+        priorityServer = NULL;
+    }
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    if ((priorityServer != NULL) && (priorityServer->setWorkers(workers, dedicated_workers) != kErpcStatus_Success))
+    {
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+        s_crc16.destroy();
+        s_codecFactory.destroy();
+        s_priorityServer.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+        delete codecFactory;
+        delete crc16;
+        delete priorityServer;
+#endif
+        priorityServer = NULL;
+    }
+
+    if (priorityServer != NULL)
+    {
+        // Init server with the provided transport.
+        castedTransport = reinterpret_cast<Transport *>(transport);
+        castedTransport->setCrc16(crc16);
+        priorityServer->setTransport(castedTransport);
+        priorityServer->setCodecFactory(codecFactory);
+        priorityServer->setMessageBufferFactory(reinterpret_cast<MessageBufferFactory *>(message_buffer_factory));
+    }
+
+    return reinterpret_cast<erpc_server_t>(static_cast<SimpleServer *>(priorityServer));
+}
+
+void erpc_priority_server_deinit(erpc_server_t server)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)server;
+    erpc_assert(reinterpret_cast<SimpleServer *>(server) == s_priorityServer.get());
+    s_priorityServer.destroy();
+    s_crc16.destroy();
+    s_codecFactory.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(server != NULL);
+    PriorityServer *priorityServer = static_cast<PriorityServer *>(reinterpret_cast<SimpleServer *>(server));
+    Crc16 *crc16 = priorityServer->getTransport()->getCrc16();
+    CodecFactory *codecFactory = priorityServer->getCodecFactory();
+
+    // Workers can still use codec factory until the server is destroyed.
+    delete priorityServer;
+    delete codecFactory;
+    delete crc16;
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+}
+
+void erpc_priority_server_set_admission_limit(erpc_server_t server, uint32_t max_requests)
+{
+    erpc_assert(server != NULL);
+
+    PriorityServer *priorityServer = static_cast<PriorityServer *>(reinterpret_cast<SimpleServer *>(server));
+
+    priorityServer->setAdmissionLimit(max_requests);
+}
+
+bool erpc_priority_server_set_worker_attributes(erpc_server_t server, uint32_t priority, uint32_t stack_size,
+                                               uint32_t cpu_mask)
+{
+    erpc_assert(server != NULL);
+
+    PriorityServer *priorityServer = static_cast<PriorityServer *>(reinterpret_cast<SimpleServer *>(server));
+
+    return priorityServer->setWorkerAttributes(priority, stack_size, cpu_mask) == kErpcStatus_Success;
+}
+
+void erpc_priority_server_get_shed_counts(erpc_server_t server, uint32_t *busy, uint32_t *dropped)
+{
+    erpc_assert(server != NULL);
+    erpc_assert(busy != NULL);
+    erpc_assert(dropped != NULL);
+
+    PriorityServer *priorityServer = static_cast<PriorityServer *>(reinterpret_cast<SimpleServer *>(server));
+
+    *busy = priorityServer->getBusyCount();
+    *dropped = priorityServer->getDroppedCount();
+}
@@ -15,6 +15,9 @@
 #include "erpc_manually_constructed.hpp"
 #include "erpc_message_buffer.hpp"
 #include "erpc_simple_server.hpp"
+#if ERPC_SERVER_METRICS
+#include "erpc_stats_service.hpp"
+#endif
 #include "erpc_transport.hpp"
 
 using namespace erpc;
@@ -27,6 +30,9 @@ using namespace erpc;
 ERPC_MANUALLY_CONSTRUCTED_STATIC(SimpleServer, s_server);
 ERPC_MANUALLY_CONSTRUCTED_STATIC(BasicCodecFactory, s_codecFactory);
 ERPC_MANUALLY_CONSTRUCTED_STATIC(Crc16, s_crc16);
+#if ERPC_SERVER_METRICS
+ERPC_MANUALLY_CONSTRUCTED_STATIC(StatsService, s_statsService);
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Code
@@ -186,6 +192,58 @@ bool erpc_server_add_message_logger(erpc_server_t server, erpc_transport_t trans
 
     return simpleServer->addMessageLogger(reinterpret_cast<Transport *>(transport));
 }
+
+#if ERPC_MESSAGE_LOGGING_ASYNC
+uint32_t erpc_server_get_dropped_log_messages(erpc_server_t server)
+{
+    erpc_assert(server != NULL);
+
+    SimpleServer *simpleServer = reinterpret_cast<SimpleServer *>(server);
+
+    return simpleServer->getDroppedCount();
+}
+#endif
+#endif
+
+#if ERPC_SERVER_METRICS
+void *erpc_stats_service_create(erpc_server_t server)
+{
+    erpc_assert(server != NULL);
+
+    SimpleServer *simpleServer = reinterpret_cast<SimpleServer *>(server);
+    StatsService *service;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_statsService.isUsed())
+    {
+        service = NULL;
+    }
+    else
+    {
+        s_statsService.construct(&simpleServer->getMetrics());
+        service = s_statsService.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    service = new StatsService(&simpleServer->getMetrics());
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    return service;
+}
+
+void erpc_stats_service_destroy(void *service)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)service;
+    erpc_assert(service == s_statsService.get());
+    s_statsService.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    delete static_cast<StatsService *>(service);
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+}
 #endif
 
 #if ERPC_PRE_POST_ACTION
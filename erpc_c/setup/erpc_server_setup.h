@@ -63,6 +63,70 @@ erpc_server_t erpc_server_init(erpc_transport_t transport, erpc_mbf_t message_bu
  */
 void erpc_server_deinit(erpc_server_t server);
 
+#if !ERPC_THREADS_IS(NONE)
+/*!
+ * @brief This function initializes priority scheduling server.
+ *
+ * Requests are received by the thread calling erpc_server_run() and served by worker threads in order of the
+ * priority of the invoked method (see the @priority annotation). Other erpc_server_* functions can be used with the
+ * returned server.
+ *
+ * @param[in] transport Initiated transport.
+ * @param[in] message_buffer_factory Initiated message buffer factory.
+ * @param[in] workers Count of worker threads serving all priorities.
+ * @param[in] dedicated_workers Count of worker threads serving only the highest priority, can be 0.
+ *
+ * @return erpc_server_t Pointer to server structure or NULL when it cannot be created.
+ */
+erpc_server_t erpc_priority_server_init(erpc_transport_t transport, erpc_mbf_t message_buffer_factory,
+                                        uint32_t workers, uint32_t dedicated_workers);
+
+/*!
+ * @brief This function de-initializes priority scheduling server.
+ *
+ * Waits until worker threads exit.
+ *
+ * @param[in] server Pointer to server structure.
+ */
+void erpc_priority_server_deinit(erpc_server_t server);
+
+/*!
+ * @brief This function sets admission limit of priority scheduling server.
+ *
+ * Requests over the limit are refused: clients get #kErpcStatus_Busy, oneway messages are dropped. Only priority
+ * scheduling server refuses requests, simple server never replies busy.
+ *
+ * @param[in] server Pointer to server structure.
+ * @param[in] max_requests Maximum count of queued and processed requests, 0 to block receiving instead of refusing.
+ */
+void erpc_priority_server_set_admission_limit(erpc_server_t server, uint32_t max_requests);
+
+/*!
+ * @brief This function sets attributes of worker threads of priority scheduling server.
+ *
+ * Must be called before the server is run. With pthreads, non zero priority selects real-time scheduling
+ * (ERPC_THREADS_SCHED_POLICY), which needs privilege; workers keep default scheduling without it.
+ *
+ * @param[in] server Pointer to server structure.
+ * @param[in] priority Priority of workers, 0 for default.
+ * @param[in] stack_size Stack size of workers (bytes for pthreads), 0 for default.
+ * @param[in] cpu_mask CPUs workers can run on, bit n for CPU n, 0 for all. Used by pthreads port only.
+ *
+ * @return True when attributes were set, false when workers are already running.
+ */
+bool erpc_priority_server_set_worker_attributes(erpc_server_t server, uint32_t priority, uint32_t stack_size,
+                                               uint32_t cpu_mask);
+
+/*!
+ * @brief This function returns counts of requests refused by priority scheduling server.
+ *
+ * @param[in] server Pointer to server structure.
+ * @param[out] busy Count of invocations answered with busy reply.
+ * @param[out] dropped Count of dropped oneway messages.
+ */
+void erpc_priority_server_get_shed_counts(erpc_server_t server, uint32_t *busy, uint32_t *dropped);
+#endif
+
 /*!
  * @brief This function adds service to server.
  *
@@ -92,6 +156,21 @@ void erpc_remove_service_from_server(erpc_server_t server, void *service);
  * @param[in] crcStart Set start number for crc.
  */
 void erpc_server_set_crc(erpc_server_t server, uint32_t crcStart);
+
+/*!
+ * @brief This function attaches server to loopback transport.
+ *
+ * Requests sent through the loopback transport are then processed by the server. The server must be initialized by
+ * erpc_server_init() with the same transport and the message buffer factory given to erpc_transport_loopback_init(),
+ * and does not have to be run. Priority scheduling server processes requests on its worker threads and is rejected.
+ *
+ * @param[in] transport Loopback transport.
+ * @param[in] server Server to process the requests.
+ *
+ * @return True when server was attached, false when it does not process requests synchronously or uses other message
+ * buffer factory.
+ */
+bool erpc_transport_loopback_set_server(erpc_transport_t transport, erpc_server_t server);
 //@}
 
 //! @name Server control
@@ -141,6 +220,40 @@ void erpc_server_stop(erpc_server_t server);
  * @retval False When transport wasn't added.
  */
 bool erpc_server_add_message_logger(erpc_server_t server, erpc_transport_t transport);
+
+#if ERPC_MESSAGE_LOGGING_ASYNC
+/*!
+ * @brief This function returns count of messages which loggers missed because the logging queue was full.
+ *
+ * @param[in] server Pointer to server structure.
+ *
+ * @return Count of dropped messages.
+ */
+uint32_t erpc_server_get_dropped_log_messages(erpc_server_t server);
+#endif
+#endif
+
+#if ERPC_SERVER_METRICS
+/*!
+ * @brief This function creates built-in service giving per method counters of server to remote clients.
+ *
+ * The service implements the eRPCStats interface of erpc_stats.erpc. Add it to the server by
+ * erpc_add_service_to_server().
+ *
+ * @param[in] server Pointer to server structure whose counters are served.
+ *
+ * @return Service object or NULL when it cannot be created.
+ */
+void *erpc_stats_service_create(erpc_server_t server);
+
+/*!
+ * @brief This function destroys service created by erpc_stats_service_create().
+ *
+ * Remove the service from the server first.
+ *
+ * @param[in] service Service to destroy.
+ */
+void erpc_stats_service_destroy(void *service);
 #endif
 
 #if ERPC_PRE_POST_ACTION
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_fragmenting_transport.hpp"
+#include "erpc_manually_constructed.hpp"
+#include "erpc_mbf_setup.h"
+#include "erpc_transport_setup.h"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ERPC_MANUALLY_CONSTRUCTED_STATIC(FragmentingTransport, s_fragmentingTransport);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_transport_t erpc_transport_fragmenting_init(erpc_transport_t transport, uint16_t mtu)
+{
+    FragmentingTransport *fragmentingTransport;
+
+    erpc_assert(transport != NULL);
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_fragmentingTransport.isUsed())
+    {
+        fragmentingTransport = NULL;
+    }
+    else
+    {
+        s_fragmentingTransport.construct(reinterpret_cast<Transport *>(transport), mtu);
+        fragmentingTransport = s_fragmentingTransport.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    fragmentingTransport = new FragmentingTransport(reinterpret_cast<Transport *>(transport), mtu);
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    return reinterpret_cast<erpc_transport_t>(fragmentingTransport);
+}
+
+void erpc_transport_fragmenting_set_mbf(erpc_transport_t transport, erpc_mbf_t fragmentMbf)
+{
+    erpc_assert(transport != NULL);
+    erpc_assert(fragmentMbf != NULL);
+
+    FragmentingTransport *fragmentingTransport = reinterpret_cast<FragmentingTransport *>(transport);
+
+    fragmentingTransport->setFragmentFactory(reinterpret_cast<MessageBufferFactory *>(fragmentMbf));
+}
+
+uint32_t erpc_transport_fragmenting_get_dropped(erpc_transport_t transport)
+{
+    erpc_assert(transport != NULL);
+
+    FragmentingTransport *fragmentingTransport = reinterpret_cast<FragmentingTransport *>(transport);
+
+    return fragmentingTransport->getDroppedCount();
+}
+
+void erpc_transport_fragmenting_deinit(erpc_transport_t transport)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)transport;
+    s_fragmentingTransport.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(transport != NULL);
+
+    FragmentingTransport *fragmentingTransport = reinterpret_cast<FragmentingTransport *>(transport);
+
+    delete fragmentingTransport;
+#endif
+}
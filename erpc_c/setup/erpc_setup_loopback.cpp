@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_loopback_transport.hpp"
+#include "erpc_manually_constructed.hpp"
+#include "erpc_server_setup.h"
+#include "erpc_transport_setup.h"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ERPC_MANUALLY_CONSTRUCTED_STATIC(LoopbackTransport, s_loopbackTransport);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_transport_t erpc_transport_loopback_init(erpc_mbf_t message_buffer_factory)
+{
+    erpc_assert(message_buffer_factory != NULL);
+
+    MessageBufferFactory *messageFactory = reinterpret_cast<MessageBufferFactory *>(message_buffer_factory);
+    LoopbackTransport *loopbackTransport;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_loopbackTransport.isUsed())
+    {
+        loopbackTransport = NULL;
+    }
+    else
+    {
+        s_loopbackTransport.construct(messageFactory);
+        loopbackTransport = s_loopbackTransport.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    loopbackTransport = new LoopbackTransport(messageFactory);
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    return reinterpret_cast<erpc_transport_t>(loopbackTransport);
+}
+
+bool erpc_transport_loopback_set_server(erpc_transport_t transport, erpc_server_t server)
+{
+    erpc_assert(transport != NULL);
+
+    LoopbackTransport *loopbackTransport = reinterpret_cast<LoopbackTransport *>(transport);
+
+    return loopbackTransport->setServer(reinterpret_cast<SimpleServer *>(server)) == kErpcStatus_Success;
+}
+
+void erpc_transport_loopback_deinit(erpc_transport_t transport)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)transport;
+    s_loopbackTransport.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(transport != NULL);
+
+    LoopbackTransport *loopbackTransport = reinterpret_cast<LoopbackTransport *>(transport);
+
+    delete loopbackTransport;
+#endif
+}
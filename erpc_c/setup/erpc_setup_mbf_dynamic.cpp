@@ -11,6 +11,7 @@
 #include "erpc_manually_constructed.hpp"
 #include "erpc_mbf_setup.h"
 #include "erpc_message_buffer.hpp"
+#include "erpc_port.h"
 
 #include <new>
 
@@ -29,7 +30,7 @@ class DynamicMessageBufferFactory : public MessageBufferFactory
 public:
     virtual MessageBuffer create(void)
     {
-        uint8_t *buf = new (nothrow) uint8_t[ERPC_DEFAULT_BUFFER_SIZE];
+        uint8_t *buf = static_cast<uint8_t *>(ERPC_MALLOC_TAGGED(ERPC_DEFAULT_BUFFER_SIZE, kErpcMemory_Buffers));
         return MessageBuffer(buf, ERPC_DEFAULT_BUFFER_SIZE);
     }
 
@@ -38,7 +39,7 @@ public:
         erpc_assert(buf != NULL);
         if (buf->get() != NULL)
         {
-            delete[] buf->get();
+            erpc_free(buf->get());
         }
     }
 };
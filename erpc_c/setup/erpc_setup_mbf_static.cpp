@@ -62,23 +62,23 @@ public:
 #if !ERPC_THREADS_IS(NONE)
         m_semaphore.get();
 #endif
-        while (((m_freeBufferBitmap[idx >> 3U] & (1U << (idx & 0x7U))) == 0U) && (idx < ERPC_DEFAULT_BUFFERS_COUNT))
+        while ((idx < ERPC_DEFAULT_BUFFERS_COUNT) && ((m_freeBufferBitmap[idx >> 3U] & (1U << (idx & 0x7U))) == 0U))
         {
             idx++;
         }
 
-        erpc_assert(idx < ERPC_DEFAULT_BUFFERS_COUNT);
-
-        m_freeBufferBitmap[idx >> 3U] &= ~(1U << (idx & 0x7U));
+        uint8_t *buf = NULL;
+        // All buffers in use, caller handles the empty buffer as memory error.
+        if (idx < ERPC_DEFAULT_BUFFERS_COUNT)
+        {
+            m_freeBufferBitmap[idx >> 3U] &= ~(1U << (idx & 0x7U));
+            buf = reinterpret_cast<uint8_t *>(m_buffers[idx]);
+        }
 #if !ERPC_THREADS_IS(NONE)
         m_semaphore.put();
 #endif
 
-        uint8_t *buf;
-        buf = reinterpret_cast<uint8_t *>(m_buffers[idx]);
-
-        erpc_assert(NULL != buf);
-        return MessageBuffer(buf, ERPC_DEFAULT_BUFFER_SIZE);
+        return MessageBuffer(buf, (buf != NULL) ? ERPC_DEFAULT_BUFFER_SIZE : 0U);
     }
 
     /*!
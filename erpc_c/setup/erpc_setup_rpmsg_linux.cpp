@@ -90,12 +90,23 @@ erpc_transport_t erpc_transport_rpmsg_linux_init(int16_t local_addr, int8_t type
     return transport;
 }
 
+void erpc_transport_rpmsg_linux_set_receive_fd(erpc_transport_t transport, int fd, bool is_notification,
+                                               uint32_t busy_poll_usecs)
+{
+    erpc_assert(transport != NULL);
+
+    RPMsgLinuxTransport *rpmsgTransport = reinterpret_cast<RPMsgLinuxTransport *>(transport);
+
+    rpmsgTransport->setReceiveFd(fd, is_notification);
+    rpmsgTransport->setBusyPoll(busy_poll_usecs);
+}
+
 void erpc_transport_rpmsg_linux_deinit(erpc_transport_t transport)
 {
 #if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
     (void)transport;
     s_endpoint.destroy();
-    s_transport.destroy();
+    s_rpmsgTransport.destroy();
 #elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
     erpc_assert(transport != NULL);
 
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_manually_constructed.hpp"
+#include "erpc_shm_transport.hpp"
+#include "erpc_transport_setup.h"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ERPC_MANUALLY_CONSTRUCTED_STATIC(ShmTransport, s_shmTransport);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_transport_t erpc_transport_shm_init(const char *name, uint32_t ringSize, bool isServer)
+{
+    erpc_transport_t transport;
+    ShmTransport *shmTransport;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_shmTransport.isUsed())
+    {
+        shmTransport = NULL;
+    }
+    else
+    {
+        s_shmTransport.construct(name, ringSize, isServer);
+        shmTransport = s_shmTransport.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    shmTransport = new ShmTransport(name, ringSize, isServer);
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    transport = reinterpret_cast<erpc_transport_t>(shmTransport);
+
+    if (shmTransport != NULL)
+    {
+        if (shmTransport->open() != kErpcStatus_Success)
+        {
+            erpc_transport_shm_deinit(transport);
+            transport = NULL;
+        }
+    }
+
+    return transport;
+}
+
+void erpc_transport_shm_close(erpc_transport_t transport)
+{
+    erpc_assert(transport != NULL);
+
+    ShmTransport *shmTransport = reinterpret_cast<ShmTransport *>(transport);
+
+    shmTransport->close();
+}
+
+void erpc_transport_shm_deinit(erpc_transport_t transport)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)transport;
+    s_shmTransport.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(transport != NULL);
+
+    ShmTransport *shmTransport = reinterpret_cast<ShmTransport *>(transport);
+
+    delete shmTransport;
+#endif
+}
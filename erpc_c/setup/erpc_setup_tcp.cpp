@@ -11,33 +11,62 @@
 #include "erpc_tcp_transport.hpp"
 #include "erpc_transport_setup.h"
 
+#if ERPC_THREADS_IS(PTHREADS)
+#include "erpc_threading.h"
+#endif
+
 using namespace erpc;
 
+#if ERPC_THREADS_IS(PTHREADS)
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Thread running one shard of shard group.
+ */
+struct TcpShardThread
+{
+    Thread thread;                /*!< Thread calling entry. */
+    erpc_tcp_shard_entry_t entry; /*!< Function serving the shard. */
+    void *context;                /*!< Argument of entry. */
+    erpc_transport_t transport;   /*!< Shard transport. */
+    uint32_t index;               /*!< Shard index in its group. */
+    TcpShardThread *next;         /*!< Next shard of group while the group is created. */
+};
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
 
-ERPC_MANUALLY_CONSTRUCTED_STATIC(TCPTransport, s_tcpTransport);
+ERPC_STATIC_OBJECT_POOL(TCPTransport, s_tcpTransportPool, ERPC_TCP_TRANSPORTS_COUNT);
+
+#if ERPC_THREADS_IS(PTHREADS)
+ERPC_STATIC_OBJECT_POOL(TcpShardThread, s_tcpShardThreadPool, ERPC_TCP_TRANSPORTS_COUNT);
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Code
 ////////////////////////////////////////////////////////////////////////////////
 
-erpc_transport_t erpc_transport_tcp_init(const char *host, uint16_t port, bool isServer)
+/*!
+ * @brief Create and open TCP transport.
+ *
+ * @param[in] host hostname/IP address to listen on or server to connect to
+ * @param[in] port port to listen on or server to connect to
+ * @param[in] isServer true if we are a server
+ * @param[in] reusePort true to share the listening port with other transports
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+static erpc_transport_t createTcpTransport(const char *host, uint16_t port, bool isServer, bool reusePort)
 {
     erpc_transport_t transport;
     TCPTransport *tcpTransport;
 
 #if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
-    if (s_tcpTransport.isUsed())
-    {
-        tcpTransport = NULL;
-    }
-    else
-    {
-        s_tcpTransport.construct(host, port, isServer);
-        tcpTransport = s_tcpTransport.get();
-    }
+    tcpTransport = s_tcpTransportPool.create(host, port, isServer);
 #elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
     tcpTransport = new TCPTransport(host, port, isServer);
 #else
@@ -48,6 +77,7 @@ erpc_transport_t erpc_transport_tcp_init(const char *host, uint16_t port, bool i
 
     if (tcpTransport != NULL)
     {
+        tcpTransport->setReusePort(reusePort);
         if (tcpTransport->open() != kErpcStatus_Success)
         {
             erpc_transport_tcp_deinit(transport);
@@ -58,6 +88,166 @@ erpc_transport_t erpc_transport_tcp_init(const char *host, uint16_t port, bool i
     return transport;
 }
 
+erpc_transport_t erpc_transport_tcp_init(const char *host, uint16_t port, bool isServer)
+{
+    return createTcpTransport(host, port, isServer, false);
+}
+
+erpc_transport_t erpc_transport_tcp_shard_init(const char *host, uint16_t port)
+{
+    return createTcpTransport(host, port, true, true);
+}
+
+#if ERPC_THREADS_IS(PTHREADS)
+/*!
+ * @brief Select CPU of shard.
+ *
+ * @param[in] cpuMask CPUs to spread shards on, zero to not pin.
+ * @param[in] index Shard index, wraps around CPUs in mask.
+ *
+ * @return Mask with single CPU, zero when cpuMask is zero.
+ */
+static uint32_t shardCpuMask(uint32_t cpuMask, uint32_t index)
+{
+    uint32_t cpus = static_cast<uint32_t>(__builtin_popcount(cpuMask));
+    uint32_t mask = cpuMask;
+
+    if (cpus > 0U)
+    {
+        for (index %= cpus; index > 0U; --index)
+        {
+            mask &= mask - 1U;
+        }
+        mask &= ~(mask - 1U);
+    }
+
+    return mask;
+}
+
+/*!
+ * @brief Free shard thread slot.
+ *
+ * @param[in] shard Shard thread slot.
+ */
+static void destroyShardThread(TcpShardThread *shard)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    s_tcpShardThreadPool.destroy(shard);
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    delete shard;
+#endif
+}
+
+/*!
+ * @brief Serve shard and free its resources when entry returns.
+ *
+ * @param[in] arg Shard thread slot.
+ */
+static void tcpShardThreadEntry(void *arg)
+{
+    TcpShardThread *shard = reinterpret_cast<TcpShardThread *>(arg);
+
+    shard->entry(shard->transport, shard->index, shard->context);
+
+    erpc_transport_tcp_close(shard->transport);
+    erpc_transport_tcp_deinit(shard->transport);
+    // Thread does not touch its object once entry returns.
+    destroyShardThread(shard);
+}
+#endif
+
+bool erpc_transport_tcp_shard_group_init(const char *host, uint16_t port, uint32_t count, uint32_t cpuMask,
+                                         erpc_tcp_shard_entry_t entry, void *context)
+{
+#if ERPC_THREADS_IS(PTHREADS)
+    TcpShardThread *shards = NULL;
+    TcpShardThread *shard;
+    bool retVal = (entry != NULL) && (count > 0U);
+
+    // Create everything first, so group starts either whole or not at all.
+    for (uint32_t i = 0U; retVal && (i < count); ++i)
+    {
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+        shard = s_tcpShardThreadPool.create();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+        shard = new TcpShardThread();
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+        if (shard == NULL)
+        {
+            retVal = false;
+        }
+        else
+        {
+            shard->transport = createTcpTransport(host, port, true, true);
+            if (shard->transport == NULL)
+            {
+                destroyShardThread(shard);
+                retVal = false;
+            }
+            else
+            {
+                shard->entry = entry;
+                shard->context = context;
+                shard->index = i;
+                shard->next = shards;
+                shards = shard;
+            }
+        }
+    }
+
+    while (shards != NULL)
+    {
+        shard = shards;
+        shards = shard->next;
+        if (retVal)
+        {
+            uint32_t mask = shardCpuMask(cpuMask, shard->index);
+
+            // Keep reading of connections on the CPU of the shard which serves them.
+            (void)erpc_transport_tcp_set_thread_attributes(shard->transport, 0U, mask);
+            shard->thread.init(tcpShardThreadEntry);
+            (void)shard->thread.setCpuAffinity(mask);
+            shard->thread.start(shard);
+        }
+        else
+        {
+            erpc_transport_tcp_close(shard->transport);
+            erpc_transport_tcp_deinit(shard->transport);
+            destroyShardThread(shard);
+        }
+    }
+
+    return retVal;
+#else
+    (void)host;
+    (void)port;
+    (void)count;
+    (void)cpuMask;
+    (void)entry;
+    (void)context;
+
+    return false;
+#endif
+}
+
+bool erpc_transport_tcp_set_thread_attributes(erpc_transport_t transport, uint32_t priority, uint32_t cpuMask)
+{
+    erpc_assert(transport != NULL);
+
+#if ERPC_THREADS_IS(PTHREADS)
+    TCPTransport *tcpTransport = reinterpret_cast<TCPTransport *>(transport);
+
+    return tcpTransport->setServerThreadAttributes(priority, cpuMask);
+#else
+    (void)priority;
+    (void)cpuMask;
+
+    return false;
+#endif
+}
+
 void erpc_transport_tcp_close(erpc_transport_t transport)
 {
     erpc_assert(transport != NULL);
@@ -70,8 +260,9 @@ void erpc_transport_tcp_close(erpc_transport_t transport)
 void erpc_transport_tcp_deinit(erpc_transport_t transport)
 {
 #if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
-    (void)transport;
-    s_tcpTransport.destroy();
+    erpc_assert(transport != NULL);
+
+    s_tcpTransportPool.destroy(reinterpret_cast<TCPTransport *>(transport));
 #elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
     erpc_assert(transport != NULL);
 
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_manually_constructed.hpp"
+#include "erpc_transport_setup.h"
+#include "erpc_udp_transport.hpp"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ERPC_MANUALLY_CONSTRUCTED_STATIC(UdpTransport, s_udpTransport);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_transport_t erpc_transport_udp_init(const char *host, uint16_t port, bool isServer)
+{
+    erpc_transport_t transport;
+    UdpTransport *udpTransport;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_udpTransport.isUsed())
+    {
+        udpTransport = NULL;
+    }
+    else
+    {
+        s_udpTransport.construct(host, port, isServer);
+        udpTransport = s_udpTransport.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    udpTransport = new UdpTransport(host, port, isServer);
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    transport = reinterpret_cast<erpc_transport_t>(udpTransport);
+
+    if (udpTransport != NULL)
+    {
+        if (udpTransport->open() != kErpcStatus_Success)
+        {
+            erpc_transport_udp_deinit(transport);
+            transport = NULL;
+        }
+    }
+
+    return transport;
+}
+
+bool erpc_transport_udp_set_send_batch(erpc_transport_t transport, uint32_t count)
+{
+    erpc_assert(transport != NULL);
+
+    UdpTransport *udpTransport = reinterpret_cast<UdpTransport *>(transport);
+
+    return udpTransport->setSendBatch(count) == kErpcStatus_Success;
+}
+
+void erpc_transport_udp_flush(erpc_transport_t transport)
+{
+    erpc_assert(transport != NULL);
+
+    UdpTransport *udpTransport = reinterpret_cast<UdpTransport *>(transport);
+
+    (void)udpTransport->flush();
+}
+
+void erpc_transport_udp_deinit(erpc_transport_t transport)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)transport;
+    s_udpTransport.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(transport != NULL);
+
+    UdpTransport *udpTransport = reinterpret_cast<UdpTransport *>(transport);
+
+    delete udpTransport;
+#endif
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_manually_constructed.hpp"
+#include "erpc_transport_setup.h"
+#include "erpc_unix_transport.hpp"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+ERPC_MANUALLY_CONSTRUCTED_STATIC(UnixSocketTransport, s_unixTransport);
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+erpc_transport_t erpc_transport_unix_init(const char *path, bool isServer)
+{
+    erpc_transport_t transport;
+    UnixSocketTransport *unixTransport;
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    if (s_unixTransport.isUsed())
+    {
+        unixTransport = NULL;
+    }
+    else
+    {
+        s_unixTransport.construct(path, isServer);
+        unixTransport = s_unixTransport.get();
+    }
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    unixTransport = new UnixSocketTransport(path, isServer);
+#else
+#error "Unknown eRPC allocation policy!"
+#endif
+
+    transport = reinterpret_cast<erpc_transport_t>(unixTransport);
+
+    if (unixTransport != NULL)
+    {
+        if (unixTransport->open() != kErpcStatus_Success)
+        {
+            erpc_transport_unix_deinit(transport);
+            transport = NULL;
+        }
+    }
+
+    return transport;
+}
+
+void erpc_transport_unix_close(erpc_transport_t transport)
+{
+    erpc_assert(transport != NULL);
+
+    UnixSocketTransport *unixTransport = reinterpret_cast<UnixSocketTransport *>(transport);
+
+    unixTransport->close(true);
+}
+
+void erpc_transport_unix_deinit(erpc_transport_t transport)
+{
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+    (void)transport;
+    s_unixTransport.destroy();
+#elif ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_DYNAMIC
+    erpc_assert(transport != NULL);
+
+    UnixSocketTransport *unixTransport = reinterpret_cast<UnixSocketTransport *>(transport);
+
+    delete unixTransport;
+#endif
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_transport.hpp"
+#include "erpc_transport_setup.h"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+void erpc_transport_get_stats(erpc_transport_t transport, erpc_transport_stats_t *stats)
+{
+    erpc_assert(transport != NULL);
+    erpc_assert(stats != NULL);
+
+#if ERPC_TRANSPORT_STATS
+    reinterpret_cast<Transport *>(transport)->getStats(stats);
+#else
+    (void)transport;
+    (void)memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+void erpc_transport_reset_stats(erpc_transport_t transport)
+{
+    erpc_assert(transport != NULL);
+
+#if ERPC_TRANSPORT_STATS
+    reinterpret_cast<Transport *>(transport)->resetStats();
+#else
+    (void)transport;
+#endif
+}
@@ -23,6 +23,8 @@
 
 //! @brief Opaque transport object type.
 typedef struct ErpcTransport *erpc_transport_t;
+//! @brief Opaque MessageBufferFactory object type, created by functions of erpc_mbf_setup.h.
+typedef struct ErpcMessageBufferFactory *erpc_mbf_t;
 //! @brief Ready callback object type for RPMsg-Lite transport.
 typedef void (*rpmsg_ready_cb)(void);
 
@@ -37,6 +39,8 @@ extern "C" {
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "erpc_transport_stats.h"
+
 //! @name Transport setup
 //@{
 
@@ -204,6 +208,23 @@ void erpc_transport_mu_deinit(erpc_transport_t transport);
  */
 erpc_transport_t erpc_transport_rpmsg_linux_init(int16_t local_addr, int8_t type, int16_t remote_addr);
 
+/*!
+ * @brief Set file descriptor to wait on for received messages.
+ *
+ * Without it the transport polls the endpoint every microsecond. With it the
+ * transport sleeps in poll() until the descriptor is readable. It can be the
+ * endpoint device descriptor, which stops being readable once the message is
+ * received, or a notification descriptor (eventfd, pipe) signalled by the
+ * endpoint layer, which the transport drains after each wake up.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ * @param[in] fd Descriptor to wait on, -1 to poll the endpoint.
+ * @param[in] is_notification True when fd is a notification descriptor, false for the endpoint device.
+ * @param[in] busy_poll_usecs Time to poll the endpoint before going to sleep, 0 to sleep immediately.
+ */
+void erpc_transport_rpmsg_linux_set_receive_fd(erpc_transport_t transport, int fd, bool is_notification,
+                                               uint32_t busy_poll_usecs);
+
 /*!
  * @brief Deinitialize an Linux RPMSG endpoint transport.
  *
@@ -463,6 +484,68 @@ void erpc_transport_spidev_master_deinit(erpc_transport_t transport);
  */
 erpc_transport_t erpc_transport_tcp_init(const char *host, uint16_t port, bool isServer);
 
+/*!
+ * @brief Create and open one shard of a TCP server listening on a shared port.
+ *
+ * Every call creates a server transport with its own listening socket bound to the same port
+ * (SO_REUSEPORT), so the kernel spreads incoming connections between the shards. Pair each shard
+ * with its own message buffer factory and server (erpc_server_init()) and run it from its own
+ * thread; connections then never migrate between shards. With static allocation policy at most
+ * #ERPC_TCP_TRANSPORTS_COUNT TCP transports, shards included, can exist at the same time.
+ *
+ * @param[in] host hostname/IP address to listen on
+ * @param[in] port port shared by all shards
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_tcp_shard_init(const char *host, uint16_t port);
+
+/*!
+ * @brief Function serving one shard of TCP shard group.
+ *
+ * @param[in] transport Shard transport, closed and freed when the function returns.
+ * @param[in] index Shard index in its group, from 0.
+ * @param[in] context Argument passed to erpc_transport_tcp_shard_group_init().
+ */
+typedef void (*erpc_tcp_shard_entry_t)(erpc_transport_t transport, uint32_t index, void *context);
+
+/*!
+ * @brief Create TCP shards listening on a shared port and serve each from its own pinned thread.
+ *
+ * Creates count shards as erpc_transport_tcp_shard_init() does and starts a thread for each, which calls
+ * entry with the shard transport. Shard n and its connection reading thread are pinned to the n-th CPU set in
+ * cpuMask, wrapping around when there are more shards than CPUs, so a connection is read and served on one core.
+ * The entry typically builds its own message buffer factory and server around the transport and runs it; with
+ * static allocation policy there is only one erpc_server_init() server, use C++ servers then. Either all shards
+ * start or none. With static allocation policy shards of all groups and other TCP transports together are limited by
+ * #ERPC_TCP_TRANSPORTS_COUNT. Only available with pthreads.
+ *
+ * @param[in] host hostname/IP address to listen on
+ * @param[in] port port shared by all shards
+ * @param[in] count Number of shards.
+ * @param[in] cpuMask CPUs to spread shards on, bit n for CPU n, 0 to not pin shards.
+ * @param[in] entry Function serving a shard.
+ * @param[in] context Argument passed to entry.
+ *
+ * @return Return false when shards cannot be created or threads are not pthreads.
+ */
+bool erpc_transport_tcp_shard_group_init(const char *host, uint16_t port, uint32_t count, uint32_t cpuMask,
+                                         erpc_tcp_shard_entry_t entry, void *context);
+
+/*!
+ * @brief Set scheduling of TCP server thread.
+ *
+ * Server thread accepting and reading connections is started by init function, its priority and CPU affinity are
+ * changed immediately. Non zero priority selects real-time scheduling, which needs privilege.
+ *
+ * @param[in] transport Server transport which was returned from init function.
+ * @param[in] priority Thread priority, 0 for default scheduling.
+ * @param[in] cpuMask CPUs the thread can run on, bit n for CPU n, 0 for all.
+ *
+ * @return Return false when the system refused the setting or threads are not pthreads.
+ */
+bool erpc_transport_tcp_set_thread_attributes(erpc_transport_t transport, uint32_t priority, uint32_t cpuMask);
+
 /*!
  * @brief Close TCP connection
  *
@@ -486,6 +569,195 @@ void erpc_transport_tcp_deinit(erpc_transport_t transport);
 
 //@}
 
+//! @name Unix domain socket transport setup
+//@{
+
+/*!
+ * @brief Create and open Unix domain socket transport
+ *
+ * Uses SOCK_SEQPACKET socket, each message is sent as one packet without framing.
+ * For server, remove stale socket file, create a listen socket and wait for connections
+ * For client, connect to server
+ *
+ * @param[in] path file system path of the socket
+ * @param[in] isServer true if we are a server
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_unix_init(const char *path, bool isServer);
+
+/*!
+ * @brief Close Unix domain socket connection
+ *
+ * For server, stop listening and close all sockets. Like the TCP transport, server
+ * exits only after next accept() returns.
+ * For client, close server connection
+ *
+ * @param[in] transport Transport which was returned from init function.
+ */
+void erpc_transport_unix_close(erpc_transport_t transport);
+
+/*!
+ * @brief Deinitialize Unix domain socket transport.
+ *
+ * @param[in] transport Transport which was initialized with init function.
+ */
+void erpc_transport_unix_deinit(erpc_transport_t transport);
+
+//@}
+
+//! @name UDP transport setup
+//@{
+
+/*!
+ * @brief Create and open UDP transport for oneway functions.
+ *
+ * Each message is sent as one datagram with a sequence number and optional CRC. Lost datagrams are not
+ * retransmitted, so only oneway functions can be called over this transport. Client fails other calls with
+ * #kErpcStatus_InvalidArgument and server drops them.
+ * For server, bind to the given address; credit messages are sent to the last sender.
+ * For client, send to the given server address.
+ *
+ * @param[in] host Host name or address to bind (server) or send to (client).
+ * @param[in] port Port number.
+ * @param[in] isServer true if we are a server.
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_udp_init(const char *host, uint16_t port, bool isServer);
+
+/*!
+ * @brief Set count of messages gathered before sending them by one sendmmsg() call.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ * @param[in] count Count of messages in one batch, 1 to #ERPC_UDP_BATCH_SIZE. 1 sends each message immediately.
+ *
+ * @return Return false when count is out of range.
+ */
+bool erpc_transport_udp_set_send_batch(erpc_transport_t transport, uint32_t count);
+
+/*!
+ * @brief Send messages gathered for the current batch.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ */
+void erpc_transport_udp_flush(erpc_transport_t transport);
+
+/*!
+ * @brief Deinitialize UDP transport.
+ *
+ * @param[in] transport Transport which was initialized with init function.
+ */
+void erpc_transport_udp_deinit(erpc_transport_t transport);
+
+//@}
+
+//! @name Shared memory transport setup
+//@{
+
+/*!
+ * @brief Create and open shared memory transport
+ *
+ * For processes on the same Linux host. Messages are passed through lock-free rings
+ * in a POSIX shared memory object, the kernel is entered only to wake up a sleeping peer.
+ * For server, create the shared memory object (replacing stale one)
+ * For client, map the object created by server
+ *
+ * @param[in] name shared memory object name, starting with '/'
+ * @param[in] ringSize size of ring for each direction in bytes, power of two (server only)
+ * @param[in] isServer true if we are a server
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_shm_init(const char *name, uint32_t ringSize, bool isServer);
+
+/*!
+ * @brief Close shared memory connection
+ *
+ * Wakes up both sides, their pending and following send and receive calls fail.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ */
+void erpc_transport_shm_close(erpc_transport_t transport);
+
+/*!
+ * @brief Deinitialize shared memory transport.
+ *
+ * Unmaps the shared memory, server also removes the shared memory object.
+ *
+ * @param[in] transport Transport which was initialized with init function.
+ */
+void erpc_transport_shm_deinit(erpc_transport_t transport);
+
+//@}
+
+//! @name Loopback transport setup
+//@{
+
+/*!
+ * @brief Create loopback transport.
+ *
+ * The same transport is used to initialize both client and server in one thread.
+ * Each request is processed by the server synchronously in the sending thread,
+ * without copying messages. Attach the server with erpc_transport_loopback_set_server().
+ *
+ * Message buffers are exchanged between client and server instead of copied, each side disposes buffers created by
+ * the other one. Both must therefore be initialized with the factory given here, a server with other factory is
+ * rejected when attached. Spare buffers kept by the transport are disposed by erpc_transport_loopback_deinit().
+ *
+ * @param[in] message_buffer_factory Message buffer factory of both client and server.
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_loopback_init(erpc_mbf_t message_buffer_factory);
+
+/*!
+ * @brief Deinitialize loopback transport.
+ *
+ * @param[in] transport Transport which was initialized with init function.
+ */
+void erpc_transport_loopback_deinit(erpc_transport_t transport);
+
+//@}
+
+//! @name Fragmenting transport setup
+//@{
+
+/*!
+ * @brief Create transport sending messages as fragments over another transport.
+ *
+ * Allows messages bigger than buffers of transports with small MTU (e.g. RPMsg, SPI, I2C). Client and server are
+ * initialized with the returned transport and a message buffer factory of the full message size. Fragment buffers
+ * are set by erpc_transport_fragmenting_set_mbf() before first use. The wrapped transport must deliver fragments in
+ * order.
+ *
+ * @param[in] transport Transport carrying fragments.
+ * @param[in] mtu Maximum size of one fragment including 6 bytes of fragment header.
+ *
+ * @return Return NULL or erpc_transport_t instance pointer.
+ */
+erpc_transport_t erpc_transport_fragmenting_init(erpc_transport_t transport, uint16_t mtu);
+
+/*!
+ * @brief Return count of received messages which were dropped.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ *
+ * @return Count of messages with lost fragments or too big for the receive buffer.
+ */
+uint32_t erpc_transport_fragmenting_get_dropped(erpc_transport_t transport);
+
+/*!
+ * @brief Deinitialize fragmenting transport.
+ *
+ * The wrapped transport is not deinitialized.
+ *
+ * @param[in] transport Transport which was initialized with init function.
+ */
+void erpc_transport_fragmenting_deinit(erpc_transport_t transport);
+
+//@}
+
 //! @name CMSIS UART transport setup
 //@{
 
@@ -595,6 +867,29 @@ void erpc_transport_rpmsg_sock_deinit(erpc_transport_t transport);
 
 //@}
 
+//! @name Transport statistics
+//@{
+
+/*!
+ * @brief Read counters of a transport.
+ *
+ * Counters are kept only when ERPC_TRANSPORT_STATS is enabled, otherwise all are returned as zero. Which counters a
+ * transport fills is described at erpc_transport_stats_t.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ * @param[out] stats Filled with counters of the transport.
+ */
+void erpc_transport_get_stats(erpc_transport_t transport, erpc_transport_stats_t *stats);
+
+/*!
+ * @brief Set all counters of a transport to zero.
+ *
+ * @param[in] transport Transport which was returned from init function.
+ */
+void erpc_transport_reset_stats(erpc_transport_t transport);
+
+//@}
+
 
 //@}
 
@@ -12,63 +12,97 @@
 
 using namespace erpc;
 
+// Slot counters wrap around at 2^32, slot index stays continuous only for power of two slot count.
+#if (ERPC_INTER_THREAD_BUFFER_SLOTS & (ERPC_INTER_THREAD_BUFFER_SLOTS - 1U)) != 0U
+#error "ERPC_INTER_THREAD_BUFFER_SLOTS must be power of two."
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Code
 ////////////////////////////////////////////////////////////////////////////////
 
-InterThreadBufferTransport::~InterThreadBufferTransport(void) {}
-
-void InterThreadBufferTransport::linkWithPeer(InterThreadBufferTransport *peer)
+InterThreadBufferTransport::~InterThreadBufferTransport(void)
 {
-    m_peer = peer;
-    peer->m_peer = this;
+    uint32_t i;
 
-    if (!m_state)
+    if (m_messageFactory != NULL)
     {
-        if (peer->m_state == NULL)
-        {
-            m_state = new SharedState;
-            peer->m_state = m_state;
-        }
-        else
+        for (i = 0U; i < ERPC_INTER_THREAD_BUFFER_SLOTS; ++i)
         {
-            m_state = peer->m_state;
+            if (m_inSlots[i].get() != NULL)
+            {
+                m_messageFactory->dispose(&m_inSlots[i]);
+            }
         }
     }
 }
 
-erpc_status_t InterThreadBufferTransport::receive(MessageBuffer *message)
+void InterThreadBufferTransport::linkWithPeer(InterThreadBufferTransport *peer)
 {
-    erpc_assert(m_state && m_peer);
+    m_peer = peer;
+    peer->m_peer = this;
+}
 
-    m_inSem.get();
+bool InterThreadBufferTransport::hasMessage(void)
+{
+    return __atomic_load_n(&m_inHead, __ATOMIC_ACQUIRE) != m_inTail;
+}
 
-    m_state->m_mutex.lock();
+erpc_status_t InterThreadBufferTransport::receive(MessageBuffer *message)
+{
+    erpc_assert(m_peer != NULL);
 
-    erpc_assert(m_inBuffer != NULL);
-    message->copy(m_inBuffer);
-    m_inBuffer = NULL;
+    uint32_t tail = m_inTail;
 
-    m_outSem.put();
+    while (__atomic_load_n(&m_inHead, __ATOMIC_ACQUIRE) == tail)
+    {
+        // Announce sleeping before the last check, sender checks the flag after publishing a message.
+        __atomic_store_n(&m_receiverWaiting, 1U, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&m_inHead, __ATOMIC_SEQ_CST) == tail)
+        {
+            m_inSem.get();
+        }
+        __atomic_store_n(&m_receiverWaiting, 0U, __ATOMIC_SEQ_CST);
+    }
+
+    // Take the pending message and leave the given buffer as spare for the sender.
+    message->swap(&m_inSlots[tail % ERPC_INTER_THREAD_BUFFER_SLOTS]);
+    __atomic_store_n(&m_inTail, tail + 1U, __ATOMIC_SEQ_CST);
 
-    m_state->m_mutex.unlock();
+    if (__atomic_exchange_n(&m_senderWaiting, 0U, __ATOMIC_SEQ_CST) != 0U)
+    {
+        m_spaceSem.put();
+    }
 
     return kErpcStatus_Success;
 }
 
 erpc_status_t InterThreadBufferTransport::send(MessageBuffer *message)
 {
-    erpc_assert((m_state != NULL) && (m_peer != NULL));
+    erpc_assert(m_peer != NULL);
 
-    m_peer->m_outSem.get();
+    InterThreadBufferTransport *peer = m_peer;
+    uint32_t head = peer->m_inHead;
 
-    m_state->m_mutex.lock();
+    while ((head - __atomic_load_n(&peer->m_inTail, __ATOMIC_ACQUIRE)) == ERPC_INTER_THREAD_BUFFER_SLOTS)
+    {
+        // Announce sleeping before the last check, receiver checks the flag after freeing a slot.
+        __atomic_store_n(&peer->m_senderWaiting, 1U, __ATOMIC_SEQ_CST);
+        if ((head - __atomic_load_n(&peer->m_inTail, __ATOMIC_SEQ_CST)) == ERPC_INTER_THREAD_BUFFER_SLOTS)
+        {
+            peer->m_spaceSem.get();
+        }
+        __atomic_store_n(&peer->m_senderWaiting, 0U, __ATOMIC_SEQ_CST);
+    }
 
-    erpc_assert(m_peer->m_inBuffer == NULL);
-    m_peer->m_inBuffer = const_cast<MessageBuffer *>(message);
-    m_peer->m_inSem.put();
+    // Hand the message over and continue with the spare buffer of the slot.
+    message->swap(&peer->m_inSlots[head % ERPC_INTER_THREAD_BUFFER_SLOTS]);
+    __atomic_store_n(&peer->m_inHead, head + 1U, __ATOMIC_SEQ_CST);
 
-    m_state->m_mutex.unlock();
+    if (__atomic_exchange_n(&peer->m_receiverWaiting, 0U, __ATOMIC_SEQ_CST) != 0U)
+    {
+        peer->m_inSem.put();
+    }
 
     return kErpcStatus_Success;
 }
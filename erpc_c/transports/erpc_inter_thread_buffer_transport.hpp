@@ -10,6 +10,7 @@
 #ifndef _EMBEDDED_RPC__INTER_THREAD_BUFFER_TRANSPORT_H_
 #define _EMBEDDED_RPC__INTER_THREAD_BUFFER_TRANSPORT_H_
 
+#include "erpc_config_internal.h"
 #include "erpc_message_buffer.hpp"
 #include "erpc_threading.h"
 #include "erpc_transport.hpp"
@@ -35,9 +36,17 @@ namespace erpc {
  * created on their respective threads, but the send() and receive() calls must be
  * invoked on the appropriate thread.
  *
- * Only a single message may be pending for each of the two threads. If a message is
- * pending for a thread and another is sent, then the sender will block until the
- * currently pending message is received.
+ * Messages are not copied. Each side has a lock-free single producer single consumer
+ * ring of #ERPC_INTER_THREAD_BUFFER_SLOTS slots, so up to that many messages may be
+ * pending for each of the two threads and a sender blocks only when all slots are full.
+ * Sending exchanges the sent buffer for a spare buffer left in the slot by an earlier
+ * receive (or for an empty buffer), receiving exchanges the given buffer for the pending
+ * one. Semaphores are used only to put a side to sleep on an empty or full ring, the
+ * peer signals them only when that side announced it is going to sleep.
+ *
+ * Buffers migrate between the two sides, so both sides must use the same message buffer
+ * factory. Set it by setMessageBufferFactory() to have buffers left in the slots disposed
+ * when the transport is destroyed.
  *
  * @ingroup itbp_transport
  */
@@ -45,29 +54,44 @@ class InterThreadBufferTransport : public Transport
 {
 public:
     InterThreadBufferTransport(void) :
-    Transport(), m_state(NULL), m_peer(NULL), m_inSem(), m_outSem(1), m_inBuffer(NULL)
+    Transport(), m_peer(NULL), m_messageFactory(NULL), m_inSem(0), m_spaceSem(0), m_inHead(0), m_inTail(0),
+    m_receiverWaiting(0), m_senderWaiting(0)
     {
     }
+
+    /*!
+     * @brief Destructor.
+     *
+     * Disposes pending messages and spare buffers left in the slots through the message buffer factory.
+     */
     virtual ~InterThreadBufferTransport(void);
 
     void linkWithPeer(InterThreadBufferTransport *peer);
 
+    /*!
+     * @brief Set factory of the buffers exchanged with the peer.
+     *
+     * @param[in] messageFactory Message buffer factory used by both sides.
+     */
+    void setMessageBufferFactory(MessageBufferFactory *messageFactory) { m_messageFactory = messageFactory; }
+
     virtual erpc_status_t receive(MessageBuffer *message) override;
     virtual erpc_status_t send(MessageBuffer *message) override;
 
+    virtual bool hasMessage(void) override;
+
     virtual int32_t getAvailable(void) const { return 0; }
 
 protected:
-    struct SharedState
-    {
-        Mutex m_mutex;
-    };
-
-    SharedState *m_state;               /*!< */
-    InterThreadBufferTransport *m_peer; /*!< */
-    Semaphore m_inSem;                  /*!< */
-    Semaphore m_outSem;                 /*!< */
-    MessageBuffer *m_inBuffer;          /*!< */
+    InterThreadBufferTransport *m_peer;                      /*!< Linked transport of the other thread. */
+    MessageBufferFactory *m_messageFactory;                  /*!< Factory disposing buffers left in slots. */
+    Semaphore m_inSem;                                       /*!< Wakes own thread sleeping on empty m_inSlots. */
+    Semaphore m_spaceSem;                                    /*!< Wakes peer's thread sleeping on full m_inSlots. */
+    MessageBuffer m_inSlots[ERPC_INTER_THREAD_BUFFER_SLOTS]; /*!< Pending messages, or spare buffers in free slots. */
+    uint32_t m_inHead;          /*!< Count of filled slots, written by peer's thread only, accessed atomically. */
+    uint32_t m_inTail;          /*!< Count of received slots, written by own thread only, accessed atomically. */
+    uint32_t m_receiverWaiting; /*!< Own thread goes to sleep on m_inSem, accessed atomically. */
+    uint32_t m_senderWaiting;   /*!< Peer's thread goes to sleep on m_spaceSem, accessed atomically. */
 };
 
 } // namespace erpc
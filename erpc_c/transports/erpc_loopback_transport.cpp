@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_loopback_transport.hpp"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+LoopbackTransport::LoopbackTransport(MessageBufferFactory *messageFactory) :
+Transport(), m_messageFactory(messageFactory), m_server(NULL), m_dispatching(false), m_hasRequest(false),
+m_hasReply(false), m_request(), m_reply()
+{
+}
+
+LoopbackTransport::~LoopbackTransport(void)
+{
+    if (m_request.get() != NULL)
+    {
+        m_messageFactory->dispose(&m_request);
+    }
+    if (m_reply.get() != NULL)
+    {
+        m_messageFactory->dispose(&m_reply);
+    }
+}
+
+erpc_status_t LoopbackTransport::setServer(SimpleServer *server)
+{
+    erpc_status_t status = kErpcStatus_Success;
+
+    // Reply must be waiting when dispatching returns, asynchronous server would answer later from another thread.
+    if ((server != NULL) && !server->isSynchronous())
+    {
+        status = kErpcStatus_InvalidArgument;
+    }
+    // Swapped buffers are disposed by the other side, foreign buffers would leak in e.g. static factory.
+    else if ((server != NULL) && (server->getMessageBufferFactory() != m_messageFactory))
+    {
+        status = kErpcStatus_InvalidArgument;
+    }
+    else
+    {
+        m_server = server;
+    }
+
+    return status;
+}
+
+erpc_status_t LoopbackTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+
+    if (m_hasRequest)
+    {
+        // Server takes the request, its own buffer is kept as spare.
+        message->swap(&m_request);
+        m_hasRequest = false;
+    }
+    else if (m_hasReply)
+    {
+        // Client takes the reply, its buffer is kept as spare.
+        message->swap(&m_reply);
+        m_hasReply = false;
+    }
+    else
+    {
+        status = kErpcStatus_ReceiveFailed;
+    }
+
+    return status;
+}
+
+erpc_status_t LoopbackTransport::send(MessageBuffer *message)
+{
+    erpc_status_t status;
+
+    if (m_dispatching)
+    {
+        // Reply sent by the server, it continues with a spare buffer.
+        message->swap(&m_reply);
+        m_hasReply = true;
+        status = kErpcStatus_Success;
+    }
+    else if (m_server == NULL)
+    {
+        status = kErpcStatus_ConnectionFailure;
+    }
+    else
+    {
+        // Client continues with a spare buffer.
+        message->swap(&m_request);
+        m_hasRequest = true;
+        m_hasReply = false;
+
+        m_dispatching = true;
+        status = m_server->poll();
+        m_dispatching = false;
+
+        if (m_hasRequest)
+        {
+            // Server did not take the request, e.g. it is stopped.
+            m_hasRequest = false;
+            if (status == kErpcStatus_Success)
+            {
+                status = kErpcStatus_SendFailed;
+            }
+        }
+    }
+
+    return status;
+}
+
+bool LoopbackTransport::hasMessage(void)
+{
+    return m_hasRequest;
+}
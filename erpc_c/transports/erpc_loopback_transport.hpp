@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__LOOPBACK_TRANSPORT_H_
+#define _EMBEDDED_RPC__LOOPBACK_TRANSPORT_H_
+
+#include "erpc_message_buffer.hpp"
+#include "erpc_simple_server.hpp"
+#include "erpc_transport.hpp"
+
+/*!
+ * @addtogroup loopback_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Transport dispatching requests directly to a server in the same thread.
+ *
+ * Client and server use the same instance of this transport. Sending a request from the client makes the server
+ * process it synchronously in the calling thread and the reply is waiting for the following receive. Message buffers
+ * are handed over by swapping, so the data are not copied and no threads or semaphores are involved. Each side then
+ * disposes buffers created by the other one, so client and server must use the message buffer factory given to the
+ * constructor, a server with other factory is rejected by setServer(). Up to two spare buffers stay in the transport,
+ * they are disposed when it is destroyed.
+ *
+ * The transport is not thread safe, requests must not be sent from several threads at once. It works with
+ * SimpleServer only (PriorityServer serves requests from its own threads) and without nested calls and oneway
+ * credit flow control.
+ *
+ * @ingroup loopback_transport
+ */
+class LoopbackTransport : public Transport
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * This function initializes object attributes.
+     *
+     * @param[in] messageFactory Message buffer factory used by both client and server.
+     */
+    explicit LoopbackTransport(MessageBufferFactory *messageFactory);
+
+    /*!
+     * @brief Destructor.
+     */
+    virtual ~LoopbackTransport(void);
+
+    /*!
+     * @brief Set server which processes the requests.
+     *
+     * Server must use this transport and its message buffer factory and process requests synchronously in poll().
+     *
+     * @param[in] server Server to dispatch requests to.
+     *
+     * @retval #kErpcStatus_Success Server was set.
+     * @retval #kErpcStatus_InvalidArgument Server processes requests on other threads (e.g. PriorityServer) or uses
+     * other message buffer factory, it was not set.
+     */
+    erpc_status_t setServer(SimpleServer *server);
+
+    /*!
+     * @brief Take the reply of the last request.
+     *
+     * On client side the given buffer is exchanged for the reply. On server side the request being dispatched is
+     * taken.
+     *
+     * @param[in] message Message buffer, which will be exchanged for the received one.
+     *
+     * @retval #kErpcStatus_Success Message was received.
+     * @retval #kErpcStatus_ReceiveFailed No message is waiting.
+     */
+    virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief Dispatch request to the server, or keep the reply when called by the server.
+     *
+     * @param[in] message Message buffer to send, it is exchanged for a spare buffer.
+     *
+     * @retval #kErpcStatus_Success Message was processed.
+     * @retval #kErpcStatus_ConnectionFailure No server is set.
+     * @retval other Error of the server processing the request.
+     */
+    virtual erpc_status_t send(MessageBuffer *message) override;
+
+    /*!
+     * @brief Function to check if is new message to receive.
+     *
+     * @return True while a request waits to be taken by the server.
+     */
+    virtual bool hasMessage(void) override;
+
+protected:
+    MessageBufferFactory *m_messageFactory; /*!< Factory of all buffers handed over, disposes the spare ones. */
+    SimpleServer *m_server;                 /*!< Server processing the requests. */
+    bool m_dispatching;                     /*!< Server is processing a request. */
+    bool m_hasRequest;                      /*!< m_request holds a request not taken by the server yet. */
+    bool m_hasReply;                        /*!< m_reply holds a reply not taken by the client yet. */
+    MessageBuffer m_request;                /*!< Request being dispatched to the server, or spare buffer. */
+    MessageBuffer m_reply;                  /*!< Reply waiting for the client, or spare buffer. */
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__LOOPBACK_TRANSPORT_H_
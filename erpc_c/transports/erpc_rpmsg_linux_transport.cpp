@@ -9,6 +9,9 @@
 
 #include "erpc_rpmsg_linux_transport.hpp"
 
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
 #include <unistd.h>
 
 using namespace erpc;
@@ -17,8 +20,18 @@ using namespace erpc;
 // Code
 ////////////////////////////////////////////////////////////////////////////////
 
+//! @brief Return monotonic time in microseconds.
+static uint64_t monotonicUsecs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U);
+}
+
 RPMsgLinuxTransport::RPMsgLinuxTransport(RPMsgEndpoint *endPoint, int16_t remote) :
-Transport(), m_endPoint(endPoint), m_remote(remote)
+Transport(), m_endPoint(endPoint), m_remote(remote), m_receiveFd(-1), m_drainReceiveFd(false), m_busyPollUsecs(0)
 {
 }
 
@@ -34,36 +47,94 @@ erpc_status_t RPMsgLinuxTransport::init(void)
 erpc_status_t RPMsgLinuxTransport::send(MessageBuffer *message)
 {
     int retval;
+    erpc_status_t err;
 
     retval = m_endPoint->send(message->get(), m_remote, message->getUsed());
+    countStat(&erpc_transport_stats_t::syscalls);
+    err = (retval > 0) ? kErpcStatus_Success : kErpcStatus_Fail;
+    countSend(err, message->getUsed());
+
+    return err;
+}
+
+erpc_status_t RPMsgLinuxTransport::waitForMessage(void)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    struct pollfd fd;
+    uint8_t drain[64];
+    int ret;
+
+    fd.fd = m_receiveFd;
+    fd.events = POLLIN;
+
+    do
+    {
+        fd.revents = 0;
+        ret = poll(&fd, 1, -1);
+    } while ((ret < 0) && (errno == EINTR));
+
+    if ((ret < 0) || ((fd.revents & POLLIN) == 0))
+    {
+        // Error, hang up or invalid descriptor without data to read.
+        err = kErpcStatus_Fail;
+    }
+    else if (m_drainReceiveFd)
+    {
+        // Reading resets eventfd counter, pipe holds at most a few notification bytes. Messages signalled by the
+        // drained notifications stay in the endpoint and are received before the next wait.
+        countStat(&erpc_transport_stats_t::syscalls);
+        if ((read(m_receiveFd, drain, sizeof(drain)) < 0) && (errno != EAGAIN) && (errno != EINTR))
+        {
+            err = kErpcStatus_Fail;
+        }
+    }
 
-    return (retval > 0) ? kErpcStatus_Success : kErpcStatus_Fail;
+    return err;
 }
+
 erpc_status_t RPMsgLinuxTransport::receive(MessageBuffer *message)
 {
     int32_t ret;
-    erpc_status_t err;
+    erpc_status_t err = kErpcStatus_Success;
+    uint64_t busyPollEnd = 0;
+    bool busyPolling = (m_receiveFd >= 0) && (m_busyPollUsecs > 0U);
 
-    while (true)
+    if (busyPolling)
+    {
+        busyPollEnd = monotonicUsecs() + m_busyPollUsecs;
+    }
+
+    while (err == kErpcStatus_Success)
     {
         ret = m_endPoint->receive(message->get(), message->getLength());
-        if (ret == 0)
+        countStat(&erpc_transport_stats_t::syscalls);
+        if (ret > 0)
         {
+            message->setUsed((uint16_t)ret);
+            break;
+        }
+        else if (ret < 0)
+        {
+            err = kErpcStatus_Fail;
+        }
+        else if (m_receiveFd < 0)
+        {
+            countStat(&erpc_transport_stats_t::wouldBlock);
             usleep(1); // 1us sleep
         }
+        else if (busyPolling && (monotonicUsecs() < busyPollEnd))
+        {
+            // Keep polling the endpoint.
+        }
         else
         {
-            if (ret > 0)
-            {
-                err = kErpcStatus_Success;
-            }
-            else
-            {
-                err = kErpcStatus_Fail;
-            }
-            break;
+            busyPolling = false;
+            countStat(&erpc_transport_stats_t::wouldBlock);
+            err = waitForMessage();
         }
     }
 
-    return ret;
+    countReceive(err, message->getUsed());
+
+    return err;
 }
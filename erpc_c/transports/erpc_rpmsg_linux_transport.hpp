@@ -21,6 +21,12 @@ namespace erpc {
  * @brief RPMSG Linux transport to send/receive messages through RPMSG endpoints
  * based on github.com/nxp-mcuxpresso/rpmsg-sysfs/tree/0aa1817545a765c200b1b2f9b6680a420dcf9171
  * implementation.
+ *
+ * Endpoint receive is non-blocking. When a file descriptor signalled by the endpoint layer is set (endpoint device
+ * or a notification eventfd or pipe), receive() sleeps in poll() on it while no message is available, optionally
+ * after polling the endpoint for a bounded busy poll window. Notification descriptor is drained after each wake up.
+ * Without a descriptor the endpoint is polled every microsecond.
+ *
  * @ingroup rpmsg_linux_transport
  */
 class RPMsgLinuxTransport : public Transport
@@ -48,13 +54,39 @@ public:
      */
     erpc_status_t init(void);
 
+    /*!
+     * @brief This function sets file descriptor to wait on for received messages.
+     *
+     * Endpoint device stops being readable once its message is received. Notification descriptor (eventfd or pipe
+     * written by the endpoint layer) stays readable until it is read, so the transport reads it after each wake up.
+     * Notification must be written after the message is queued to the endpoint.
+     *
+     * @param[in] fd Descriptor which becomes readable when endpoint has a message, -1 to poll the endpoint.
+     * @param[in] isNotification True when fd is a notification descriptor, false for the endpoint device.
+     */
+    void setReceiveFd(int fd, bool isNotification = false)
+    {
+        m_receiveFd = fd;
+        m_drainReceiveFd = isNotification;
+    }
+
+    /*!
+     * @brief This function sets busy poll window.
+     *
+     * Before going to sleep, receive() polls the endpoint for up to this time. It lowers latency of answers arriving
+     * shortly after a request at the cost of CPU time.
+     *
+     * @param[in] usecs Busy poll window in microseconds, zero to sleep immediately.
+     */
+    void setBusyPoll(uint32_t usecs) { m_busyPollUsecs = usecs; }
+
     /*!
      * @brief This function receives the eRPC messages.
      *
      * @param[in] message Message to receive.
      *
      * @retval kErpcStatus_Success When message was received successfully.
-     * @retval kErpcStatus_Fail When message wasn't received successfully.
+     * @retval kErpcStatus_Fail When message wasn't received successfully or waiting on the descriptor failed.
      */
     virtual erpc_status_t receive(MessageBuffer *message) override;
 
@@ -71,5 +103,18 @@ public:
 private:
     RPMsgEndpoint *m_endPoint; /*!< Object operating with endpoints. */
     int16_t m_remote;          /*!< Remote address. */
+    int m_receiveFd;           /*!< Descriptor to wait on for received messages, -1 if not set. */
+    bool m_drainReceiveFd;     /*!< m_receiveFd is a notification descriptor read after each wake up. */
+    uint32_t m_busyPollUsecs;  /*!< Busy poll window before waiting on m_receiveFd. */
+
+    /*!
+     * @brief This function waits until m_receiveFd is readable.
+     *
+     * Notification descriptor is drained, so the following wait sleeps until the next notification.
+     *
+     * @retval kErpcStatus_Success Descriptor is readable.
+     * @retval kErpcStatus_Fail Waiting failed or descriptor was closed.
+     */
+    erpc_status_t waitForMessage(void);
 };
 } // namespace erpc
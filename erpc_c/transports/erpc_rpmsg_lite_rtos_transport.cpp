@@ -241,13 +241,16 @@ erpc_status_t RPMsgRTOSTransport::receive(MessageBuffer *message)
     char *buf = NULL;
     uint32_t length = 0;
     int32_t ret_val;
+    erpc_status_t status;
 
     ret_val = rpmsg_queue_recv_nocopy(s_rpmsg, m_rpmsg_queue, &m_dst_addr, &buf, &length, RL_BLOCK);
     erpc_assert(buf != NULL);
     message->set(reinterpret_cast<uint8_t *>(buf), length);
     message->setUsed(length);
+    status = (ret_val != RL_SUCCESS) ? kErpcStatus_ReceiveFailed : kErpcStatus_Success;
+    countReceive(status, length);
 
-    return (ret_val != RL_SUCCESS) ? kErpcStatus_ReceiveFailed : kErpcStatus_Success;
+    return status;
 }
 
 erpc_status_t RPMsgRTOSTransport::send(MessageBuffer *message)
@@ -271,6 +274,8 @@ erpc_status_t RPMsgRTOSTransport::send(MessageBuffer *message)
         status = kErpcStatus_SendFailed;
     }
 
+    countSend(status, used);
+
     return status;
 }
 
@@ -199,16 +199,22 @@ erpc_status_t RPMsgTransport::receive(MessageBuffer *message)
     {
     }
 
+    countReceive(kErpcStatus_Success, message->getUsed());
+
     return kErpcStatus_Success;
 }
 
 erpc_status_t RPMsgTransport::send(MessageBuffer *message)
 {
+    uint16_t used = message->getUsed();
     int32_t ret_val = rpmsg_lite_send_nocopy(s_rpmsg, m_rpmsg_ept, m_dst_addr, reinterpret_cast<char *>(message->get()),
-                                             message->getUsed());
+                                             used);
+    erpc_status_t status = (ret_val != RL_SUCCESS) ? kErpcStatus_SendFailed : kErpcStatus_Success;
+
     message->set(NULL, 0);
+    countSend(status, used);
 
-    return (ret_val != RL_SUCCESS) ? kErpcStatus_SendFailed : kErpcStatus_Success;
+    return status;
 }
 
 bool RPMsgTransport::hasMessage(void)
@@ -99,6 +99,7 @@ erpc_status_t RpmsgSockTransport::connectClient(void)
         }
 
         m_socket = sock;
+        countStat(&erpc_transport_stats_t::connects);
     }
 
     return kErpcStatus_Success;
@@ -162,6 +163,7 @@ void RpmsgSockTransport::serverThread(void)
                 {
                     // Successfully accepted a connection.
                     m_socket = incomingSocket;
+                    countStat(&erpc_transport_stats_t::connects);
                 }
                 else
                 {
@@ -10,10 +10,13 @@
 
 #include "erpc_serial_transport.hpp"
 
+#include "erpc_config_internal.h"
+#include ENDIANNESS_HEADER
 #include "erpc_message_buffer.hpp"
 #include "erpc_serial.h"
 
 #include <cstdio>
+#include <cstring>
 #include <string>
 
 extern "C" {
@@ -33,7 +36,10 @@ using namespace erpc;
 ////////////////////////////////////////////////////////////////////////////////
 
 SerialTransport::SerialTransport(const char *portName, speed_t baudRate) :
-m_serialHandle(0), m_portName(portName), m_baudRate(baudRate)
+m_serialHandle(0), m_portName(portName), m_baudRate(baudRate), m_readTimeout(-1)
+#ifndef _WIN32
+, m_rxHead(0), m_rxTail(0)
+#endif
 {
 }
 
@@ -46,6 +52,11 @@ erpc_status_t SerialTransport::init(uint8_t vtime, uint8_t vmin)
 {
     erpc_status_t status = kErpcStatus_Success;
 
+#ifndef _WIN32
+    m_rxHead = 0;
+    m_rxTail = 0;
+#endif
+
     m_serialHandle = serial_open(m_portName);
     if (-1 == m_serialHandle)
     {
@@ -96,11 +107,175 @@ erpc_status_t SerialTransport::underlyingSend(const uint8_t *data, uint32_t size
 {
     uint32_t bytesWritten = serial_write(m_serialHandle, reinterpret_cast<const char *>(data), size);
 
+    countStat(&erpc_transport_stats_t::syscalls);
+    if (bytesWritten < size)
+    {
+        countStat(&erpc_transport_stats_t::partialTransfers);
+    }
+
     return (size != bytesWritten) ? kErpcStatus_SendFailed : kErpcStatus_Success;
 }
+
 erpc_status_t SerialTransport::underlyingReceive(uint8_t *data, uint32_t size)
 {
+#ifdef _WIN32
     uint32_t bytesRead = serial_read(m_serialHandle, reinterpret_cast<char *>(data), size);
 
+    countStat(&erpc_transport_stats_t::syscalls);
+    if (bytesRead < size)
+    {
+        countStat(&erpc_transport_stats_t::partialTransfers);
+    }
+
     return (size != bytesRead) ? kErpcStatus_ReceiveFailed : kErpcStatus_Success;
+#else
+    erpc_status_t status = kErpcStatus_Success;
+    uint32_t length;
+    int ret;
+
+    while ((size > 0U) && (status == kErpcStatus_Success))
+    {
+        if (m_rxHead != m_rxTail)
+        {
+            length = m_rxTail - m_rxHead;
+            if (length > size)
+            {
+                length = size;
+            }
+            (void)memcpy(data, &m_rxBuffer[m_rxHead], length);
+            m_rxHead += length;
+        }
+        else
+        {
+            // Data which would not fit the buffer are read directly, everything else through the buffer.
+            if (size >= sizeof(m_rxBuffer))
+            {
+                ret = serial_read_chunk(m_serialHandle, reinterpret_cast<char *>(data), size, m_readTimeout);
+                length = (ret > 0) ? static_cast<uint32_t>(ret) : 0U;
+                if ((length > 0U) && (length < size))
+                {
+                    countStat(&erpc_transport_stats_t::partialTransfers);
+                }
+            }
+            else
+            {
+                ret = serial_read_chunk(m_serialHandle, reinterpret_cast<char *>(m_rxBuffer), sizeof(m_rxBuffer),
+                                        m_readTimeout);
+                m_rxHead = 0;
+                m_rxTail = (ret > 0) ? static_cast<uint32_t>(ret) : 0U;
+                length = 0;
+            }
+
+            countStat(&erpc_transport_stats_t::syscalls);
+            if (ret == 0)
+            {
+                status = kErpcStatus_Timeout;
+            }
+            else if (ret < 0)
+            {
+                status = kErpcStatus_ReceiveFailed;
+            }
+        }
+
+        data += length;
+        size -= length;
+    }
+
+    return status;
+#endif
+}
+
+#ifndef _WIN32
+erpc_status_t SerialTransport::underlyingReceive(MessageBuffer *message, uint32_t size, uint32_t offset)
+{
+    erpc_status_t status;
+
+    if ((offset == 0U) && (size == sizeof(Header)))
+    {
+        status = receiveHeader(message->get());
+        if (status == kErpcStatus_Success)
+        {
+            message->setUsed(size);
+        }
+    }
+    else
+    {
+        status = FramedTransport::underlyingReceive(message, size, offset);
+    }
+
+    return status;
 }
+
+erpc_status_t SerialTransport::receiveHeader(uint8_t *data)
+{
+    erpc_status_t status;
+    Header h;
+    bool skipped = false;
+
+    for (;;)
+    {
+        status = fillRxBuffer(sizeof(h));
+        if (status != kErpcStatus_Success)
+        {
+            break;
+        }
+
+        (void)memcpy(&h, &m_rxBuffer[m_rxHead], sizeof(h));
+        ERPC_READ_AGNOSTIC_16(h.m_crcHeader);
+        ERPC_READ_AGNOSTIC_16(h.m_messageSize);
+        ERPC_READ_AGNOSTIC_16(h.m_crcBody);
+        if (computeHeaderCrc(h.m_messageSize, h.m_crcBody) == h.m_crcHeader)
+        {
+            (void)memcpy(data, &m_rxBuffer[m_rxHead], sizeof(h));
+            m_rxHead += sizeof(h);
+            break;
+        }
+
+        // Not a frame start, look one byte further.
+        ++m_rxHead;
+        skipped = true;
+    }
+
+    if (skipped)
+    {
+        countStat(&erpc_transport_stats_t::framingErrors);
+    }
+
+    return status;
+}
+
+erpc_status_t SerialTransport::fillRxBuffer(uint32_t size)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    int ret;
+
+    while ((status == kErpcStatus_Success) && ((m_rxTail - m_rxHead) < size))
+    {
+        if (m_rxHead > 0U)
+        {
+            // Keep buffered bytes at the beginning, so the rest of the buffer can be filled.
+            (void)memmove(m_rxBuffer, &m_rxBuffer[m_rxHead], m_rxTail - m_rxHead);
+            m_rxTail -= m_rxHead;
+            m_rxHead = 0;
+        }
+
+        ret = serial_read_chunk(m_serialHandle, reinterpret_cast<char *>(&m_rxBuffer[m_rxTail]),
+                                sizeof(m_rxBuffer) - m_rxTail, m_readTimeout);
+        countStat(&erpc_transport_stats_t::syscalls);
+        if (ret == 0)
+        {
+            status = kErpcStatus_Timeout;
+        }
+        else if (ret < 0)
+        {
+            status = kErpcStatus_ReceiveFailed;
+        }
+        else
+        {
+            m_rxTail += static_cast<uint32_t>(ret);
+        }
+    }
+
+    return status;
+}
+#endif
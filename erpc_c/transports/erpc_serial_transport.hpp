@@ -10,6 +10,7 @@
 #ifndef _EMBEDDED_RPC__SERIAL_TRANSPORT_H_
 #define _EMBEDDED_RPC__SERIAL_TRANSPORT_H_
 
+#include "erpc_config_internal.h"
 #include "erpc_framed_transport.hpp"
 
 #include <string>
@@ -36,6 +37,13 @@ namespace erpc {
 /*!
  * @brief Serial transport layer for host PC
  *
+ * On POSIX hosts receiving blocks in poll() and reads all bytes available on the tty at once into a buffer of
+ * #ERPC_SERIAL_RX_BUFFER_SIZE bytes, from which framing takes its data. Longer reads go directly to the destination.
+ *
+ * Frame header is taken from the buffer only once all its bytes arrived and its CRC matches. Bytes not starting a
+ * valid header, e.g. the rest of a frame whose receive timed out or line noise, are skipped one by one, so receiving
+ * resynchronizes on the next frame.
+ *
  * @ingroup serial_transport
  */
 class SerialTransport : public FramedTransport
@@ -64,10 +72,56 @@ public:
      */
     erpc_status_t init(uint8_t vtime, uint8_t vmin);
 
+    /*!
+     * @brief Set receive timeout.
+     *
+     * Not supported on Windows.
+     *
+     * @param[in] timeoutMs Longest time to wait for data in milliseconds, negative value waits forever (default).
+     */
+    void setReadTimeout(int32_t timeoutMs) { m_readTimeout = timeoutMs; }
+
 private:
     using FramedTransport::underlyingReceive;
     using FramedTransport::underlyingSend;
 
+#ifndef _WIN32
+    /*!
+     * @brief Receive frame header or message data.
+     *
+     * Header is looked for in the received bytes as described in the class description.
+     *
+     * @param[in] message Message buffer to receive to.
+     * @param[in] size Size of data to read.
+     * @param[in] offset Offset of the data in the message buffer, zero for the header.
+     *
+     * @return Status of receiving.
+     */
+    virtual erpc_status_t underlyingReceive(MessageBuffer *message, uint32_t size, uint32_t offset) override;
+
+    /*!
+     * @brief Wait until the receive buffer holds a valid frame header and take it.
+     *
+     * @param[out] data Buffer for the header.
+     *
+     * @retval kErpcStatus_ReceiveFailed Serial failed to receive data.
+     * @retval kErpcStatus_Timeout Header did not arrive within receive timeout, received bytes stay buffered.
+     * @retval kErpcStatus_Success Header was taken.
+     */
+    erpc_status_t receiveHeader(uint8_t *data);
+
+    /*!
+     * @brief Read from the tty until the receive buffer holds requested count of bytes.
+     *
+     * @param[in] size Count of bytes, at most #ERPC_SERIAL_RX_BUFFER_SIZE.
+     *
+     * @retval kErpcStatus_ReceiveFailed Serial failed to receive data.
+     * @retval kErpcStatus_Timeout No data arrived within receive timeout.
+     * @retval kErpcStatus_Success Buffer holds the bytes.
+     */
+    erpc_status_t fillRxBuffer(uint32_t size);
+#endif
+
     /*!
      * @brief Receive data from Serial peripheral.
      *
@@ -75,6 +129,7 @@ private:
      * @param[in] size Size of data to read.
      *
      * @retval kErpcStatus_ReceiveFailed Serial failed to receive data.
+     * @retval kErpcStatus_Timeout No data arrived within receive timeout.
      * @retval kErpcStatus_Success Successfully received all data.
      */
     virtual erpc_status_t underlyingReceive(uint8_t *data, uint32_t size) override;
@@ -94,6 +149,13 @@ private:
     int m_serialHandle;     /*!< Serial handle id. */
     const char *m_portName; /*!< Port name. */
     speed_t m_baudRate;     /*!< Bauderate. */
+    int32_t m_readTimeout;  /*!< Receive timeout in milliseconds, negative for none. */
+
+#ifndef _WIN32
+    uint8_t m_rxBuffer[ERPC_SERIAL_RX_BUFFER_SIZE]; /*!< Bytes read from tty but not taken by framing yet. */
+    uint32_t m_rxHead;                              /*!< Offset of first buffered byte. */
+    uint32_t m_rxTail;                              /*!< Offset behind last buffered byte. */
+#endif
 };
 
 } // namespace erpc
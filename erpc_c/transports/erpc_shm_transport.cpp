@@ -0,0 +1,445 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_shm_transport.hpp"
+
+#include <cstring>
+
+extern "C" {
+#if !defined(__linux__)
+#error Shared memory transport requires Linux futexes.
+#endif
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+}
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Value of SharedHeader::magic of initialized shared memory.
+#define SHM_MAGIC (0x65525043U)
+
+//! @brief Frame length telling the consumer to continue at the beginning of the ring.
+#define SHM_WRAP_MARKER (0xFFFFFFFFU)
+
+//! @brief Size of frame length field.
+#define SHM_FRAME_HEADER_SIZE (sizeof(uint32_t))
+
+//! @brief Smallest supported ring size.
+#define SHM_MIN_RING_SIZE (256U)
+
+//! @brief Default count of polls before going to sleep.
+#define SHM_DEFAULT_SPIN_COUNT (2000U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Return size of frame holding message of given length. Frames are 4 bytes aligned.
+static inline uint32_t frameSize(uint32_t length)
+{
+    return (uint32_t)SHM_FRAME_HEADER_SIZE + ((length + 3U) & ~3U);
+}
+
+static inline uint32_t loadAcquire(const uint32_t *word)
+{
+    return __atomic_load_n(word, __ATOMIC_ACQUIRE);
+}
+
+static inline uint32_t loadSeqCst(const uint32_t *word)
+{
+    return __atomic_load_n(word, __ATOMIC_SEQ_CST);
+}
+
+static inline void storeSeqCst(uint32_t *word, uint32_t value)
+{
+    __atomic_store_n(word, value, __ATOMIC_SEQ_CST);
+}
+
+static void futexWait(uint32_t *word, uint32_t value)
+{
+    // Shared futex, the word is mapped by both processes. Returns immediately when the word changed already.
+    (void)syscall(SYS_futex, word, FUTEX_WAIT, value, NULL, NULL, 0);
+}
+
+static void futexWake(uint32_t *word)
+{
+    (void)syscall(SYS_futex, word, FUTEX_WAKE, 1, NULL, NULL, 0);
+}
+
+ShmTransport::ShmTransport(const char *name, uint32_t ringSize, bool isServer) :
+m_name(name), m_ringSize(ringSize), m_isServer(isServer), m_spinCount(SHM_DEFAULT_SPIN_COUNT), m_fd(-1),
+m_shared(NULL), m_mappedSize(0), m_rxControl(NULL), m_rxData(NULL), m_txControl(NULL), m_txData(NULL)
+#if !ERPC_THREADS_IS(NONE)
+,
+m_sendLock(false), m_receiveLock(false)
+#endif
+{
+    // Peer cannot make progress while we spin on the only CPU.
+    if (sysconf(_SC_NPROCESSORS_ONLN) <= 1)
+    {
+        m_spinCount = 0U;
+    }
+}
+
+ShmTransport::~ShmTransport(void)
+{
+    unmap();
+
+    if (m_isServer && (m_name != NULL))
+    {
+        (void)shm_unlink(m_name);
+    }
+}
+
+erpc_status_t ShmTransport::open(void)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    struct stat info;
+    uint8_t *data;
+
+    unmap();
+
+    if (m_isServer)
+    {
+        if ((m_ringSize < SHM_MIN_RING_SIZE) || ((m_ringSize & (m_ringSize - 1U)) != 0U))
+        {
+            status = kErpcStatus_InvalidArgument;
+        }
+        else
+        {
+            // Start with fresh object, client of previous server keeps its own.
+            (void)shm_unlink(m_name);
+            m_fd = shm_open(m_name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+            m_mappedSize = sizeof(SharedHeader) + 2U * (size_t)m_ringSize;
+            if ((m_fd < 0) || (ftruncate(m_fd, (off_t)m_mappedSize) != 0))
+            {
+                status = kErpcStatus_ConnectionFailure;
+            }
+        }
+    }
+    else
+    {
+        m_fd = shm_open(m_name, O_RDWR, 0);
+        if ((m_fd < 0) || (fstat(m_fd, &info) != 0) || ((size_t)info.st_size < sizeof(SharedHeader)))
+        {
+            status = kErpcStatus_ConnectionFailure;
+        }
+        else
+        {
+            m_mappedSize = (size_t)info.st_size;
+        }
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        void *addr = mmap(NULL, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (addr == MAP_FAILED)
+        {
+            status = kErpcStatus_ConnectionFailure;
+        }
+        else
+        {
+            m_shared = reinterpret_cast<SharedHeader *>(addr);
+        }
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        if (m_isServer)
+        {
+            // New object is zero filled, publish it as the last step.
+            m_shared->ringSize = m_ringSize;
+            __atomic_store_n(&m_shared->magic, SHM_MAGIC, __ATOMIC_RELEASE);
+        }
+        else if ((loadAcquire(&m_shared->magic) != SHM_MAGIC) ||
+                 (m_mappedSize != sizeof(SharedHeader) + 2U * (size_t)m_shared->ringSize))
+        {
+            status = kErpcStatus_ConnectionFailure;
+        }
+        else
+        {
+            m_ringSize = m_shared->ringSize;
+        }
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        // Ring 0 carries messages from client to server, ring 1 the other way.
+        data = reinterpret_cast<uint8_t *>(m_shared) + sizeof(SharedHeader);
+        m_rxControl = &m_shared->control[m_isServer ? 0 : 1];
+        m_rxData = &data[m_isServer ? 0U : m_ringSize];
+        m_txControl = &m_shared->control[m_isServer ? 1 : 0];
+        m_txData = &data[m_isServer ? m_ringSize : 0U];
+    }
+    else
+    {
+        unmap();
+    }
+
+    return status;
+}
+
+void ShmTransport::close(void)
+{
+    uint32_t i;
+
+    if (m_shared != NULL)
+    {
+        storeSeqCst(&m_shared->closed, 1U);
+        for (i = 0U; i < 2U; ++i)
+        {
+            futexWake(&m_shared->control[i].head);
+            futexWake(&m_shared->control[i].tail);
+        }
+    }
+}
+
+void ShmTransport::unmap(void)
+{
+    if (m_shared != NULL)
+    {
+        (void)munmap(m_shared, m_mappedSize);
+        m_shared = NULL;
+    }
+
+    if (m_fd >= 0)
+    {
+        (void)::close(m_fd);
+        m_fd = -1;
+    }
+
+    m_rxControl = NULL;
+    m_rxData = NULL;
+    m_txControl = NULL;
+    m_txData = NULL;
+}
+
+bool ShmTransport::waitForChange(uint32_t *word, uint32_t value, uint32_t *waiting)
+{
+    uint32_t spin;
+
+    for (spin = 0U; spin < m_spinCount; ++spin)
+    {
+        if (loadAcquire(word) != value)
+        {
+            return true;
+        }
+    }
+
+    while (loadSeqCst(&m_shared->closed) == 0U)
+    {
+        // Announce sleeping before the last check, peer checks the flag after publishing its change.
+        storeSeqCst(waiting, 1U);
+        if (loadSeqCst(word) == value)
+        {
+            futexWait(word, value);
+        }
+        storeSeqCst(waiting, 0U);
+
+        if (loadAcquire(word) != value)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+erpc_status_t ShmTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    uint32_t tail;
+    uint32_t head;
+    uint32_t offset;
+    uint32_t length;
+    bool done = false;
+
+    if (m_shared == NULL)
+    {
+        return kErpcStatus_ConnectionFailure;
+    }
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_receiveLock);
+#endif
+
+    tail = m_rxControl->tail;
+
+    while (!done)
+    {
+        head = loadAcquire(&m_rxControl->head);
+        if (head == tail)
+        {
+            if (loadSeqCst(&m_shared->closed) != 0U)
+            {
+                status = kErpcStatus_ConnectionClosed;
+                break;
+            }
+            (void)waitForChange(&m_rxControl->head, tail, &m_rxControl->consumerWaiting);
+            continue;
+        }
+
+        offset = tail & (m_ringSize - 1U);
+        (void)memcpy(&length, &m_rxData[offset], sizeof(length));
+
+        // Peer shares the memory, never trust its frames to stay inside the ring or the published data.
+        if (!isFrameValid(offset, length, head - tail))
+        {
+            close();
+            status = kErpcStatus_ConnectionFailure;
+            break;
+        }
+
+        if (length == SHM_WRAP_MARKER)
+        {
+            // Frame continues at the beginning of the ring.
+            tail += m_ringSize - offset;
+        }
+        else
+        {
+            if (length > message->getLength())
+            {
+                status = kErpcStatus_ReceiveFailed;
+            }
+            else
+            {
+                (void)memcpy(message->get(), &m_rxData[offset + SHM_FRAME_HEADER_SIZE], length);
+                message->setUsed((uint16_t)length);
+            }
+            tail += frameSize(length);
+            done = true;
+        }
+    }
+
+    if (tail != m_rxControl->tail)
+    {
+        // Release the space, then wake producer if it waits for it.
+        storeSeqCst(&m_rxControl->tail, tail);
+        if (loadSeqCst(&m_rxControl->producerWaiting) != 0U)
+        {
+            futexWake(&m_rxControl->tail);
+        }
+    }
+
+    return status;
+}
+
+bool ShmTransport::isFrameValid(uint32_t offset, uint32_t length, uint32_t available) const
+{
+    bool valid;
+
+    if (available > m_ringSize)
+    {
+        valid = false;
+    }
+    else if (length == SHM_WRAP_MARKER)
+    {
+        // Skipped end of the ring is always followed by a frame.
+        valid = (m_ringSize - offset) < available;
+    }
+    else
+    {
+        valid = (length <= (m_ringSize - offset - (uint32_t)SHM_FRAME_HEADER_SIZE)) && (frameSize(length) <= available);
+    }
+
+    return valid;
+}
+
+erpc_status_t ShmTransport::send(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    uint32_t length = message->getUsed();
+    uint32_t frame = frameSize(length);
+    uint32_t head;
+    uint32_t tail;
+    uint32_t offset;
+    uint32_t contiguous;
+    uint32_t needed;
+    uint32_t marker = SHM_WRAP_MARKER;
+
+    if (m_shared == NULL)
+    {
+        return kErpcStatus_ConnectionFailure;
+    }
+
+    if (frame > (m_ringSize / 2U))
+    {
+        return kErpcStatus_SendFailed;
+    }
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_sendLock);
+#endif
+
+    head = m_txControl->head;
+    offset = head & (m_ringSize - 1U);
+    contiguous = m_ringSize - offset;
+    // Frame is never split, the end of the ring is skipped when it is too short.
+    needed = (contiguous < frame) ? (contiguous + frame) : frame;
+
+    for (;;)
+    {
+        if (loadSeqCst(&m_shared->closed) != 0U)
+        {
+            status = kErpcStatus_ConnectionClosed;
+            break;
+        }
+
+        tail = loadAcquire(&m_txControl->tail);
+        if ((m_ringSize - (head - tail)) >= needed)
+        {
+            break;
+        }
+
+        (void)waitForChange(&m_txControl->tail, tail, &m_txControl->producerWaiting);
+    }
+
+    if (status == kErpcStatus_Success)
+    {
+        if (contiguous < frame)
+        {
+            (void)memcpy(&m_txData[offset], &marker, sizeof(marker));
+            head += contiguous;
+            offset = 0U;
+        }
+
+        (void)memcpy(&m_txData[offset], &length, sizeof(length));
+        (void)memcpy(&m_txData[offset + SHM_FRAME_HEADER_SIZE], message->get(), length);
+
+        // Publish the frame, then wake consumer if it sleeps.
+        storeSeqCst(&m_txControl->head, head + frame);
+        if (loadSeqCst(&m_txControl->consumerWaiting) != 0U)
+        {
+            futexWake(&m_txControl->head);
+        }
+    }
+
+    return status;
+}
+
+bool ShmTransport::hasMessage(void)
+{
+    return (m_shared != NULL) && (loadAcquire(&m_rxControl->head) != m_rxControl->tail);
+}
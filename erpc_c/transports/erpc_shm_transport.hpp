@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__SHM_TRANSPORT_H_
+#define _EMBEDDED_RPC__SHM_TRANSPORT_H_
+
+#include "erpc_config_internal.h"
+#include "erpc_transport.hpp"
+#if !ERPC_THREADS_IS(NONE)
+#include "erpc_threading.h"
+#endif
+
+/*!
+ * @addtogroup shm_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Shared memory transport for processes on the same Linux host.
+ *
+ * Server creates a POSIX shared memory object holding one single producer single consumer ring for each direction,
+ * client maps the existing object. Messages are written to the ring as length prefixed frames, so sending and
+ * receiving do not enter the kernel. A side which finds the ring empty (or full) spins for a while and then sleeps on
+ * a futex; the peer issues the wake up system call only when the side is sleeping.
+ *
+ * Message is limited to half of the ring size. Sending and receiving are serialized by local locks, so the transport
+ * can be shared by threads of one process.
+ *
+ * @ingroup shm_transport
+ */
+class ShmTransport : public Transport
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * This function initializes object attributes.
+     *
+     * @param[in] name Name of the shared memory object, starting with '/'.
+     * @param[in] ringSize Size of each ring in bytes, power of two. Used by server only, client takes the size from
+     * the shared memory object.
+     * @param[in] isServer True when this transport is used for server side application.
+     */
+    ShmTransport(const char *name, uint32_t ringSize, bool isServer);
+
+    /*!
+     * @brief Destructor.
+     *
+     * Unmaps the shared memory. Server also removes the shared memory object.
+     */
+    virtual ~ShmTransport(void);
+
+    /*!
+     * @brief Create (server) or map (client) the shared memory object.
+     *
+     * @retval #kErpcStatus_Success Shared memory is ready.
+     * @retval #kErpcStatus_InvalidArgument Ring size is not power of two or is too small.
+     * @retval #kErpcStatus_ConnectionFailure Shared memory object could not be created or mapped, or client found
+     * it not initialized by server.
+     */
+    erpc_status_t open(void);
+
+    /*!
+     * @brief Mark the connection closed.
+     *
+     * Both sides waiting in send or receive are woken up and return #kErpcStatus_ConnectionClosed. Shared memory stays
+     * mapped until the transport is destroyed.
+     */
+    void close(void);
+
+    /*!
+     * @brief Set count of polls of an empty or full ring before going to sleep.
+     *
+     * Spinning keeps round trip latency low when the peer answers quickly, at the cost of CPU time. Default is 2000
+     * polls, on single processor hosts zero.
+     *
+     * @param[in] spinCount Count of polls, zero to sleep immediately.
+     */
+    void setSpinCount(uint32_t spinCount) { m_spinCount = spinCount; }
+
+    /*!
+     * @brief Receive one message from the ring.
+     *
+     * @param[in] message Message buffer, to which received data will be stored.
+     *
+     * @retval #kErpcStatus_Success Message was received.
+     * @retval #kErpcStatus_ReceiveFailed Message does not fit into the buffer, it is dropped.
+     * @retval #kErpcStatus_ConnectionClosed Connection was closed.
+     * @retval #kErpcStatus_ConnectionFailure Peer wrote a frame exceeding the ring or the published data, the
+     * connection is closed.
+     */
+    virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief Send one message to the ring.
+     *
+     * Blocks while the ring is full.
+     *
+     * @param[in] message Message buffer to send.
+     *
+     * @retval #kErpcStatus_Success Message was sent.
+     * @retval #kErpcStatus_SendFailed Message is larger than half of the ring.
+     * @retval #kErpcStatus_ConnectionClosed Connection was closed.
+     */
+    virtual erpc_status_t send(MessageBuffer *message) override;
+
+    /*!
+     * @brief Function to check if is new message to receive.
+     *
+     * @return True if a message is waiting in the ring.
+     */
+    virtual bool hasMessage(void) override;
+
+protected:
+    /*!
+     * @brief Control words of one ring.
+     *
+     * Fields written by the producer and by the consumer are kept in separate cache lines.
+     */
+    struct RingControl
+    {
+        uint32_t head;            /*!< Written bytes counter, advanced by producer. Futex word of consumer. */
+        uint32_t consumerWaiting; /*!< Consumer sleeps or is going to sleep on head. */
+        uint8_t pad0[56];         /*!< Padding to cache line. */
+        uint32_t tail;            /*!< Read bytes counter, advanced by consumer. Futex word of producer. */
+        uint32_t producerWaiting; /*!< Producer sleeps or is going to sleep on tail. */
+        uint8_t pad1[56];         /*!< Padding to cache line. */
+    };
+
+    /*!
+     * @brief Beginning of the shared memory. Ring data follow.
+     */
+    struct SharedHeader
+    {
+        uint32_t magic;         /*!< Set by server when the rings are initialized. */
+        uint32_t ringSize;      /*!< Size of each ring in bytes. */
+        uint32_t closed;        /*!< Connection was closed by either side. */
+        uint8_t pad[52];        /*!< Padding to cache line. */
+        RingControl control[2]; /*!< Client to server ring and server to client ring. */
+    };
+
+    const char *m_name;     /*!< Name of the shared memory object. */
+    uint32_t m_ringSize;    /*!< Size of each ring in bytes. */
+    bool m_isServer;        /*!< If true then server is using transport, else client. */
+    uint32_t m_spinCount;   /*!< Count of polls before going to sleep. */
+    int m_fd;               /*!< Shared memory object descriptor. */
+    SharedHeader *m_shared; /*!< Mapped shared memory. */
+    size_t m_mappedSize;    /*!< Size of mapped shared memory. */
+
+    RingControl *m_rxControl; /*!< Control of the ring this side consumes. */
+    uint8_t *m_rxData;        /*!< Data of the ring this side consumes. */
+    RingControl *m_txControl; /*!< Control of the ring this side produces. */
+    uint8_t *m_txData;        /*!< Data of the ring this side produces. */
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex m_sendLock;    /*!< Keeps single producer. */
+    Mutex m_receiveLock; /*!< Keeps single consumer. */
+#endif
+
+    /*!
+     * @brief Wait until a futex word differs from the expected value.
+     *
+     * @param[in] word Futex word in shared memory.
+     * @param[in] value Value to wait to change.
+     * @param[in] waiting Flag telling the peer to wake this side up.
+     *
+     * @retval true Word was changed.
+     * @retval false Connection was closed.
+     */
+    bool waitForChange(uint32_t *word, uint32_t value, uint32_t *waiting);
+
+    /*!
+     * @brief Check frame found in the receive ring.
+     *
+     * @param[in] offset Offset of the frame in the ring.
+     * @param[in] length Length field of the frame.
+     * @param[in] available Count of bytes published by the producer.
+     *
+     * @retval true Frame lies inside the ring and inside the published data.
+     * @retval false Frame is corrupted.
+     */
+    bool isFrameValid(uint32_t offset, uint32_t length, uint32_t available) const;
+
+    /*!
+     * @brief Unmap and close the shared memory object.
+     */
+    void unmap(void);
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__SHM_TRANSPORT_H_
@@ -36,6 +36,7 @@ extern "C" {
 #if defined(__MINGW32__)
 #include <ws2def.h>
 #else
+#include <poll.h>
 #include <sys/socket.h>
 #endif
 #include <signal.h>
@@ -60,6 +61,10 @@ m_socket(-1)
 #endif
 ,
 m_runServer(true), m_serverThread(serverThreadStub)
+#if ERPC_SOCK_IO_URING
+,
+m_uringInit(false), m_connection(0)
+#endif
 {
 #if defined(__MINGW32__)
     WSADATA ws;
@@ -87,6 +92,16 @@ erpc_status_t SockTransport::open(void)
     return status;
 }
 
+#if ERPC_THREADS_IS(PTHREADS)
+bool SockTransport::setServerThreadAttributes(uint32_t priority, uint32_t cpuMask)
+{
+    bool priorityOk = m_serverThread.setPriority(priority);
+    bool affinityOk = m_serverThread.setCpuAffinity(cpuMask);
+
+    return priorityOk && affinityOk;
+}
+#endif
+
 erpc_status_t SockTransport::close(bool stopServer)
 {
     if (m_isServer && stopServer)
@@ -103,6 +118,11 @@ erpc_status_t SockTransport::close(bool stopServer)
 #else
     if (m_socket != -1)
     {
+#if ERPC_SOCK_IO_URING
+        // Posted receive holds the socket open, shutdown completes it.
+        (void)shutdown(m_socket, SHUT_RDWR);
+        (void)__atomic_fetch_add(&m_connection, 1U, __ATOMIC_RELEASE);
+#endif
         ::close(m_socket);
         m_socket = -1;
     }
@@ -111,6 +131,19 @@ erpc_status_t SockTransport::close(bool stopServer)
     return kErpcStatus_Success;
 }
 
+#if !defined(__MINGW32__)
+bool SockTransport::hasMessage(void)
+{
+    struct pollfd fd;
+
+    fd.fd = m_socket;
+    fd.events = POLLIN;
+    fd.revents = 0;
+
+    return (m_socket > 0) && (poll(&fd, 1, 0) > 0);
+}
+#endif
+
 erpc_status_t SockTransport::underlyingReceive(uint8_t *data, uint32_t size)
 {
     ssize_t length;
@@ -127,6 +160,34 @@ erpc_status_t SockTransport::underlyingReceive(uint8_t *data, uint32_t size)
         Thread::sleep(10000);
     }
 
+#if ERPC_SOCK_IO_URING
+    if (m_isServer && !m_uringInit)
+    {
+        // Ring and its buffers are allocated only by transports that serve requests. Without io_uring support data
+        // are received by read().
+        m_uringInit = true;
+        (void)m_uring.init(ERPC_SOCK_IO_URING_BUFFERS, ERPC_SOCK_IO_URING_BUFFER_SIZE);
+    }
+
+    if (m_uring.isActive())
+    {
+        status = m_uring.receive(m_socket, __atomic_load_n(&m_connection, __ATOMIC_ACQUIRE), data, size);
+        if (status == kErpcStatus_ConnectionClosed)
+        {
+            // close socket, not server
+            countStat(&erpc_transport_stats_t::disconnects);
+            close(false);
+        }
+
+        // Receiver becomes inactive only before it takes any data, then continue with read().
+        if (m_uring.isActive())
+        {
+            return status;
+        }
+        status = kErpcStatus_Success;
+    }
+#endif
+
     // Loop until all requested data is received.
     while (size > 0U)
     {
@@ -136,22 +197,42 @@ erpc_status_t SockTransport::underlyingReceive(uint8_t *data, uint32_t size)
         length = read(m_socket, data, size);
 #endif
 
+        countStat(&erpc_transport_stats_t::syscalls);
+
         // Length will be zero if the connection is closed.
         if (length > 0)
         {
+            if ((uint32_t)length < size)
+            {
+                countStat(&erpc_transport_stats_t::partialTransfers);
+            }
             size -= length;
             data += length;
         }
+        else if ((length < 0) && ((errno == EINTR) || (errno == EAGAIN)))
+        {
+            countStat(&erpc_transport_stats_t::wouldBlock);
+            if (errno != EINTR)
+            {
+                status = kErpcStatus_ReceiveFailed;
+                break;
+            }
+        }
         else
         {
             if (length == 0)
             {
                 // close socket, not server
+                countStat(&erpc_transport_stats_t::disconnects);
                 close(false);
                 status = kErpcStatus_ConnectionClosed;
             }
             else
             {
+                if (errno == ECONNRESET)
+                {
+                    countStat(&erpc_transport_stats_t::disconnects);
+                }
                 status = kErpcStatus_ReceiveFailed;
             }
             break;
@@ -185,16 +266,31 @@ erpc_status_t SockTransport::underlyingSend(const uint8_t *data, uint32_t size)
 #else
             result = write(m_socket, data, size);
 #endif
+            countStat(&erpc_transport_stats_t::syscalls);
             if (result >= 0)
             {
+                if ((uint32_t)result < size)
+                {
+                    countStat(&erpc_transport_stats_t::partialTransfers);
+                }
                 size -= result;
                 data += result;
             }
+            else if ((errno == EINTR) || (errno == EAGAIN))
+            {
+                countStat(&erpc_transport_stats_t::wouldBlock);
+                if (errno != EINTR)
+                {
+                    status = kErpcStatus_SendFailed;
+                    break;
+                }
+            }
             else
             {
-                if (result == EPIPE)
+                if (errno == EPIPE)
                 {
                     // close socket, not server
+                    countStat(&erpc_transport_stats_t::disconnects);
                     close(false);
                     status = kErpcStatus_ConnectionClosed;
                 }
@@ -21,8 +21,12 @@
 #include <winsock2.h>
 #endif
 
+#include "erpc_config_internal.h"
 #include "erpc_framed_transport.hpp"
 #include "erpc_threading.h"
+#if ERPC_SOCK_IO_URING
+#include "erpc_io_uring.hpp"
+#endif
 
 /*!
  * @addtogroup sock_transport
@@ -38,6 +42,9 @@ namespace erpc {
 /*!
  * @brief Client side of Socket transport.
  *
+ * With #ERPC_SOCK_IO_URING enabled a server receives data through io_uring when the kernel supports it. Clients wait
+ * for one reply per call and keep using read().
+ *
  * @ingroup sock_transport
  */
 class SockTransport : public FramedTransport
@@ -74,6 +81,30 @@ public:
      */
     virtual erpc_status_t close(bool stopServer = true);
 
+#if ERPC_THREADS_IS(PTHREADS)
+    /*!
+     * @brief This function sets scheduling of server thread.
+     *
+     * Server thread is started by open(), its priority and affinity are changed immediately.
+     *
+     * @param[in] priority Thread priority, see Thread::setPriority().
+     * @param[in] cpuMask CPUs the thread can run on, bit n for CPU n, zero for all.
+     *
+     * @retval true When both were set.
+     * @retval false When the system refused any of them.
+     */
+    bool setServerThreadAttributes(uint32_t priority, uint32_t cpuMask);
+#endif
+
+#if !defined(__MINGW32__)
+    /*!
+     * @brief Function to check if is new message to receive.
+     *
+     * @return True if there are data to read on the socket, else false.
+     */
+    virtual bool hasMessage(void) override;
+#endif
+
 protected:
     bool m_isServer;    /*!< If true then server is using transport, else client. */
 #if defined(__MINGW32__)
@@ -83,6 +114,11 @@ protected:
 #endif
     bool m_runServer;      /*!< Thread is executed while this is true. */
     Thread m_serverThread; /*!< Pointer to server thread. */
+#if ERPC_SOCK_IO_URING
+    IoUringReceiver m_uring; /*!< io_uring receiver, set up by the first receive of a server. */
+    bool m_uringInit;        /*!< Setup of m_uring was tried. */
+    uint32_t m_connection;   /*!< Incremented each time the socket is closed, accessed atomically. */
+#endif
 
     using FramedTransport::underlyingReceive;
     using FramedTransport::underlyingSend;
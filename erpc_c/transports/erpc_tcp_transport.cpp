@@ -34,6 +34,10 @@ extern "C" {
 #include <netinet/tcp.h>
 #include <sys/socket.h>
 #endif
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+#endif
 #include <signal.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -60,12 +64,12 @@ using namespace erpc;
 ////////////////////////////////////////////////////////////////////////////////
 
 TCPTransport::TCPTransport(bool isServer) :
-SockTransport(isServer), m_host(NULL), m_port(0)
+SockTransport(isServer), m_host(NULL), m_port(0), m_reusePort(false)
 {
 }
 
 TCPTransport::TCPTransport(const char *host, uint16_t port, bool isServer) :
-SockTransport(isServer), m_host(host), m_port(port)
+SockTransport(isServer), m_host(host), m_port(port), m_reusePort(false)
 {
 }
 
@@ -229,6 +233,7 @@ erpc_status_t TCPTransport::connectClient(void)
 #endif
 #endif // defined(SO_NOSIGPIPE)
             m_socket = sock;
+            countStat(&erpc_transport_stats_t::connects);
         }
     }
 
@@ -282,6 +287,19 @@ void TCPTransport::serverThread(void)
             status = true;
         }
 
+#if defined(SO_REUSEPORT)
+        if (!status && m_reusePort)
+        {
+            // Share the listening port with other server transports.
+            result = setsockopt(serverSocket, SOL_SOCKET, SO_REUSEPORT, (const void *)&yes, sizeof(yes));
+            if (result < 0)
+            {
+                TCP_DEBUG_ERR("setsockopt failed");
+                status = true;
+            }
+        }
+#endif
+
         if (!status)
         {
             // Bind socket to address.
@@ -321,6 +339,7 @@ void TCPTransport::serverThread(void)
                 {
                     // Successfully accepted a connection.
                     m_socket = incomingSocket;
+                    countStat(&erpc_transport_stats_t::connects);
                     // should be inherited from accept() socket but it's not always ...
                     yes = 1;
 #if defined(__MINGW32__)
@@ -343,3 +362,76 @@ void TCPTransport::serverThread(void)
     }
 }
 
+#if defined(__linux__)
+erpc_status_t TCPTransport::sendFile(MessageBuffer *message, int fd, uint64_t offset, uint32_t size)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    uint32_t messageLength;
+    uint32_t frameSize;
+    uint64_t pageOffset;
+    uint8_t *map;
+    uint16_t crcBody;
+    off_t fileOffset;
+    ssize_t result;
+
+    erpc_assert((m_crcImpl != NULL) && ("Uninitialized Crc16 object." != NULL));
+
+    messageLength = message->getUsed() - reserveHeaderSize();
+    if ((size == 0U) || ((messageLength + size) > UINT16_MAX))
+    {
+        return kErpcStatus_InvalidArgument;
+    }
+
+    // CRC of the frame covers the file data. They are read through a mapping of the page cache, not copied.
+    pageOffset = offset % static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    map = static_cast<uint8_t *>(
+        mmap(NULL, pageOffset + size, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(offset - pageOffset)));
+    if (map == MAP_FAILED)
+    {
+        return kErpcStatus_InvalidArgument;
+    }
+    crcBody = m_crcImpl->computeCRC16(&message->get()[reserveHeaderSize()], messageLength);
+    crcBody = m_crcImpl->updateCRC16(crcBody, &map[pageOffset], size);
+    (void)munmap(map, pageOffset + size);
+
+    writeHeader(message, static_cast<uint16_t>(messageLength + size), crcBody);
+    frameSize = message->getUsed() + size;
+    status = SockTransport::underlyingSend(message->get(), message->getUsed());
+
+    fileOffset = static_cast<off_t>(offset);
+    while ((status == kErpcStatus_Success) && (size > 0U))
+    {
+        result = sendfile(m_socket, fd, &fileOffset, size);
+        countStat(&erpc_transport_stats_t::syscalls);
+        if (result > 0)
+        {
+            if (static_cast<uint32_t>(result) < size)
+            {
+                countStat(&erpc_transport_stats_t::partialTransfers);
+            }
+            size -= static_cast<uint32_t>(result);
+        }
+        else if ((result < 0) && (errno == EINTR))
+        {
+            countStat(&erpc_transport_stats_t::wouldBlock);
+        }
+        else if ((result < 0) && (errno == EPIPE))
+        {
+            // close socket, not server
+            countStat(&erpc_transport_stats_t::disconnects);
+            close(false);
+            status = kErpcStatus_ConnectionClosed;
+        }
+        else
+        {
+            // File ended or failed after the header went out, the frame cannot be completed.
+            close(false);
+            status = kErpcStatus_SendFailed;
+        }
+    }
+    countSend(status, frameSize);
+
+    return status;
+}
+#endif
+
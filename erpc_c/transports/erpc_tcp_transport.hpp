@@ -63,9 +63,48 @@ public:
      */
     void configure(const char *host, uint16_t port);
 
+    /*!
+     * @brief This function enables sharing of the listening port between server transports.
+     *
+     * When enabled, the server socket is bound with SO_REUSEPORT, so several server transports
+     * (each one typically served by its own thread and SimpleServer) can listen on the same port.
+     * The kernel then spreads incoming connections between them and a connection never migrates
+     * to another transport. Has to be called before open(). Ignored on systems without SO_REUSEPORT.
+     *
+     * @param[in] reusePort True to share the listening port with other server transports.
+     */
+    void setReusePort(bool reusePort) { m_reusePort = reusePort; }
+
+#if defined(__linux__)
+    /*!
+     * @brief This function sends message whose data end with a part of a file.
+     *
+     * Message buffer holds the beginning of the message as encoded by the codec, e.g. everything up to and including
+     * the length of a trailing binary parameter. Size bytes of the file at offset follow it on the wire. They are sent
+     * by sendfile() from the page cache, without copying them through the application. Peer receives one ordinary
+     * frame. The file is mapped to compute CRC of the frame, it must not change until the function returns.
+     *
+     * Generated code and the C setup API do not use it. It serves hand written C++ callers which build the request
+     * with the codec of the client (reserving reserveHeaderSize() bytes at the start of the buffer), send it with this
+     * function in place of send() and then receive the reply from the transport as usual.
+     *
+     * @param[in] message Message buffer with the beginning of the message.
+     * @param[in] fd File to send data from.
+     * @param[in] offset Offset of the data in the file.
+     * @param[in] size Count of bytes to send from the file.
+     *
+     * @retval #kErpcStatus_Success When the whole frame was sent.
+     * @retval #kErpcStatus_InvalidArgument Frame would be larger than 64 KiB or file could not be mapped.
+     * @retval #kErpcStatus_SendFailed When writing data ends with error, connection is closed then.
+     * @retval #kErpcStatus_ConnectionClosed Peer closed the connection.
+     */
+    erpc_status_t sendFile(MessageBuffer *message, int fd, uint64_t offset, uint32_t size);
+#endif
+
 protected:
     const char *m_host; /*!< Specify the host name or IP address of the computer. */
     uint16_t m_port;    /*!< Specify the listening port number. */
+    bool m_reusePort;   /*!< Listening port is shared with other server transports. */
 
     /*!
      * @brief This function connect client to the server.
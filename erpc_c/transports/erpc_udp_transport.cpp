@@ -0,0 +1,520 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_udp_transport.hpp"
+
+#include ENDIANNESS_HEADER
+
+#include <cstdio>
+#include <cstring>
+
+extern "C" {
+#include <errno.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <unistd.h>
+}
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Header flag telling the datagram carries CRC of the message.
+#define UDP_FLAG_CRC (1U)
+
+//! @brief Offsets of header fields.
+#define UDP_SEQUENCE_OFFSET (0U)
+#define UDP_CRC_OFFSET (4U)
+#define UDP_FLAGS_OFFSET (6U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+UdpTransport::UdpTransport(const char *host, uint16_t port, bool isServer) :
+Transport(), m_host(host), m_port(port), m_isServer(isServer), m_socket(-1), m_crcImpl(NULL), m_crcEnabled(true),
+m_sendSequence(0), m_replyPeer(), m_replyPeerLength(0), m_peer(), m_peerLength(0), m_expectedSequence(0),
+m_receivedCount(0), m_droppedCount(0), m_outOfOrderCount(0), m_invalidCount(0), m_sendBatch(1), m_txCount(0),
+m_rxCount(0), m_rxIndex(0)
+#if !ERPC_THREADS_IS(NONE)
+,
+m_sendLock(false), m_receiveLock(false)
+#endif
+{
+}
+
+UdpTransport::~UdpTransport(void)
+{
+    (void)close();
+}
+
+erpc_status_t UdpTransport::open(void)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    struct addrinfo hints = {};
+    struct addrinfo *res0;
+    struct addrinfo *res;
+    char portString[8];
+    int sock = -1;
+    int result;
+
+    if (m_socket != -1)
+    {
+        return kErpcStatus_Success;
+    }
+
+    hints.ai_flags = AI_NUMERICSERV;
+    hints.ai_family = PF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    if (m_isServer)
+    {
+        hints.ai_flags |= AI_PASSIVE;
+    }
+
+    (void)snprintf(portString, sizeof(portString), "%d", m_port);
+
+    result = getaddrinfo(m_host, portString, &hints, &res0);
+    if (result != 0)
+    {
+        status = kErpcStatus_UnknownName;
+    }
+    else
+    {
+        // Use first address which works.
+        for (res = res0; res != NULL; res = res->ai_next)
+        {
+            sock = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+            if (sock < 0)
+            {
+                continue;
+            }
+
+            if (m_isServer)
+            {
+                result = bind(sock, res->ai_addr, res->ai_addrlen);
+            }
+            else
+            {
+                // Connected socket sends by send() and receives only from the server.
+                result = connect(sock, res->ai_addr, res->ai_addrlen);
+            }
+
+            if (result == 0)
+            {
+                break;
+            }
+
+            ::close(sock);
+            sock = -1;
+        }
+
+        freeaddrinfo(res0);
+
+        if (sock < 0)
+        {
+            status = kErpcStatus_ConnectionFailure;
+        }
+        else
+        {
+            m_socket = sock;
+            m_replyPeerLength = 0;
+            m_peerLength = 0;
+            m_txCount = 0;
+            m_rxCount = 0;
+            m_rxIndex = 0;
+        }
+    }
+
+    return status;
+}
+
+erpc_status_t UdpTransport::close(void)
+{
+    if (m_socket != -1)
+    {
+        (void)flush();
+        ::close(m_socket);
+        m_socket = -1;
+    }
+
+    return kErpcStatus_Success;
+}
+
+erpc_status_t UdpTransport::setSendBatch(uint32_t count)
+{
+    erpc_status_t status = kErpcStatus_Success;
+
+    if ((count == 0U) || (count > ERPC_UDP_BATCH_SIZE))
+    {
+        status = kErpcStatus_InvalidArgument;
+    }
+    else
+    {
+#if !ERPC_THREADS_IS(NONE)
+        Mutex::Guard lock(m_sendLock);
+#endif
+        // Messages gathered for previous batch size are sent now.
+        if (count < m_sendBatch)
+        {
+            status = flushLocked();
+        }
+        m_sendBatch = count;
+    }
+
+    return status;
+}
+
+void UdpTransport::setCrc16(Crc16 *crcImpl)
+{
+    erpc_assert(crcImpl);
+    m_crcImpl = crcImpl;
+}
+
+bool UdpTransport::hasMessage(void)
+{
+    struct pollfd fd;
+
+    if (m_rxIndex < m_rxCount)
+    {
+        return true;
+    }
+
+    fd.fd = m_socket;
+    fd.events = POLLIN;
+    fd.revents = 0;
+
+    return (m_socket != -1) && (poll(&fd, 1, 0) > 0);
+}
+
+erpc_status_t UdpTransport::receiveBatch(void)
+{
+    struct mmsghdr msgs[ERPC_UDP_BATCH_SIZE];
+    struct iovec iov[ERPC_UDP_BATCH_SIZE];
+    int result;
+
+    (void)memset(msgs, 0, sizeof(msgs));
+    for (uint32_t i = 0; i < ERPC_UDP_BATCH_SIZE; ++i)
+    {
+        iov[i].iov_base = m_rxData[i];
+        iov[i].iov_len = sizeof(m_rxData[i]);
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &m_rxAddr[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(m_rxAddr[i]);
+    }
+
+    // Block for the first datagram only, then take those already waiting.
+    do
+    {
+        result = recvmmsg(m_socket, msgs, ERPC_UDP_BATCH_SIZE, MSG_WAITFORONE, NULL);
+    } while ((result < 0) && (errno == EINTR));
+
+    if (result <= 0)
+    {
+        return kErpcStatus_ReceiveFailed;
+    }
+
+    for (int i = 0; i < result; ++i)
+    {
+        m_rxLength[i] = msgs[i].msg_len;
+        m_rxFlags[i] = static_cast<uint32_t>(msgs[i].msg_hdr.msg_flags);
+        m_rxAddrLength[i] = msgs[i].msg_hdr.msg_namelen;
+    }
+    m_rxCount = static_cast<uint32_t>(result);
+    m_rxIndex = 0;
+
+    return kErpcStatus_Success;
+}
+
+bool UdpTransport::acceptDatagram(uint32_t index)
+{
+    const uint8_t *data = m_rxData[index];
+    uint32_t sequence;
+    uint16_t crc;
+    uint16_t flags;
+    int32_t gap;
+
+    if (((m_rxFlags[index] & MSG_TRUNC) != 0U) || (m_rxLength[index] < kHeaderSize))
+    {
+        return false;
+    }
+
+    (void)memcpy(&sequence, &data[UDP_SEQUENCE_OFFSET], sizeof(sequence));
+    (void)memcpy(&crc, &data[UDP_CRC_OFFSET], sizeof(crc));
+    (void)memcpy(&flags, &data[UDP_FLAGS_OFFSET], sizeof(flags));
+    ERPC_READ_AGNOSTIC_32(sequence);
+    ERPC_READ_AGNOSTIC_16(crc);
+    ERPC_READ_AGNOSTIC_16(flags);
+
+    if ((flags & UDP_FLAG_CRC) != 0U)
+    {
+        if ((m_crcImpl == NULL) ||
+            (m_crcImpl->computeCRC16(&data[kHeaderSize], m_rxLength[index] - kHeaderSize) != crc))
+        {
+            return false;
+        }
+    }
+
+    // Server could not deliver a reply, client accepts credits only.
+    if (!hasAllowedType(data, m_rxLength[index], !m_isServer))
+    {
+        return false;
+    }
+
+    if ((m_peerLength != m_rxAddrLength[index]) || (memcmp(&m_peer, &m_rxAddr[index], m_peerLength) != 0))
+    {
+        // New sender, its sequence numbers are tracked from now on.
+        (void)memcpy(&m_peer, &m_rxAddr[index], m_rxAddrLength[index]);
+        m_peerLength = m_rxAddrLength[index];
+        setReplyPeer(index);
+    }
+    else
+    {
+        gap = static_cast<int32_t>(sequence - m_expectedSequence);
+        if (gap > 0)
+        {
+            m_droppedCount += static_cast<uint32_t>(gap);
+        }
+        else if (gap < 0)
+        {
+            // Late datagram was already counted as lost.
+            ++m_outOfOrderCount;
+            if (m_droppedCount > 0U)
+            {
+                --m_droppedCount;
+            }
+            ++m_receivedCount;
+            return true;
+        }
+    }
+
+    m_expectedSequence = sequence + 1U;
+    ++m_receivedCount;
+
+    return true;
+}
+
+void UdpTransport::setReplyPeer(uint32_t index)
+{
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_sendLock);
+#endif
+
+    // Messages gathered for the previous sender go to it.
+    (void)flushLocked();
+    (void)memcpy(&m_replyPeer, &m_rxAddr[index], m_rxAddrLength[index]);
+    m_replyPeerLength = m_rxAddrLength[index];
+}
+
+bool UdpTransport::hasAllowedType(const uint8_t *data, uint32_t length, bool fromServer)
+{
+    uint32_t header;
+    message_type_t type;
+
+    if (length < (kHeaderSize + sizeof(header)))
+    {
+        return false;
+    }
+
+    // First word of codec data: version, service, method and message type in the lowest byte.
+    (void)memcpy(&header, &data[kHeaderSize], sizeof(header));
+    ERPC_READ_AGNOSTIC_32(header);
+
+    type = static_cast<message_type_t>(header & 0xFFU);
+    if (fromServer)
+    {
+        return type == message_type_t::kCreditMessage;
+    }
+
+    return (type == message_type_t::kOnewayMessage) || (type == message_type_t::kCreditedOnewayMessage);
+}
+
+erpc_status_t UdpTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    uint32_t index;
+    bool received = false;
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_receiveLock);
+#endif
+
+    if (m_socket == -1)
+    {
+        return kErpcStatus_ConnectionFailure;
+    }
+
+    while (!received && (status == kErpcStatus_Success))
+    {
+        if (m_rxIndex == m_rxCount)
+        {
+            status = receiveBatch();
+            continue;
+        }
+
+        index = m_rxIndex;
+        ++m_rxIndex;
+
+        if (!acceptDatagram(index) || (m_rxLength[index] > message->getLength()))
+        {
+            ++m_invalidCount;
+            continue;
+        }
+
+        (void)memcpy(message->get(), m_rxData[index], m_rxLength[index]);
+        message->setUsed(static_cast<uint16_t>(m_rxLength[index]));
+        received = true;
+    }
+
+    return status;
+}
+
+erpc_status_t UdpTransport::send(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    uint8_t *data = message->get();
+    uint32_t length = message->getUsed();
+    uint32_t sequence;
+    uint16_t crc = 0;
+    uint16_t flags = 0;
+    ssize_t result;
+
+    erpc_assert(length >= kHeaderSize);
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_sendLock);
+#endif
+
+    if (!hasAllowedType(data, length, m_isServer))
+    {
+        // Invocation or reply could be lost and block the client forever.
+        return kErpcStatus_InvalidArgument;
+    }
+    if ((m_socket == -1) || (m_isServer && (m_replyPeerLength == 0U)))
+    {
+        return kErpcStatus_ConnectionFailure;
+    }
+    if (length > ERPC_UDP_MAX_DATAGRAM_SIZE)
+    {
+        return kErpcStatus_SendFailed;
+    }
+
+    sequence = m_sendSequence++;
+    if (m_crcEnabled && (m_crcImpl != NULL))
+    {
+        crc = m_crcImpl->computeCRC16(&data[kHeaderSize], length - kHeaderSize);
+        flags |= UDP_FLAG_CRC;
+    }
+    ERPC_WRITE_AGNOSTIC_32(sequence);
+    ERPC_WRITE_AGNOSTIC_16(crc);
+    ERPC_WRITE_AGNOSTIC_16(flags);
+    (void)memcpy(&data[UDP_SEQUENCE_OFFSET], &sequence, sizeof(sequence));
+    (void)memcpy(&data[UDP_CRC_OFFSET], &crc, sizeof(crc));
+    (void)memcpy(&data[UDP_FLAGS_OFFSET], &flags, sizeof(flags));
+
+    if (m_sendBatch > 1U)
+    {
+        // Message buffer is reused by caller, so gathered messages are copied.
+        (void)memcpy(m_txData[m_txCount], data, length);
+        m_txLength[m_txCount] = static_cast<uint16_t>(length);
+        ++m_txCount;
+        if (m_txCount >= m_sendBatch)
+        {
+            status = flushLocked();
+        }
+    }
+    else
+    {
+        do
+        {
+            if (m_isServer)
+            {
+                result = sendto(m_socket, data, length, 0, reinterpret_cast<struct sockaddr *>(&m_replyPeer),
+                                m_replyPeerLength);
+            }
+            else
+            {
+                result = ::send(m_socket, data, length, 0);
+            }
+            // ECONNREFUSED reports an earlier datagram which nobody received, not this one.
+        } while ((result < 0) && ((errno == EINTR) || (errno == ECONNREFUSED)));
+
+        if (result < 0)
+        {
+            status = kErpcStatus_SendFailed;
+        }
+    }
+
+    return status;
+}
+
+erpc_status_t UdpTransport::flush(void)
+{
+#if !ERPC_THREADS_IS(NONE)
+    Mutex::Guard lock(m_sendLock);
+#endif
+
+    return flushLocked();
+}
+
+erpc_status_t UdpTransport::flushLocked(void)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    struct mmsghdr msgs[ERPC_UDP_BATCH_SIZE];
+    struct iovec iov[ERPC_UDP_BATCH_SIZE];
+    uint32_t sent = 0;
+    int result;
+
+    if (m_txCount == 0U)
+    {
+        return kErpcStatus_Success;
+    }
+
+    (void)memset(msgs, 0, sizeof(msgs));
+    for (uint32_t i = 0; i < m_txCount; ++i)
+    {
+        iov[i].iov_base = m_txData[i];
+        iov[i].iov_len = m_txLength[i];
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        if (m_isServer)
+        {
+            msgs[i].msg_hdr.msg_name = &m_replyPeer;
+            msgs[i].msg_hdr.msg_namelen = m_replyPeerLength;
+        }
+    }
+
+    while (sent < m_txCount)
+    {
+        result = sendmmsg(m_socket, &msgs[sent], m_txCount - sent, 0);
+        if (result > 0)
+        {
+            sent += static_cast<uint32_t>(result);
+        }
+        else if ((result < 0) && (errno != EINTR) && (errno != ECONNREFUSED))
+        {
+            status = kErpcStatus_SendFailed;
+            break;
+        }
+    }
+
+    m_txCount = 0;
+
+    return status;
+}
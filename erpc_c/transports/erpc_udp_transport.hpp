@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__UDP_TRANSPORT_H_
+#define _EMBEDDED_RPC__UDP_TRANSPORT_H_
+
+#include "erpc_codec.hpp"
+#include "erpc_config_internal.h"
+#include "erpc_crc16.hpp"
+#include "erpc_message_buffer.hpp"
+#include "erpc_threading.h"
+#include "erpc_transport.hpp"
+
+extern "C" {
+#include <sys/socket.h>
+}
+
+/*!
+ * @addtogroup udp_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief UDP transport for oneway messages.
+ *
+ * Each message is sent as one datagram with a small header carrying a sequence number and an optional CRC. Lost
+ * datagrams are not retransmitted, so a lost message never delays the following ones. A lost invocation or reply
+ * would block the client, so the transport carries oneway messages only: client send() rejects other messages and
+ * server receive() drops them.
+ *
+ * Receiver counts datagrams which were lost or arrived out of order, judging by the sequence numbers of one sender.
+ * Datagrams are received by recvmmsg() in batches of up to #ERPC_UDP_BATCH_SIZE. Sender can gather several messages
+ * and send them by one sendmmsg() call, see setSendBatch().
+ *
+ * Server sends only credit messages (#ERPC_ONEWAY_CREDITS), to the sender of the last received datagram. They can be
+ * lost like any datagram, so clients with credits enabled should use fail fast mode.
+ *
+ * @ingroup udp_transport
+ */
+class UdpTransport : public Transport
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * This function initializes object attributes.
+     *
+     * @param[in] host Host name or IP address to send to (client) or to bind to (server).
+     * @param[in] port Port number to send to (client) or to bind to (server).
+     * @param[in] isServer True when this transport is used for server side application.
+     */
+    UdpTransport(const char *host, uint16_t port, bool isServer);
+
+    /*!
+     * @brief UdpTransport destructor
+     */
+    virtual ~UdpTransport(void);
+
+    /*!
+     * @brief This function creates the socket and binds it (server) or connects it (client).
+     *
+     * @retval #kErpcStatus_Success When socket is ready.
+     * @retval #kErpcStatus_UnknownName Host name resolution failed.
+     * @retval #kErpcStatus_ConnectionFailure Socket could not be created, bound or connected.
+     */
+    erpc_status_t open(void);
+
+    /*!
+     * @brief This function sends gathered messages and closes the socket.
+     *
+     * @retval #kErpcStatus_Success Always return this.
+     */
+    erpc_status_t close(void);
+
+    /*!
+     * @brief This function sets whether sent datagrams carry CRC of the message.
+     *
+     * Receiver checks CRC of each datagram which has it, whatever its own setting is. Needs CRC-16 object, which is set
+     * by client and server setup functions.
+     *
+     * @param[in] enabled True to compute CRC of sent messages (default), false to save the time.
+     */
+    void setCrcEnabled(bool enabled) { m_crcEnabled = enabled; }
+
+    /*!
+     * @brief This function sets count of messages gathered before they are sent.
+     *
+     * Gathered messages are copied and sent together by one sendmmsg() call, when their count reaches the batch size or
+     * when flush() is called. Batch size one sends each message directly.
+     *
+     * @param[in] count Count of messages sent together, from 1 (default) to #ERPC_UDP_BATCH_SIZE.
+     *
+     * @retval #kErpcStatus_Success Batch size was set.
+     * @retval #kErpcStatus_InvalidArgument Count is out of range.
+     */
+    erpc_status_t setSendBatch(uint32_t count);
+
+    /*!
+     * @brief This function sends all gathered messages.
+     *
+     * @retval #kErpcStatus_Success When all messages were sent.
+     * @retval #kErpcStatus_SendFailed When sending failed, the messages are dropped.
+     */
+    erpc_status_t flush(void);
+
+    /*!
+     * @brief Size of datagram header placed before serialized eRPC data.
+     *
+     * @return Size of header.
+     */
+    virtual uint8_t reserveHeaderSize(void) override { return kHeaderSize; }
+
+    /*!
+     * @brief Receive one message.
+     *
+     * Blocks until a valid datagram arrives. Truncated datagrams and datagrams with wrong CRC are dropped.
+     *
+     * @param[in] message Message buffer, to which received data will be stored.
+     *
+     * @retval #kErpcStatus_Success When message was received successfully.
+     * @retval #kErpcStatus_ReceiveFailed When receiving failed.
+     * @retval #kErpcStatus_ConnectionFailure Transport is not open.
+     */
+    virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief Send or gather one message.
+     *
+     * @param[in] message Message buffer to send.
+     *
+     * @retval #kErpcStatus_Success When message was sent or gathered.
+     * @retval #kErpcStatus_SendFailed When sending failed.
+     * @retval #kErpcStatus_ConnectionFailure Transport is not open or server has no peer yet.
+     * @retval #kErpcStatus_InvalidArgument Client message is not oneway, or server message is not credit.
+     */
+    virtual erpc_status_t send(MessageBuffer *message) override;
+
+    /*!
+     * @brief Function to check if is new message to receive.
+     *
+     * @return True if a datagram is waiting.
+     */
+    virtual bool hasMessage(void) override;
+
+    /*!
+     * @brief This functions sets the CRC-16 implementation.
+     *
+     * @param[in] crcImpl Object containing crc-16 compute function.
+     */
+    virtual void setCrc16(Crc16 *crcImpl) override;
+
+    /*!
+     * @brief This functions gets the CRC-16 object.
+     *
+     * @return Crc16* Pointer to CRC-16 object containing crc-16 compute function.
+     */
+    virtual Crc16 *getCrc16(void) override { return m_crcImpl; }
+
+    /*!
+     * @brief Return count of accepted messages.
+     *
+     * @return Count of received messages.
+     */
+    uint32_t getReceivedCount(void) const { return m_receivedCount; }
+
+    /*!
+     * @brief Return count of lost datagrams, judged by gaps in sequence numbers.
+     *
+     * A datagram arriving late is first counted as lost, later as out of order only.
+     *
+     * @return Count of lost datagrams.
+     */
+    uint32_t getDroppedCount(void) const { return m_droppedCount; }
+
+    /*!
+     * @brief Return count of datagrams which arrived after a datagram with higher sequence number.
+     *
+     * @return Count of out of order datagrams.
+     */
+    uint32_t getOutOfOrderCount(void) const { return m_outOfOrderCount; }
+
+    /*!
+     * @brief Return count of dropped invalid datagrams (truncated, too short, wrong CRC, too large for buffer or not
+     * oneway message).
+     *
+     * @return Count of invalid datagrams.
+     */
+    uint32_t getInvalidCount(void) const { return m_invalidCount; }
+
+protected:
+    //! @brief Size of datagram header: sequence number, CRC of message and flags.
+    static const uint8_t kHeaderSize = 8U;
+
+    const char *m_host; /*!< Host name or IP address. */
+    uint16_t m_port;    /*!< Port number. */
+    bool m_isServer;    /*!< If true then server is using transport, else client. */
+    int m_socket;       /*!< Socket number. */
+    Crc16 *m_crcImpl;   /*!< CRC object. */
+    bool m_crcEnabled;  /*!< Sent messages carry CRC. */
+
+    uint32_t m_sendSequence;             /*!< Sequence number of next sent datagram. */
+    struct sockaddr_storage m_replyPeer; /*!< Address server messages go to, guarded by m_sendLock. */
+    socklen_t m_replyPeerLength;         /*!< Length of m_replyPeer, zero when unknown. */
+    struct sockaddr_storage m_peer;      /*!< Sender whose sequence numbers are tracked, guarded by m_receiveLock. */
+    socklen_t m_peerLength;              /*!< Length of m_peer, zero when unknown. */
+    uint32_t m_expectedSequence;         /*!< Sequence number expected from m_peer. */
+    uint32_t m_receivedCount;            /*!< Count of accepted messages. */
+    uint32_t m_droppedCount;             /*!< Count of lost datagrams. */
+    uint32_t m_outOfOrderCount;          /*!< Count of out of order datagrams. */
+    uint32_t m_invalidCount;             /*!< Count of invalid datagrams. */
+
+    uint32_t m_sendBatch;                                        /*!< Count of messages sent together. */
+    uint32_t m_txCount;                                          /*!< Count of gathered messages. */
+    uint16_t m_txLength[ERPC_UDP_BATCH_SIZE];                    /*!< Lengths of gathered messages. */
+    uint8_t m_txData[ERPC_UDP_BATCH_SIZE][ERPC_UDP_MAX_DATAGRAM_SIZE]; /*!< Gathered messages. */
+
+    uint32_t m_rxCount;                                          /*!< Count of datagrams of last batch. */
+    uint32_t m_rxIndex;                                          /*!< Next datagram of last batch to handle. */
+    uint32_t m_rxLength[ERPC_UDP_BATCH_SIZE];                    /*!< Lengths of received datagrams. */
+    uint32_t m_rxFlags[ERPC_UDP_BATCH_SIZE];                     /*!< Flags of received datagrams. */
+    struct sockaddr_storage m_rxAddr[ERPC_UDP_BATCH_SIZE];       /*!< Senders of received datagrams. */
+    socklen_t m_rxAddrLength[ERPC_UDP_BATCH_SIZE];               /*!< Lengths of sender addresses. */
+    uint8_t m_rxData[ERPC_UDP_BATCH_SIZE][ERPC_UDP_MAX_DATAGRAM_SIZE]; /*!< Received datagrams. */
+
+#if !ERPC_THREADS_IS(NONE)
+    Mutex m_sendLock;    /*!< Mutex protecting send. */
+    Mutex m_receiveLock; /*!< Mutex protecting receive. */
+#endif
+
+    /*!
+     * @brief Receive next batch of datagrams, blocks until at least one arrives.
+     *
+     * @retval #kErpcStatus_Success At least one datagram was received.
+     * @retval #kErpcStatus_ReceiveFailed When receiving failed.
+     */
+    erpc_status_t receiveBatch(void);
+
+    /*!
+     * @brief Check received datagram and update counters.
+     *
+     * @param[in] index Index of datagram in last batch.
+     *
+     * @return True when datagram is valid.
+     */
+    bool acceptDatagram(uint32_t index);
+
+    /*!
+     * @brief Make the sender of a received datagram the address of server messages.
+     *
+     * @param[in] index Index of datagram in last batch.
+     */
+    void setReplyPeer(uint32_t index);
+
+    /*!
+     * @brief Check that the message may be carried by this transport.
+     *
+     * Client sends oneway messages, with or without waiting for credit, server sends credit messages.
+     *
+     * @param[in] data Message including datagram header.
+     * @param[in] length Length of the message.
+     * @param[in] fromServer Message is sent by server.
+     *
+     * @return True when message has type allowed for its sender.
+     */
+    static bool hasAllowedType(const uint8_t *data, uint32_t length, bool fromServer);
+
+    /*!
+     * @brief Send gathered messages, m_sendLock must be locked.
+     *
+     * @retval #kErpcStatus_Success When all messages were sent.
+     * @retval #kErpcStatus_SendFailed When sending failed, the messages are dropped.
+     */
+    erpc_status_t flushLocked(void);
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__UDP_TRANSPORT_H_
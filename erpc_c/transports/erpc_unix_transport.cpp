@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_unix_transport.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+extern "C" {
+// Set this to 1 to enable debug logging.
+//#define UNIX_TRANSPORT_DEBUG_LOG (1)
+
+#if defined(__MINGW32__)
+#error Unix domain socket transport is not supported on Windows.
+#endif
+
+#if UNIX_TRANSPORT_DEBUG_LOG
+#if ERPC_HAS_POSIX
+#include <err.h>
+#endif
+#endif
+#include <errno.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+}
+
+using namespace erpc;
+
+#if UNIX_TRANSPORT_DEBUG_LOG
+#define UNIX_DEBUG_PRINT(_fmt_, ...) printf(_fmt_, ##__VA_ARGS__)
+#define UNIX_DEBUG_ERR(_msg_) err(errno, _msg_)
+#else
+#define UNIX_DEBUG_PRINT(_fmt_, ...)
+#define UNIX_DEBUG_ERR(_msg_)
+#endif
+
+// Where available, suppress SIGPIPE per call instead of ignoring it for the whole process.
+#if defined(MSG_NOSIGNAL)
+#define UNIX_SEND_FLAGS MSG_NOSIGNAL
+#else
+#define UNIX_SEND_FLAGS 0
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Fill in socket address from the socket path.
+ *
+ * @param[in] path File system path of the socket.
+ * @param[out] address Address to fill in.
+ *
+ * @retval true Address was filled in.
+ * @retval false Path is missing or too long.
+ */
+static bool getSocketAddress(const char *path, struct sockaddr_un *address)
+{
+    bool status = false;
+
+    (void)memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+
+    if ((path != NULL) && (strlen(path) < sizeof(address->sun_path)))
+    {
+        (void)strcpy(address->sun_path, path);
+        status = true;
+    }
+
+    return status;
+}
+
+UnixSocketTransport::UnixSocketTransport(bool isServer) :
+SockTransport(isServer), m_path(NULL)
+{
+}
+
+UnixSocketTransport::UnixSocketTransport(const char *path, bool isServer) :
+SockTransport(isServer), m_path(path)
+{
+}
+
+UnixSocketTransport::~UnixSocketTransport(void) {}
+
+void UnixSocketTransport::configure(const char *path)
+{
+    m_path = path;
+}
+
+erpc_status_t UnixSocketTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    struct msghdr msg;
+    struct iovec iov;
+    ssize_t length;
+
+    // Block until we have a valid connection.
+    while (m_socket <= 0)
+    {
+        // Sleep 10 ms.
+        Thread::sleep(10000);
+    }
+
+    iov.iov_base = message->get();
+    iov.iov_len = message->getLength();
+
+    (void)memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    // One packet is one whole message.
+    for (;;)
+    {
+        length = recvmsg(m_socket, &msg, 0);
+        countStat(&erpc_transport_stats_t::syscalls);
+        if ((length >= 0) || (errno != EINTR))
+        {
+            break;
+        }
+        countStat(&erpc_transport_stats_t::wouldBlock);
+    }
+
+    if (length > 0)
+    {
+        if ((msg.msg_flags & MSG_TRUNC) != 0)
+        {
+            // The rest of the packet was discarded by the kernel.
+            UNIX_DEBUG_PRINT("%s", "message does not fit into buffer\n");
+            countStat(&erpc_transport_stats_t::framingErrors);
+            status = kErpcStatus_ReceiveFailed;
+        }
+        else
+        {
+            message->setUsed((uint16_t)length);
+        }
+    }
+    else if (length == 0)
+    {
+        // close socket, not server
+        countStat(&erpc_transport_stats_t::disconnects);
+        close(false);
+        status = kErpcStatus_ConnectionClosed;
+    }
+    else
+    {
+        UNIX_DEBUG_ERR("recvmsg failed");
+        status = kErpcStatus_ReceiveFailed;
+    }
+
+    countReceive(status, (length > 0) ? (uint32_t)length : 0U);
+
+    return status;
+}
+
+erpc_status_t UnixSocketTransport::send(MessageBuffer *message)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    ssize_t result;
+
+    if (m_socket <= 0)
+    {
+        // we should not pretend to have a succesful Send or we create a deadlock
+        status = kErpcStatus_ConnectionFailure;
+    }
+    else
+    {
+        // Whole message is sent as one packet or not at all.
+        for (;;)
+        {
+            result = ::send(m_socket, message->get(), message->getUsed(), UNIX_SEND_FLAGS);
+            countStat(&erpc_transport_stats_t::syscalls);
+            if ((result >= 0) || (errno != EINTR))
+            {
+                break;
+            }
+            countStat(&erpc_transport_stats_t::wouldBlock);
+        }
+
+        if (result < 0)
+        {
+            if (errno == EPIPE)
+            {
+                // close socket, not server
+                countStat(&erpc_transport_stats_t::disconnects);
+                close(false);
+                status = kErpcStatus_ConnectionClosed;
+            }
+            else
+            {
+                UNIX_DEBUG_ERR("send failed");
+                status = kErpcStatus_SendFailed;
+            }
+        }
+    }
+
+    countSend(status, message->getUsed());
+
+    return status;
+}
+
+erpc_status_t UnixSocketTransport::connectClient(void)
+{
+    erpc_status_t status = kErpcStatus_Success;
+    struct sockaddr_un address;
+    int sock;
+
+    if (m_socket != -1)
+    {
+        UNIX_DEBUG_PRINT("%s", "socket already connected\n");
+    }
+    else if (!getSocketAddress(m_path, &address))
+    {
+        UNIX_DEBUG_PRINT("%s", "invalid socket path\n");
+        status = kErpcStatus_InvalidArgument;
+    }
+    else
+    {
+        sock = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+        if (sock < 0)
+        {
+            UNIX_DEBUG_ERR("failed to create socket");
+            status = kErpcStatus_ConnectionFailure;
+        }
+        else if (connect(sock, (struct sockaddr *)&address, sizeof(address)) < 0)
+        {
+            ::close(sock);
+            UNIX_DEBUG_ERR("connecting failed");
+            status = kErpcStatus_ConnectionFailure;
+        }
+        else
+        {
+#if !defined(MSG_NOSIGNAL)
+            // globally disable the SIGPIPE signal
+            signal(SIGPIPE, SIG_IGN);
+#endif
+            m_socket = sock;
+            countStat(&erpc_transport_stats_t::connects);
+        }
+    }
+
+    return status;
+}
+
+void UnixSocketTransport::serverThread(void)
+{
+    int serverSocket;
+    int result;
+    int incomingSocket;
+    bool status = false;
+    struct sockaddr_un serverAddress;
+
+    UNIX_DEBUG_PRINT("%s", "in server thread\n");
+
+    if (!getSocketAddress(m_path, &serverAddress))
+    {
+        UNIX_DEBUG_PRINT("%s", "invalid socket path\n");
+    }
+    else
+    {
+        // Create socket.
+        serverSocket = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+        if (serverSocket < 0)
+        {
+            UNIX_DEBUG_ERR("failed to create server socket");
+        }
+        else
+        {
+            // Remove socket file left by previous server.
+            (void)unlink(m_path);
+
+            // Bind socket to address.
+            result = bind(serverSocket, (struct sockaddr *)&serverAddress, sizeof(serverAddress));
+            if (result < 0)
+            {
+                UNIX_DEBUG_ERR("bind failed");
+                status = true;
+            }
+
+            if (!status)
+            {
+                // Listen for connections.
+                result = listen(serverSocket, 1);
+                if (result < 0)
+                {
+                    UNIX_DEBUG_ERR("listen failed");
+                    status = true;
+                }
+            }
+
+            if (!status)
+            {
+                UNIX_DEBUG_PRINT("%s", "Listening for connections\n");
+#if !defined(MSG_NOSIGNAL)
+                // globally disable the SIGPIPE signal
+                signal(SIGPIPE, SIG_IGN);
+#endif
+
+                while (m_runServer)
+                {
+                    // we should use select() otherwise we can't end the server properly
+                    incomingSocket = accept(serverSocket, NULL, NULL);
+                    if (incomingSocket > 0)
+                    {
+                        // Successfully accepted a connection.
+                        m_socket = incomingSocket;
+                        countStat(&erpc_transport_stats_t::connects);
+                    }
+                    else
+                    {
+                        UNIX_DEBUG_ERR("accept failed");
+                    }
+                }
+
+                (void)unlink(m_path);
+            }
+            ::close(serverSocket);
+        }
+    }
+}
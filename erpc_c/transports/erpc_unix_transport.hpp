@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__UNIX_TRANSPORT_H_
+#define _EMBEDDED_RPC__UNIX_TRANSPORT_H_
+
+#include "erpc_sock_transport.hpp"
+
+/*!
+ * @addtogroup unix_transport
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpc {
+/*!
+ * @brief Unix domain socket transport.
+ *
+ * The transport uses SOCK_SEQPACKET sockets, which keep message boundaries and deliver messages reliably and in
+ * order. Each message is therefore sent as one packet and received by a single recvmsg() call directly into the
+ * message buffer, without the length header and CRC of the framed transports.
+ *
+ * @ingroup unix_transport
+ */
+class UnixSocketTransport : public SockTransport
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * This function initializes object attributes.
+     *
+     * @param[in] isServer True when this transport is used for server side application.
+     */
+    explicit UnixSocketTransport(bool isServer);
+
+    /*!
+     * @brief Constructor.
+     *
+     * This function initializes object attributes.
+     *
+     * @param[in] path Specify the file system path of the socket.
+     * @param[in] isServer True when this transport is used for server side application.
+     */
+    UnixSocketTransport(const char *path, bool isServer);
+
+    /*!
+     * @brief UnixSocketTransport destructor
+     */
+    virtual ~UnixSocketTransport(void);
+
+    /*!
+     * @brief This function set socket path of this transport layer.
+     *
+     * @param[in] path Specify the file system path of the socket.
+     */
+    void configure(const char *path);
+
+    /*!
+     * @brief Messages are not framed, so no header space is reserved.
+     *
+     * @return Always zero.
+     */
+    virtual uint8_t reserveHeaderSize(void) override { return 0; }
+
+    /*!
+     * @brief Receive one message.
+     *
+     * Blocks until a client is connected and a message arrives.
+     *
+     * @param[in] message Message buffer, to which received data will be stored.
+     *
+     * @retval #kErpcStatus_Success When message was received successfully.
+     * @retval #kErpcStatus_ReceiveFailed When receiving failed or the message does not fit into the buffer.
+     * @retval #kErpcStatus_ConnectionClosed Peer closed the connection.
+     */
+    virtual erpc_status_t receive(MessageBuffer *message) override;
+
+    /*!
+     * @brief Send one message.
+     *
+     * @param[in] message Message buffer to send.
+     *
+     * @retval #kErpcStatus_Success When message was sent successfully.
+     * @retval #kErpcStatus_SendFailed When sending failed.
+     * @retval #kErpcStatus_ConnectionFailure No peer is connected.
+     * @retval #kErpcStatus_ConnectionClosed Peer closed the connection.
+     */
+    virtual erpc_status_t send(MessageBuffer *message) override;
+
+protected:
+    const char *m_path; /*!< Specify the file system path of the socket. */
+
+    /*!
+     * @brief This function connect client to the server.
+     *
+     * @retval kErpcStatus_Success When client connected successfully.
+     * @retval kErpcStatus_InvalidArgument Socket path is too long.
+     * @retval kErpcStatus_ConnectionFailure When client doesn't connected successfully.
+     */
+    virtual erpc_status_t connectClient(void);
+
+    /*!
+     * @brief Server thread function.
+     */
+    virtual void serverThread(void);
+};
+
+} // namespace erpc
+
+/*! @} */
+
+#endif // _EMBEDDED_RPC__UNIX_TRANSPORT_H_
@@ -28,7 +28,17 @@ public enum MessageType {
     /**
      * Notification message.
      */
-    kNotificationMessage(3);
+    kNotificationMessage(3),
+
+    /**
+     * Busy reply of overloaded server.
+     */
+    kBusyMessage(4),
+
+    /**
+     * Oneway credit returned by server.
+     */
+    kCreditMessage(5);
 
     private final int value;
 
@@ -62,6 +72,8 @@ public enum MessageType {
             case 1 -> kOnewayMessage;
             case 2 -> kReplyMessage;
             case 3 -> kNotificationMessage;
+            case 4 -> kBusyMessage;
+            case 5 -> kCreditMessage;
             default -> throw new RuntimeException("Invalid MessageType " + value);
         };
     }
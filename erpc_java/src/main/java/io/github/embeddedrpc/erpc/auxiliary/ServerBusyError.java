@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+package  io.github.embeddedrpc.erpc.auxiliary;
+
+/**
+ * Request error thrown when overloaded server refused the request. Caller should back off and try again later.
+ */
+public class ServerBusyError extends RequestError {
+    /**
+     * Server busy error.
+     *
+     * @param message error message
+     */
+    public ServerBusyError(String message) {
+        super(message);
+    }
+}
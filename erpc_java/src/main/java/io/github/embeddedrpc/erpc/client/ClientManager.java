@@ -13,6 +13,7 @@ import  io.github.embeddedrpc.erpc.auxiliary.MessageType;
 import  io.github.embeddedrpc.erpc.auxiliary.MessageInfo;
 import  io.github.embeddedrpc.erpc.auxiliary.RequestContext;
 import  io.github.embeddedrpc.erpc.auxiliary.RequestError;
+import  io.github.embeddedrpc.erpc.auxiliary.ServerBusyError;
 
 /**
  * Client manager.
@@ -67,6 +68,16 @@ public class ClientManager {
 
             MessageInfo info = request.codec().startReadMessage();
 
+            // This client does not limit one way messages, skip credit returned by the server.
+            while (info.type() == MessageType.kCreditMessage) {
+                request.codec().setArray(this.transport.receive());
+                info = request.codec().startReadMessage();
+            }
+
+            if (info.type() == MessageType.kBusyMessage && info.sequence() == request.sequence()) {
+                throw new ServerBusyError("Server is busy.");
+            }
+
             if (info.type() != MessageType.kReplyMessage) {
                 throw new RequestError("Invalid reply message type.");
             }
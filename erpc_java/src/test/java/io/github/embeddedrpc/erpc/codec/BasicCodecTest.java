@@ -335,6 +335,19 @@ class BasicCodecTest {
         assertEquals(msgInfoExpected, msgInfo);
     }
 
+    @Test
+    void readCreditMessageTest() {
+        String testString = "0501010100000000" + "04000000";
+        MessageInfo msgInfoExpected = new MessageInfo(MessageType.kCreditMessage, 1, 1, 0);
+
+        Codec codec = new BasicCodec(Utils.hexToByteArray(testString));
+
+        MessageInfo msgInfo = codec.startReadMessage();
+
+        assertEquals(msgInfoExpected, msgInfo);
+        assertEquals(4, codec.readUInt32());
+    }
+
     @Test
     void codecToArrayTest() {
         Codec codec = new BasicCodec();
@@ -66,8 +66,8 @@ class TransportArbitrator(Transport):
             # If it's an invocation or oneway, return it to the server.
             if info.type in (MessageType.kInvocationMessage, MessageType.kOnewayMessage):
                 return msg
-            # Ignore unexpected message types.
-            elif info.type != MessageType.kReplyMessage:
+            # Ignore unexpected message types, including credit of oneway messages.
+            elif info.type not in (MessageType.kReplyMessage, MessageType.kBusyMessage):
                 continue
 
             # Look up the client waiting for this reply.
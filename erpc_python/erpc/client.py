@@ -12,6 +12,11 @@ class RequestError(RuntimeError):
     pass
 
 
+class ServerBusyError(RequestError):
+    """Server is overloaded and refused the request, caller should back off and retry."""
+    pass
+
+
 class ClientManager(object):
     def __init__(self, transport=None, codecClass=None):
         self._transport = transport
@@ -71,6 +76,12 @@ class ClientManager(object):
             request.codec.buffer = msg
 
             info = request.codec.start_read_message()
+            # This client does not limit oneway messages, skip credit returned by the server.
+            while token is None and info.type == MessageType.kCreditMessage:
+                request.codec.buffer = self.transport.receive()
+                info = request.codec.start_read_message()
+            if info.type == MessageType.kBusyMessage and info.sequence == request.sequence:
+                raise ServerBusyError("server is busy")
             if info.type != MessageType.kReplyMessage:
                 raise RequestError("invalid reply message type")
             if info.sequence != request.sequence:
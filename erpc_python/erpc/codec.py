@@ -15,6 +15,8 @@ class MessageType(Enum):
     kOnewayMessage = 1
     kReplyMessage = 2
     kNotificationMessage = 3
+    kBusyMessage = 4
+    kCreditMessage = 5
 
 
 MessageInfo = namedtuple(
@@ -1659,6 +1659,17 @@ data_map CGenerator::getFunctionTemplateData(Group *group, Function *fn)
 
     info = getFunctionBaseTemplateData(group, fn);
 
+    Value *priority = getAnnValue(fn, PRIORITY_ANNOTATION);
+    if (priority)
+    {
+        assert(dynamic_cast<IntegerValue *>(priority));
+        info["priority"] = (uint32_t) dynamic_cast<IntegerValue *>(priority)->getValue();
+    }
+    else
+    {
+        info["priority"] = 0;
+    }
+
     // Ignore function shim code. Will be serialized through common function.
     bool useCommonFunction = false;
     if (fn->getFunctionType())
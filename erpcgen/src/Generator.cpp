@@ -471,6 +471,16 @@ data_list Generator::makeGroupInterfacesTemplateData(Group *group)
             }
         }
 
+        ifaceInfo["hasPriorities"] = false;
+        for (Function *fn : iface->getFunctions())
+        {
+            if (findAnnotation(fn, PRIORITY_ANNOTATION))
+            {
+                ifaceInfo["hasPriorities"] = true;
+                break;
+            }
+        }
+
         interfaces.push_back(ifaceInfo);
     }
 
@@ -22,6 +22,7 @@
 #include "types/VoidType.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 
 using namespace erpcgen;
@@ -1783,6 +1784,33 @@ void SymbolScanner::checkAnnotationBeforeAdding(AstNode *annotation, Symbol *sym
             }
         }
     }
+    else if (annotation_name->getTokenString().compare(PRIORITY_ANNOTATION) == 0)
+    {
+        if (!dynamic_cast<Function *>(symbol))
+        {
+            throw semantic_error(format_string("line %d: Priority annotation can only be applied to functions",
+                                               annotation_name->getToken().getFirstLine()));
+        }
+
+        // Check @priority annotation's value.
+        if (!annValue || annValue->getType() != kIntegerValue)
+        {
+            throw semantic_error(format_string("line %d: Priority annotation must have an integer value",
+                                               annotation_name->getToken().getFirstLine()));
+        }
+
+        // Generated services return the priority as uint32_t.
+        IntegerValue *priority = dynamic_cast<IntegerValue *>(annValue);
+        uint64_t value = *priority;
+        bool isSigned = (priority->getIntType() == IntegerValue::kSigned) ||
+                        (priority->getIntType() == IntegerValue::kSignedLong);
+        if ((isSigned && (static_cast<int64_t>(value) < 0)) || (value > UINT32_MAX))
+        {
+            throw semantic_error(
+                format_string("line %d: Priority annotation value must be in range from 0 to %u",
+                              annotation_name->getToken().getFirstLine(), static_cast<unsigned int>(UINT32_MAX)));
+        }
+    }
 }
 
 void SymbolScanner::scanStructForAnnotations()
@@ -61,6 +61,9 @@
 //! Sets the path to write output files into.
 #define OUTPUT_DIR_ANNOTATION "output_dir"
 
+//! Set function scheduling priority used by the priority server.
+#define PRIORITY_ANNOTATION "priority"
+
 //! Strip the specified string from type names in Python output.
 #define PY_TYPES_NAME_STRIP_SUFFIX_ANNOTATION "py_types_name_strip_suffix"
 
@@ -742,7 +742,8 @@ erpc_status_t Sniffer::analyzeMessage(string &message, const char *timeDiffernce
 
     // Set message type.
     msg_t msgType;
-    if ((messageType == message_type_t::kInvocationMessage) || (messageType == message_type_t::kOnewayMessage))
+    if ((messageType == message_type_t::kInvocationMessage) || (messageType == message_type_t::kOnewayMessage) ||
+        (messageType == message_type_t::kCreditedOnewayMessage))
     {
         msgType = msg_t::msg_request;
         message += "'Request'";
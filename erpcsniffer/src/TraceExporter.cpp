@@ -0,0 +1,442 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TraceExporter.hpp"
+
+#include "Logging.hpp"
+#include "format_string.hpp"
+#include "types/Interface.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+using namespace erpcgen;
+using namespace erpcsniffer;
+using namespace std;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Return string escaped for JSON.
+ *
+ * @param[in] text Text to escape.
+ *
+ * @return Escaped text.
+ */
+static string escapeJson(const string &text)
+{
+    string escaped;
+
+    for (char c : text)
+    {
+        if ((c == '"') || (c == '\\'))
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20U)
+        {
+            escaped += format_string("\\u%04x", c);
+        }
+        else
+        {
+            escaped += c;
+        }
+    }
+
+    return escaped;
+}
+
+/*!
+ * @brief Move time by origin unless it was not seen.
+ *
+ * @param[in,out] time Time to move.
+ * @param[in] origin New zero time.
+ */
+static void shiftTime(int64_t &time, int64_t origin)
+{
+    if (time != TraceExporter::kNotSeen)
+    {
+        time -= origin;
+    }
+}
+
+TraceExporter::TraceExporter(InterfaceDefinition *def) :
+m_interfaces(def->getGlobals().getSymbolsOfType(Symbol::symbol_type_t::kInterfaceSymbol)), m_hasReference(false),
+m_reference(0), m_flowId(0)
+{
+}
+
+void TraceExporter::addFile(const string &filePath)
+{
+    ifstream input(filePath, ios::binary);
+    Record record;
+    uint32_t process = m_processNames.size();
+    uint64_t count = 0;
+    map<uint8_t, pair<uint32_t, int64_t> > threadTimes;
+    uint32_t lastRaw = 0;
+    int64_t lastTime = 0;
+
+    if (!input.is_open())
+    {
+        throw runtime_error(format_string("could not open trace file '%s'", filePath.c_str()));
+    }
+
+    m_processNames.push_back(filesystem::path(filePath).filename().string());
+    record.process = process;
+    while (input.read(reinterpret_cast<char *>(&record.record), sizeof(record.record)))
+    {
+        uint32_t raw = record.record.timestamp;
+
+        if (!m_hasReference)
+        {
+            m_reference = raw;
+            m_hasReference = true;
+        }
+        if (count == 0U)
+        {
+            // First record of each file is rebased on the reference, files must start within 35 minutes of it.
+            lastRaw = m_reference;
+        }
+
+        auto it = threadTimes.find(record.record.thread);
+        if (it == threadTimes.end())
+        {
+            // Threads are drained one after another, so records of a new thread may precede the last record.
+            record.time = lastTime + static_cast<int32_t>(raw - lastRaw);
+        }
+        else
+        {
+            // Records of one thread are in order, raw time advances by less than one wrap between them.
+            record.time = it->second.second + static_cast<uint32_t>(raw - it->second.first);
+        }
+        threadTimes[record.record.thread] = make_pair(raw, record.time);
+        lastRaw = raw;
+        lastTime = record.time;
+
+        m_records.push_back(record);
+        ++count;
+    }
+
+    if (input.gcount() != 0)
+    {
+        Log::warning("trace file '%s' ends with partial record\n", filePath.c_str());
+    }
+    Log::info("read %llu records from '%s'\n", static_cast<unsigned long long>(count), filePath.c_str());
+}
+
+void TraceExporter::collectCalls(void)
+{
+    map<client_key_t, size_t> openClientCalls;
+    map<server_key_t, size_t> openServerCalls;
+
+    // Stable sort keeps order of records of one thread which have the same time.
+    stable_sort(m_records.begin(), m_records.end(),
+                [](const Record &a, const Record &b) { return a.time < b.time; });
+
+    for (const Record &item : m_records)
+    {
+        const erpc_trace_record_t &record = item.record;
+        client_key_t clientKey(item.process, record.thread, record.sequence);
+        server_key_t serverKey(item.process, record.serviceId, record.methodId, record.sequence);
+
+        switch (record.event)
+        {
+            case kErpcTrace_RequestCreate:
+            {
+                ClientCall call = {};
+                call.process = item.process;
+                call.thread = record.thread;
+                call.sequence = record.sequence;
+                call.createTime = item.time;
+                call.encodeTime = kNotSeen;
+                call.sendTime = kNotSeen;
+                call.replyTime = kNotSeen;
+                openClientCalls[clientKey] = m_clientCalls.size();
+                m_clientCalls.push_back(call);
+                break;
+            }
+
+            case kErpcTrace_EncodeDone:
+            case kErpcTrace_Send:
+            case kErpcTrace_ReplyReceived:
+            {
+                auto it = openClientCalls.find(clientKey);
+                if (it == openClientCalls.end())
+                {
+                    // Call was created before recording started.
+                    break;
+                }
+                ClientCall &call = m_clientCalls[it->second];
+                call.serviceId = record.serviceId;
+                call.methodId = record.methodId;
+                if (record.event == kErpcTrace_EncodeDone)
+                {
+                    call.encodeTime = item.time;
+                }
+                else if (record.event == kErpcTrace_Send)
+                {
+                    call.sendTime = item.time;
+                    call.requestBytes = record.length;
+                }
+                else
+                {
+                    call.replyTime = item.time;
+                    call.replyBytes = record.length;
+                    openClientCalls.erase(it);
+                }
+                break;
+            }
+
+            case kErpcTrace_Receive:
+            {
+                ServerCall call = {};
+                call.process = item.process;
+                call.thread = record.thread;
+                call.serveThread = record.thread;
+                call.sequence = record.sequence;
+                call.serviceId = record.serviceId;
+                call.methodId = record.methodId;
+                call.receiveTime = item.time;
+                call.dispatchTime = kNotSeen;
+                call.handlerStart = kNotSeen;
+                call.handlerEnd = kNotSeen;
+                call.replyTime = kNotSeen;
+                call.requestBytes = record.length;
+                openServerCalls[serverKey] = m_serverCalls.size();
+                m_serverCallsByRequest[request_key_t(record.serviceId, record.methodId, record.sequence)].push_back(
+                    m_serverCalls.size());
+                m_serverCalls.push_back(call);
+                break;
+            }
+
+            case kErpcTrace_Dispatch:
+            case kErpcTrace_HandlerStart:
+            case kErpcTrace_HandlerEnd:
+            case kErpcTrace_Reply:
+            {
+                auto it = openServerCalls.find(serverKey);
+                if (it == openServerCalls.end())
+                {
+                    break;
+                }
+                ServerCall &call = m_serverCalls[it->second];
+                if (record.event == kErpcTrace_Dispatch)
+                {
+                    // Request can be served by other thread than the receiving one.
+                    call.serveThread = record.thread;
+                    call.dispatchTime = item.time;
+                }
+                else if (record.event == kErpcTrace_HandlerStart)
+                {
+                    call.handlerStart = item.time;
+                }
+                else if (record.event == kErpcTrace_HandlerEnd)
+                {
+                    call.handlerEnd = item.time;
+                }
+                else
+                {
+                    call.replyTime = item.time;
+                    call.replyBytes = record.length;
+                    openServerCalls.erase(it);
+                }
+                break;
+            }
+
+            default:
+            {
+                Log::warning("unknown trace event %u\n", record.event);
+                break;
+            }
+        }
+    }
+}
+
+TraceExporter::ServerCall *TraceExporter::findServerCall(const ClientCall &call)
+{
+    auto it = m_serverCallsByRequest.find(request_key_t(call.serviceId, call.methodId, call.sequence));
+
+    // Sequences are only unique per client, take the first unmatched request received after the send. Server calls
+    // were collected in order of time.
+    if (it != m_serverCallsByRequest.end())
+    {
+        for (size_t index : it->second)
+        {
+            ServerCall &serverCall = m_serverCalls[index];
+            if (!serverCall.matched && (serverCall.receiveTime >= call.sendTime))
+            {
+                return &serverCall;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+string TraceExporter::getName(uint32_t serviceId, uint32_t methodId)
+{
+    for (Symbol *interfaceSymbol : m_interfaces)
+    {
+        Interface *interface = dynamic_cast<Interface *>(interfaceSymbol);
+        assert(interface);
+        if (interface->getUniqueId() == serviceId)
+        {
+            for (Function *function : interface->getFunctions())
+            {
+                if (function->getUniqueId() == methodId)
+                {
+                    return interface->getName() + "::" + function->getName();
+                }
+            }
+            return format_string("%s::%u", interface->getName().c_str(), methodId);
+        }
+    }
+
+    return format_string("%u::%u", serviceId, methodId);
+}
+
+void TraceExporter::writeSpan(ofstream &out, const string &name, const char *category, uint32_t process,
+                              uint32_t thread, int64_t start, int64_t end, const string &args)
+{
+    out << ",\n{\"name\":\"" << escapeJson(name) << "\",\"cat\":\"" << category << "\",\"ph\":\"X\",\"pid\":"
+        << (process + 1U) << ",\"tid\":" << thread << ",\"ts\":" << start << ",\"dur\":" << (end - start);
+    if (!args.empty())
+    {
+        out << ",\"args\":" << args;
+    }
+    out << "}";
+}
+
+void TraceExporter::writeFlow(ofstream &out, const string &name, uint32_t fromProcess, uint32_t fromThread,
+                              int64_t fromTime, uint32_t toProcess, uint32_t toThread, int64_t toTime)
+{
+    ++m_flowId;
+    out << ",\n{\"name\":\"" << escapeJson(name) << "\",\"cat\":\"rpc\",\"ph\":\"s\",\"id\":" << m_flowId
+        << ",\"pid\":" << (fromProcess + 1U) << ",\"tid\":" << fromThread << ",\"ts\":" << fromTime << "}";
+    out << ",\n{\"name\":\"" << escapeJson(name) << "\",\"cat\":\"rpc\",\"ph\":\"f\",\"bp\":\"e\",\"id\":" << m_flowId
+        << ",\"pid\":" << (toProcess + 1U) << ",\"tid\":" << toThread << ",\"ts\":" << toTime << "}";
+}
+
+void TraceExporter::write(const string &outputFilePath)
+{
+    ofstream out(outputFilePath);
+    int64_t origin = 0;
+    uint32_t process;
+
+    if (!out.is_open())
+    {
+        throw runtime_error(format_string("could not open output file '%s'", outputFilePath.c_str()));
+    }
+
+    collectCalls();
+
+    // Chrome trace viewer expects non negative times.
+    for (const Record &item : m_records)
+    {
+        origin = min(origin, item.time);
+    }
+    for (ClientCall &call : m_clientCalls)
+    {
+        call.createTime -= origin;
+        shiftTime(call.encodeTime, origin);
+        shiftTime(call.sendTime, origin);
+        shiftTime(call.replyTime, origin);
+    }
+    for (ServerCall &call : m_serverCalls)
+    {
+        call.receiveTime -= origin;
+        shiftTime(call.dispatchTime, origin);
+        shiftTime(call.handlerStart, origin);
+        shiftTime(call.handlerEnd, origin);
+        shiftTime(call.replyTime, origin);
+    }
+
+    // Process names come first, so each following event starts with a separator.
+    out << "{\"traceEvents\":[\n";
+    for (process = 0; process < m_processNames.size(); ++process)
+    {
+        out << ((process == 0U) ? "" : ",\n") << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << (process + 1U)
+            << ",\"args\":{\"name\":\"" << escapeJson(m_processNames[process]) << "\"}}";
+    }
+
+    for (const ServerCall &call : m_serverCalls)
+    {
+        string name = getName(call.serviceId, call.methodId);
+        int64_t end = max(max(call.receiveTime, call.dispatchTime), max(call.handlerEnd, call.replyTime));
+        string args = format_string("{\"sequence\":%u,\"request_bytes\":%u,\"reply_bytes\":%u}", call.sequence,
+                                    call.requestBytes, call.replyBytes);
+
+        writeSpan(out, name, "server", call.process, call.serveThread, call.receiveTime, end, args);
+        if (call.dispatchTime != kNotSeen)
+        {
+            // Time spent in receive queue of the server.
+            writeSpan(out, "queue", "server", call.process, call.serveThread, call.receiveTime, call.dispatchTime,
+                      "");
+        }
+        if ((call.handlerStart != kNotSeen) && (call.handlerEnd != kNotSeen))
+        {
+            writeSpan(out, "handler", "server", call.process, call.serveThread, call.handlerStart, call.handlerEnd,
+                      "");
+        }
+    }
+
+    for (const ClientCall &call : m_clientCalls)
+    {
+        string name = getName(call.serviceId, call.methodId);
+        int64_t end = max(max(call.createTime, call.encodeTime), max(call.sendTime, call.replyTime));
+        string args = format_string("{\"sequence\":%u,\"request_bytes\":%u,\"reply_bytes\":%u}", call.sequence,
+                                    call.requestBytes, call.replyBytes);
+        ServerCall *serverCall;
+
+        writeSpan(out, name, "client", call.process, call.thread, call.createTime, end, args);
+        if (call.encodeTime != kNotSeen)
+        {
+            writeSpan(out, "encode", "client", call.process, call.thread, call.createTime, call.encodeTime, "");
+        }
+        if ((call.sendTime != kNotSeen) && (call.replyTime != kNotSeen))
+        {
+            writeSpan(out, "wait", "client", call.process, call.thread, call.sendTime, call.replyTime, "");
+        }
+
+        if (call.sendTime != kNotSeen)
+        {
+            serverCall = findServerCall(call);
+            if (serverCall != nullptr)
+            {
+                serverCall->matched = true;
+                writeFlow(out, name, call.process, call.thread, call.sendTime, serverCall->process,
+                          serverCall->serveThread, serverCall->receiveTime);
+                if ((serverCall->replyTime != kNotSeen) && (call.replyTime != kNotSeen))
+                {
+                    writeFlow(out, name, serverCall->process, serverCall->serveThread, serverCall->replyTime,
+                              call.process, call.thread, call.replyTime);
+                }
+            }
+        }
+    }
+
+    out << "\n]}\n";
+
+    if (!out.good())
+    {
+        throw runtime_error(format_string("could not write output file '%s'", outputFilePath.c_str()));
+    }
+    Log::info("exported %zu client and %zu server calls\n", m_clientCalls.size(), m_serverCalls.size());
+}
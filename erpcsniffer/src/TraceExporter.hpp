@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__TRACE_EXPORTER_H_
+#define _EMBEDDED_RPC__TRACE_EXPORTER_H_
+
+#include "erpc_c/infra/erpc_trace.h"
+
+#include "InterfaceDefinition.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+namespace erpcsniffer {
+/*!
+ * @brief Converts eRPC trace records to Chrome JSON trace.
+ *
+ * Input files hold #erpc_trace_record_t records as passed to the trace sink, one file per process. Records of client
+ * and server are matched by service, method and sequence, so each call shows up as a span on the client thread,
+ * a span on the serving thread and flow arrows from the request to the handler and back. Spans are named by
+ * interface and function names from the IDL.
+ *
+ * Timestamps of all files must come from the same monotonic clock, which holds for processes on one host. Raw
+ * timestamps wrap around after about 71 minutes, they are unwrapped per thread of each file, so traces can be longer
+ * as long as each thread records at least once per wrap. The output can be opened in chrome://tracing or
+ * ui.perfetto.dev.
+ */
+class TraceExporter
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * @param[in] def Contains information parsed from IDL.
+     */
+    explicit TraceExporter(erpcgen::InterfaceDefinition *def);
+
+    /*!
+     * @brief Read records of one process.
+     *
+     * @param[in] filePath Path to file with records.
+     *
+     * @exception runtime_error Thrown when file cannot be read.
+     */
+    void addFile(const std::string &filePath);
+
+    /*!
+     * @brief Match read records and write Chrome JSON trace.
+     *
+     * @param[in] outputFilePath Path to output file.
+     *
+     * @exception runtime_error Thrown when file cannot be written.
+     */
+    void write(const std::string &outputFilePath);
+
+    static const int64_t kNotSeen = INT64_MIN; /*!< Time of event which was not recorded. */
+
+protected:
+    //! @brief Record with time extended to 64 bits and its origin.
+    struct Record
+    {
+        int64_t time;               /*!< Time in microseconds relative to first record. */
+        uint32_t process;           /*!< Index of file the record comes from. */
+        erpc_trace_record_t record; /*!< Record as written by eRPC. */
+    };
+
+    //! @brief Records of one call on client side.
+    struct ClientCall
+    {
+        uint32_t process;      /*!< Index of file. */
+        uint32_t thread;       /*!< Thread which made the call. */
+        uint32_t sequence;     /*!< Sequence number. */
+        uint32_t serviceId;    /*!< Service id. */
+        uint32_t methodId;     /*!< Method id. */
+        int64_t createTime;    /*!< Request created. */
+        int64_t encodeTime;    /*!< Request encoded, kNotSeen when not seen. */
+        int64_t sendTime;      /*!< Request passed to transport, kNotSeen when not seen. */
+        int64_t replyTime;     /*!< Reply received, kNotSeen when not seen. */
+        uint32_t requestBytes; /*!< Size of request. */
+        uint32_t replyBytes;   /*!< Size of reply. */
+    };
+
+    //! @brief Records of one call on server side.
+    struct ServerCall
+    {
+        uint32_t process;       /*!< Index of file. */
+        uint32_t thread;        /*!< Thread which received the request. */
+        uint32_t serveThread;   /*!< Thread which processed the request. */
+        uint32_t sequence;      /*!< Sequence number. */
+        uint32_t serviceId;     /*!< Service id. */
+        uint32_t methodId;      /*!< Method id. */
+        int64_t receiveTime;    /*!< Request received. */
+        int64_t dispatchTime;   /*!< Service found, kNotSeen when not seen. */
+        int64_t handlerStart;   /*!< User implementation called, kNotSeen when not seen. */
+        int64_t handlerEnd;     /*!< User implementation returned, kNotSeen when not seen. */
+        int64_t replyTime;      /*!< Reply passed to transport, kNotSeen when not seen. */
+        uint32_t requestBytes;  /*!< Size of request. */
+        uint32_t replyBytes;    /*!< Size of reply. */
+        bool matched;           /*!< Client call of this request was found. */
+    };
+
+    //! @brief Key of open client call: process, thread, sequence.
+    typedef std::tuple<uint32_t, uint32_t, uint32_t> client_key_t;
+
+    //! @brief Key of open server call: process, service, method, sequence.
+    typedef std::tuple<uint32_t, uint32_t, uint32_t, uint32_t> server_key_t;
+
+    //! @brief Key of request on any server: service, method, sequence.
+    typedef std::tuple<uint32_t, uint32_t, uint32_t> request_key_t;
+
+    erpcgen::SymbolScope::symbol_vector_t m_interfaces; /*!< Vector of interfaces parsed from IDL. */
+    std::vector<std::string> m_processNames;            /*!< Name of each process, from its file name. */
+    std::vector<Record> m_records;                      /*!< Records of all files. */
+    bool m_hasReference;                                /*!< Reference time was taken. */
+    uint32_t m_reference;                               /*!< Raw time of first record of first file. */
+    std::vector<ClientCall> m_clientCalls;              /*!< Client calls collected from records. */
+    std::vector<ServerCall> m_serverCalls;              /*!< Server calls collected from records. */
+    std::map<request_key_t, std::vector<size_t> > m_serverCallsByRequest; /*!< Indexes of server calls by request. */
+    uint32_t m_flowId;                                  /*!< Last used id of flow events. */
+
+    /*!
+     * @brief Collect client and server calls from sorted records.
+     */
+    void collectCalls(void);
+
+    /*!
+     * @brief Return server call which served given client call.
+     *
+     * @param[in] call Client call.
+     *
+     * @return Server call, nullptr when not found.
+     */
+    ServerCall *findServerCall(const ClientCall &call);
+
+    /*!
+     * @brief Return span name of function.
+     *
+     * @param[in] serviceId Service id.
+     * @param[in] methodId Method id.
+     *
+     * @return Interface and function name from IDL, ids when not found.
+     */
+    std::string getName(uint32_t serviceId, uint32_t methodId);
+
+    /*!
+     * @brief Write complete event.
+     *
+     * @param[in] out Output stream.
+     * @param[in] name Name of span.
+     * @param[in] category Category of span.
+     * @param[in] process Index of file.
+     * @param[in] thread Index of thread.
+     * @param[in] start Start time.
+     * @param[in] end End time.
+     * @param[in] args JSON object with arguments, can be empty.
+     */
+    void writeSpan(std::ofstream &out, const std::string &name, const char *category, uint32_t process,
+                   uint32_t thread, int64_t start, int64_t end, const std::string &args);
+
+    /*!
+     * @brief Write flow arrow between two spans.
+     *
+     * @param[in] out Output stream.
+     * @param[in] name Name of flow.
+     * @param[in] fromProcess Index of file where the flow starts.
+     * @param[in] fromThread Thread where the flow starts.
+     * @param[in] fromTime Time when the flow starts.
+     * @param[in] toProcess Index of file where the flow ends.
+     * @param[in] toThread Thread where the flow ends.
+     * @param[in] toTime Time when the flow ends.
+     */
+    void writeFlow(std::ofstream &out, const std::string &name, uint32_t fromProcess, uint32_t fromThread,
+                   int64_t fromTime, uint32_t toProcess, uint32_t toThread, int64_t toTime);
+};
+} // namespace erpcsniffer
+
+#endif // _EMBEDDED_RPC__TRACE_EXPORTER_H_
@@ -17,6 +17,7 @@
 #include "Logging.hpp"
 #include "SearchPath.hpp"
 #include "Sniffer.hpp"
+#include "TraceExporter.hpp"
 #include "UniqueIdChecker.hpp"
 #include "annotations.h"
 #include "options.hpp"
@@ -59,6 +60,7 @@ static const char *k_optionsDefinition[] = { "?|help",
                                              "b:baudrate <baudrate>",
                                              "p:port <port>",
                                              "h:host <host>",
+                                             "T|trace",
                                              NULL };
 
 /*! Help string. */
@@ -74,10 +76,15 @@ const char k_usageText[] =
   -b/--baudrate <baudrate>     Baud rate.\n\
   -p/--port <port>             Port name or port number.\n\
   -h/--host <host>             Host definition.\n\
+  -T/--trace                   Convert trace record files given after the IDL\n\
+                               file to Chrome JSON trace instead of sniffing.\n\
 \n\
 Available transports (use with -t option):\n\
   tcp      Tcp transport type (host, port number).\n\
   serial   Serial transport type (port name, baud rate).\n\
+\n\
+Trace files hold erpc_trace_record_t records as passed to the eRPC trace sink,\n\
+one file per process. Output defaults to trace.json.\n\
 \n";
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -123,6 +130,7 @@ protected:
     uint32_t m_baudrate;      /*!< Baudrate rate speed. */
     const char *m_port;       /*!< Name or number of port. Based on used transport. */
     const char *m_host;       /*!< Host name */
+    bool m_trace;             /*!< Convert trace files instead of sniffing. */
 
 public:
     /*!
@@ -136,7 +144,7 @@ public:
     erpcsnifferTool(int argc, char *argv[]) :
     m_argc(argc), m_argv(argv), m_logger(0), m_verboseType(verbose_type_t::kWarning), m_outputFilePath(NULL),
     m_ErpcFile(NULL), m_transport(transports_t::kNoneTransport), m_quantity(10), m_baudrate(115200), m_port(NULL),
-    m_host(NULL)
+    m_host(NULL), m_trace(false)
     {
         // create logger instance
         m_logger = new StdoutLogger();
@@ -253,6 +261,12 @@ public:
                     break;
                 }
 
+                case 'T':
+                {
+                    m_trace = true;
+                    break;
+                }
+
                 default:
                 {
                     Log::error("error: unrecognized option\n\n");
@@ -324,18 +338,25 @@ public:
             }
 
             m_ErpcFile = m_positionalArgs[0].c_str();
-            if (!m_outputFilePath)
-            {
-                m_outputFilePath = "";
-            }
 
             // Parse and build definition model.
             InterfaceDefinition def;
+            def.parse(m_ErpcFile);
 
             // Check for duplicate function IDs
             UniqueIdChecker uniqueIdCheck;
             uniqueIdCheck.makeIdsUnique(def);
 
+            if (m_trace)
+            {
+                return exportTrace(&def);
+            }
+
+            if (!m_outputFilePath)
+            {
+                m_outputFilePath = "";
+            }
+
             Transport *_transport;
             switch (m_transport)
             {
@@ -392,6 +413,34 @@ public:
         return 0;
     }
 
+    /*!
+     * @brief Convert trace record files to Chrome JSON trace.
+     *
+     * @param[in] def Contains information parsed from IDL.
+     *
+     * @retval 0 Trace was exported.
+     *
+     * @exception runtime_error Thrown when no trace file is given or files cannot be read or written.
+     */
+    int exportTrace(InterfaceDefinition *def)
+    {
+        TraceExporter exporter(def);
+        size_t i;
+
+        if (m_positionalArgs.size() < 2U)
+        {
+            throw runtime_error("no trace file provided");
+        }
+
+        for (i = 1; i < m_positionalArgs.size(); ++i)
+        {
+            exporter.addFile(m_positionalArgs[i]);
+        }
+        exporter.write((m_outputFilePath != NULL) ? m_outputFilePath : "trace.json");
+
+        return 0;
+    }
+
     /*!
      * @brief Validate arguments that can be checked.
      *
@@ -0,0 +1,143 @@
+#! /usr/bin/python
+
+# Copyright (C) 2024 Xiaomi Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Test of erpcsniffer -T on records of one client process and one server process.
+# $ pytest erpcsniffer/test
+# The erpcsniffer executable is taken from the ERPCSNIFFER environment variable or from the Release build directory.
+import json
+import os
+import struct
+import subprocess
+import sys
+
+import pytest
+
+this_dir = os.path.dirname(os.path.abspath(__file__))
+if 'ERPCSNIFFER' in os.environ:
+    ERPCSNIFFER = os.environ['ERPCSNIFFER']
+else:
+    ERPCSNIFFER = os.path.join(this_dir, "..", "..", "Release", "Linux", "erpcsniffer", "erpcsniffer")
+
+IDL = """
+program trace_test
+
+@id(1)
+interface Calc {
+    @id(1)
+    add(int32 a) -> int32
+}
+"""
+
+# Events of erpc_trace_event_t.
+REQUEST_CREATE = 0
+ENCODE_DONE = 1
+SEND = 2
+RECEIVE = 3
+DISPATCH = 4
+HANDLER_START = 5
+HANDLER_END = 6
+REPLY = 7
+REPLY_RECEIVED = 8
+
+# Raw timestamps start just before the 32-bit clock wraps. The third call comes 50 minutes after the first one,
+# further than a signed 32-bit difference from the first record reaches.
+T0 = 0xFFFFFF00
+LATE = 3000000000
+
+
+def client_call(thread, sequence, start, send, reply):
+    return [(start, REQUEST_CREATE, thread, sequence, 0, 0, 0),
+            (start + 5, ENCODE_DONE, thread, sequence, 1, 1, 0),
+            (send, SEND, thread, sequence, 1, 1, 16),
+            (reply, REPLY_RECEIVED, thread, sequence, 1, 1, 12)]
+
+
+def server_call(thread, sequence, receive, handler, reply):
+    return [(receive, RECEIVE, thread, sequence, 1, 1, 16),
+            (receive + 2, DISPATCH, thread, sequence, 1, 1, 0),
+            (receive + 4, HANDLER_START, thread, sequence, 1, 1, 0),
+            (handler, HANDLER_END, thread, sequence, 1, 1, 0),
+            (reply, REPLY, thread, sequence, 1, 1, 12)]
+
+
+# Files as written by trace sink: records of one thread in order, threads drained one after another. Thread 2 of
+# the client is drained after thread 1 although its call came first.
+CLIENT_RECORDS = (client_call(1, 1, T0 + 100, T0 + 120, T0 + 600) +
+                  client_call(2, 2, T0, T0 + 10, T0 + 90) +
+                  client_call(1, 3, T0 + LATE, T0 + LATE + 10, T0 + LATE + 100))
+SERVER_RECORDS = (server_call(1, 2, T0 + 20, T0 + 70, T0 + 80) +
+                  server_call(1, 1, T0 + 130, T0 + 560, T0 + 580) +
+                  server_call(1, 3, T0 + LATE + 20, T0 + LATE + 60, T0 + LATE + 80))
+
+
+def write_records(filePath, records):
+    with open(filePath, "wb") as f:
+        for timestamp, event, thread, sequence, serviceId, methodId, length in records:
+            # Layout of erpc_trace_record_t.
+            f.write(struct.pack("<IIHBBBBH", timestamp & 0xFFFFFFFF, sequence, length, event, serviceId, methodId,
+                                thread, 0))
+
+
+@pytest.fixture
+def trace(tmp_path):
+    if not os.path.isfile(ERPCSNIFFER):
+        pytest.skip("erpcsniffer executable not found: " + ERPCSNIFFER)
+
+    idlPath = tmp_path / "test.erpc"
+    idlPath.write_text(IDL)
+    write_records(tmp_path / "client.trace", CLIENT_RECORDS)
+    write_records(tmp_path / "server.trace", SERVER_RECORDS)
+    outputPath = tmp_path / "trace.json"
+
+    subprocess.check_call([ERPCSNIFFER, "-T", "-o", str(outputPath), str(idlPath),
+                           str(tmp_path / "client.trace"), str(tmp_path / "server.trace")])
+    with open(outputPath) as f:
+        return json.load(f)["traceEvents"]
+
+
+def spans(events, category, name):
+    return {e["args"]["sequence"]: e for e in events if e["ph"] == "X" and e["cat"] == category and
+            e["name"] == name}
+
+
+def test_process_names(trace):
+    names = {e["pid"]: e["args"]["name"] for e in trace if e["ph"] == "M"}
+    assert names == {1: "client.trace", 2: "server.trace"}
+
+
+def test_client_spans_are_unwrapped(trace):
+    calls = spans(trace, "client", "Calc::add")
+    # Times are relative to the earliest record, which is the call of client thread 2.
+    assert {s: (calls[s]["tid"], calls[s]["ts"], calls[s]["dur"]) for s in calls} == {
+        1: (1, 100, 500),
+        2: (2, 0, 90),
+        3: (1, LATE, 100)}
+
+
+def test_server_spans_are_unwrapped(trace):
+    calls = spans(trace, "server", "Calc::add")
+    assert {s: (calls[s]["pid"], calls[s]["ts"], calls[s]["dur"]) for s in calls} == {
+        1: (2, 130, 450),
+        2: (2, 20, 60),
+        3: (2, LATE + 20, 60)}
+
+
+def test_flows_link_client_and_server(trace):
+    starts = {e["id"]: e for e in trace if e["ph"] == "s"}
+    ends = {e["id"]: e for e in trace if e["ph"] == "f"}
+    flows = sorted((starts[i]["pid"], starts[i]["ts"], ends[i]["pid"], ends[i]["ts"]) for i in starts)
+    assert flows == [(1, 10, 2, 20), (1, 120, 2, 130), (1, LATE + 10, 2, LATE + 20),
+                     (2, 80, 1, 90), (2, 580, 1, 600), (2, LATE + 80, 1, LATE + 100)]
@@ -17,6 +17,8 @@
 #include "myAlloc.hpp"
 #include "unit_test_wrapped.h"
 
+#include <stdlib.h>
+
 using namespace erpc;
 
 class MyMessageBufferFactory : public MessageBufferFactory
@@ -38,7 +40,14 @@ public:
     }
 };
 
-SerialTransport g_transport("/dev/ttyS4", 115200);
+// Port can be overridden, e.g. by a pty made by test/serial_pty_bridge.py.
+static const char *getSerialPort(void)
+{
+    const char *port = getenv("ERPC_SERIAL_PORT");
+    return (port != NULL) ? port : "/dev/ttyS4";
+}
+
+SerialTransport g_transport(getSerialPort(), 115200);
 MyMessageBufferFactory g_msgFactory;
 BasicCodecFactory g_basicCodecFactory;
 ClientManager *g_client;
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_client_manager.h"
+#include "erpc_unix_transport.hpp"
+
+#include "Logging.hpp"
+#include "c_test_unit_test_common_client.h"
+#include "gtest.h"
+#include "gtestListener.hpp"
+#include "myAlloc.hpp"
+#include "unit_test_wrapped.h"
+
+using namespace erpc;
+
+class MyMessageBufferFactory : public MessageBufferFactory
+{
+public:
+    virtual MessageBuffer create()
+    {
+        uint8_t *buf = new uint8_t[1024];
+        return MessageBuffer(buf, 1024);
+    }
+
+    virtual void dispose(MessageBuffer *buf)
+    {
+        erpc_assert(buf);
+        if (*buf)
+        {
+            delete[] buf->get();
+        }
+    }
+};
+
+MyMessageBufferFactory g_msgFactory;
+UnixSocketTransport g_transport("/tmp/erpc_unit_test.sock", false);
+#if USE_MESSAGE_LOGGING
+UnixSocketTransport g_messageLogger("/tmp/erpc_unit_test_logger.sock", false);
+#endif // USE_MESSAGE_LOGGING
+BasicCodecFactory g_basicCodecFactory;
+ClientManager *g_client;
+
+int ::MyAlloc::allocated_ = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+// Set up global fixture
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    ::testing::TestEventListeners &listeners = ::testing::UnitTest::GetInstance()->listeners();
+    listeners.Append(new LeakChecker);
+
+    // create logger instance
+    StdoutLogger *m_logger = new StdoutLogger();
+    m_logger->setFilterLevel(Logger::log_level_t::kInfo);
+    Log::setLogger(m_logger);
+    Log::info("Starting ERPC client...\n");
+
+    g_client = new ClientManager();
+    erpc_status_t err = g_transport.open();
+    if (err)
+    {
+        Log::error("Failed to open connection\n");
+        return err;
+    }
+
+#if USE_MESSAGE_LOGGING
+    err = g_messageLogger.open();
+    if (err)
+    {
+        Log::error("Failed to open connection in ERPC first (client) app\n");
+        return err;
+    }
+#endif // USE_MESSAGE_LOGGING
+
+    g_client->setMessageBufferFactory(&g_msgFactory);
+    g_client->setTransport(&g_transport);
+    g_client->setCodecFactory(&g_basicCodecFactory);
+#if USE_MESSAGE_LOGGING
+    g_client->addMessageLogger(&g_messageLogger);
+#endif // USE_MESSAGE_LOGGING
+    erpc_client_t client = reinterpret_cast<erpc_client_t>(g_client);
+    initInterfaces_common(client);
+    initInterfaces(client);
+
+    int ret = RUN_ALL_TESTS();
+    quit();
+    free(m_logger);
+    g_transport.close();
+    free(g_client);
+
+    return ret;
+}
+
+void initInterfaces_common(erpc_client_t client)
+{
+    initCommon_client(client);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// EOF
+////////////////////////////////////////////////////////////////////////////////
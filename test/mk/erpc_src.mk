@@ -37,18 +37,25 @@ SOURCES +=  $(UT_COMMON_SRC)/addOne.cpp \
             $(ERPC_C_ROOT)/infra/erpc_arbitrated_client_manager.cpp \
             $(ERPC_C_ROOT)/infra/erpc_basic_codec.cpp \
             $(ERPC_C_ROOT)/infra/erpc_client_manager.cpp \
+            $(ERPC_C_ROOT)/infra/erpc_client_metrics.cpp \
             $(ERPC_C_ROOT)/infra/erpc_crc16.cpp \
             $(ERPC_C_ROOT)/infra/erpc_server.cpp \
+            $(ERPC_C_ROOT)/infra/erpc_server_metrics.cpp \
+            $(ERPC_C_ROOT)/infra/erpc_stats_service.cpp \
             $(ERPC_C_ROOT)/infra/erpc_simple_server.cpp \
+            $(ERPC_C_ROOT)/infra/erpc_trace.cpp \
             $(ERPC_C_ROOT)/infra/erpc_framed_transport.cpp \
+            $(ERPC_C_ROOT)/infra/erpc_memory_accounting.cpp \
             $(ERPC_C_ROOT)/infra/erpc_message_buffer.cpp \
             $(ERPC_C_ROOT)/infra/erpc_message_loggers.cpp \
             $(ERPC_C_ROOT)/infra/erpc_transport_arbitrator.cpp \
             $(ERPC_C_ROOT)/infra/erpc_utils.cpp \
             $(ERPC_C_ROOT)/port/erpc_port_stdlib.cpp \
             $(ERPC_C_ROOT)/port/erpc_threading_pthreads.cpp \
+            $(ERPC_C_ROOT)/transports/erpc_sock_transport.cpp \
             $(ERPC_C_ROOT)/transports/erpc_tcp_transport.cpp
 ifeq "$(is_mingw)" ""
     SOURCES += $(ERPC_C_ROOT)/transports/erpc_serial_transport.cpp \
+               $(ERPC_C_ROOT)/transports/erpc_unix_transport.cpp \
                $(ERPC_C_ROOT)/port/erpc_serial.cpp
 endif
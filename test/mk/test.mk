@@ -37,6 +37,8 @@ ifeq "$(TRANSPORT)" "tcp"
     CXXFLAGS += -DTRANSPORT_TCP
 else ifeq "$(TRANSPORT)" "serial"
     CXXFLAGS += -DSERIAL
+else ifeq "$(TRANSPORT)" "unix"
+    CXXFLAGS += -DTRANSPORT_UNIX
 endif
 
 APP_NAME ?= $(TEST_NAME)_$(APP_TYPE)_$(TRANSPORT)_test
@@ -29,6 +29,10 @@ ERPCGEN_PATH = $(ERPC_ROOT)/$(BUILD_TYPE)/$(os_name)/erpcgen/erpcgen
 UT_OUTPUT_DIR = $(OUTPUT_ROOT)/test/$(TEST_NAME)
 TCP_CLIENT_PATH = $(UT_OUTPUT_DIR)/$(os_name)/tcp/$(CC)/$(CLIENT_NAME)/$(DEBUG_OR_RELEASE)/$(CLIENT_NAME)_tcp_test
 TCP_SERVER_PATH = $(UT_OUTPUT_DIR)/$(os_name)/tcp/$(CC)/$(SERVER_NAME)/$(DEBUG_OR_RELEASE)/$(SERVER_NAME)_tcp_test
+UNIX_CLIENT_PATH = $(UT_OUTPUT_DIR)/$(os_name)/unix/$(CC)/$(CLIENT_NAME)/$(DEBUG_OR_RELEASE)/$(CLIENT_NAME)_unix_test
+UNIX_SERVER_PATH = $(UT_OUTPUT_DIR)/$(os_name)/unix/$(CC)/$(SERVER_NAME)/$(DEBUG_OR_RELEASE)/$(SERVER_NAME)_unix_test
+SERIAL_CLIENT_PATH = $(UT_OUTPUT_DIR)/$(os_name)/serial/$(CC)/$(CLIENT_NAME)/$(DEBUG_OR_RELEASE)/$(CLIENT_NAME)_serial_test
+SERIAL_SERVER_PATH = $(UT_OUTPUT_DIR)/$(os_name)/serial/$(CC)/$(SERVER_NAME)/$(DEBUG_OR_RELEASE)/$(SERVER_NAME)_serial_test
 
 test_server_serial = test_server_serial
 test_client_serial = test_client_serial
@@ -54,6 +58,9 @@ test-tcp: test_lib test_client_tcp test_server_tcp
 .PHONY: test-serial
 test-serial: test_lib test_client_serial test_server_serial
 
+.PHONY: test-unix
+test-unix: test_lib test_client_unix test_server_unix
+
 .PHONY: fresh
 fresh: clean all
 
@@ -74,6 +81,15 @@ else
 	@$(call printmessage,green,Skipping, $(CUR_DIR) $@ ,gray,,,\n)
 endif
 
+.PHONY: test_client_unix
+test_client_unix: erpcgen
+ifneq "$(TEST_NAME)" "test_arbitrator"
+	@$(call printmessage,build,Building, $(CUR_DIR) $@ ,gray,,,\n)
+	@$(MAKE) $(silent_make) -j$(MAKETHREADS) -r -f $(TEST_DIR)/mk/test.mk TEST_NAME=$(CUR_DIR) TYPE=CLIENT TRANSPORT=unix
+else
+	@$(call printmessage,green,Skipping, $(CUR_DIR) $@ ,gray,,,\n)
+endif
+
 .PHONY: test_server
 test_server: test_server_tcp $(test_server_serial)
 
@@ -91,6 +107,15 @@ else
 	@$(call printmessage,green,Skipping, $(CUR_DIR) $@ ,gray,,,\n)
 endif
 
+.PHONY: test_server_unix
+test_server_unix: erpcgen
+ifneq "$(TEST_NAME)" "test_arbitrator"
+	@$(call printmessage,build,Building, $(CUR_DIR) $@ ,gray,,,\n)
+	@$(MAKE) $(silent_make) -j$(MAKETHREADS) -r -f $(TEST_DIR)/mk/test.mk TEST_NAME=$(CUR_DIR) TYPE=SERVER TRANSPORT=unix
+else
+	@$(call printmessage,green,Skipping, $(CUR_DIR) $@ ,gray,,,\n)
+endif
+
 .PHONY: erpcgen
 erpcgen:
 	@$(call printmessage,build,Building, $@ ,gray,,,\n)
@@ -105,6 +130,19 @@ run-tcp-server:
 run-tcp-client:
 	@$(TCP_CLIENT_PATH) "--gtest_output=xml:$(TEST_DIR)/results/"
 
+run-unix-server:
+	@$(UNIX_SERVER_PATH) &
+
+run-unix-client:
+	@$(UNIX_CLIENT_PATH) "--gtest_output=xml:$(TEST_DIR)/results/"
+
+# Serial ports are the links made by test/serial_pty_bridge.py.
+run-serial-server:
+	@ERPC_SERIAL_PORT=/tmp/erpc_serial_server $(SERIAL_SERVER_PATH) &
+
+run-serial-client:
+	@ERPC_SERIAL_PORT=/tmp/erpc_serial_client $(SERIAL_CLIENT_PATH) "--gtest_output=xml:$(TEST_DIR)/results/"
+
 run-erpcgen: erpcgen
 	@$(ERPCGEN_PATH) $(CUR_DIR).erpc
 
@@ -112,13 +150,17 @@ run-erpcgen-common: erpcgen
 	@$(ERPCGEN_PATH) $(ERPC_ROOT)/src/unit_test_common/unit_test_common.erpc
 
 #cleans only output directories related to this unit test
-.PHONY: clean clean_serial clean_tcp
-clean: $(clean_serial) clean_tcp
+.PHONY: clean clean_serial clean_tcp clean_unix
+clean: $(clean_serial) clean_tcp clean_unix
 
 clean_tcp:
 	@echo Cleaning $(TEST_NAME)_tcp...
 	@$(rmc) $(UT_OUTPUT_DIR)/$(os_name)/tcp
 
+clean_unix:
+	@echo Cleaning $(TEST_NAME)_unix...
+	@$(rmc) $(UT_OUTPUT_DIR)/$(os_name)/unix
+
 clean_serial:
 	@echo Cleaning $(TEST_NAME)_serial...
 	@$(rmc) $(UT_OUTPUT_DIR)/$(os_name)/serial
@@ -10,12 +10,13 @@
 # $make test
 # to build all of the test files.
 # then run
-# $./run_unit_tests.py [tcp]
+# $./run_unit_tests.py [tcp|unix|serial]
 # to run this script with optional transport layer argument
-from subprocess import call
+from subprocess import call, Popen
 import re
 import os
 import sys
+import time
 
 
 class bcolors:
@@ -46,7 +47,7 @@ make = "make"
 # Process command line options
 # Check for 2 or more arguments because argv[0] is the script name
 if len(sys.argv) > 2:
-    print("Too many arguments. Please specify only the transport layer to use. Options are: tcp")
+    print("Too many arguments. Please specify only the transport layer to use. Options are: tcp, unix, serial")
     sys.exit(1)
 if len(sys.argv) >= 2:
     for arg in sys.argv[1:]:
@@ -54,6 +55,14 @@ if len(sys.argv) >= 2:
             testClientCommand = "run-tcp-client"
             testServerCommand = "run-tcp-server"
             transportLayer = "tcp"
+        elif arg == "unix":
+            testClientCommand = "run-unix-client"
+            testServerCommand = "run-unix-server"
+            transportLayer = "unix"
+        elif arg == "serial":
+            testClientCommand = "run-serial-client"
+            testServerCommand = "run-serial-server"
+            transportLayer = "serial"
         elif arg == "-d":
             target = "debug"
         elif arg == "-r":
@@ -67,7 +76,7 @@ if len(sys.argv) >= 2:
         elif "-m" in arg:
             make = arg[2:]
         else:
-            print("Invalid argument/s. Options are: tcp, -r, -d\n")
+            print("Invalid argument/s. Options are: tcp, unix, serial, -r, -d\n")
             sys.exit(1)
 
 
@@ -95,6 +104,12 @@ if compilerC != "":
     clientCmd.append(compilerParamCpp)
     serverCmd.append(compilerParamCpp)
 
+# Serial tests run over a pty null modem, no hardware is needed.
+bridge = None
+if transportLayer == "serial":
+    bridge = Popen([sys.executable, "serial_pty_bridge.py"])
+    time.sleep(1)
+
 for dir in testDirs:
     print(bcolors.BLUE + "\nRunning " + bcolors.ORANGE + dir + bcolors.BLUE + " unit tests with "
           + bcolors.ORANGE + transportLayer + bcolors.BLUE + " transport layer." + bcolors.ENDC)
@@ -103,6 +118,10 @@ for dir in testDirs:
     testsExitStatus += call(clientCmd)
     os.chdir('..')
 
+if bridge is not None:
+    bridge.terminate()
+    bridge.wait()
+
 # For completeness, change back to erpc/ directory
 os.chdir('..')
 
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _ERPC_CONFIG_H_
+#define _ERPC_CONFIG_H_
+
+/*!
+ * @addtogroup config
+ * @{
+ * @file
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// Declarations
+////////////////////////////////////////////////////////////////////////////////
+
+//! @name Threading model options
+//@{
+#define ERPC_ALLOCATION_POLICY_DYNAMIC (0U) //!< Dynamic allocation policy
+#define ERPC_ALLOCATION_POLICY_STATIC (1U)  //!< Static allocation policy
+
+#define ERPC_THREADS_NONE (0U)     //!< No threads.
+#define ERPC_THREADS_PTHREADS (1U) //!< POSIX pthreads.
+#define ERPC_THREADS_FREERTOS (2U) //!< FreeRTOS.
+#define ERPC_THREADS_ZEPHYR (3U)   //!< ZEPHYR.
+#define ERPC_THREADS_MBED (4U)     //!< Mbed OS
+#define ERPC_THREADS_WIN32 (5U)    //!< WIN32
+#define ERPC_THREADS_THREADX (6U)  //!< THREADX
+
+#define ERPC_NOEXCEPT_DISABLED (0U) //!< Disabling noexcept feature.
+#define ERPC_NOEXCEPT_ENABLED (1U)  //!<  Enabling noexcept feature.
+
+#define ERPC_NESTED_CALLS_DISABLED (0U) //!< No nested calls support.
+#define ERPC_NESTED_CALLS_ENABLED (1U)  //!< Nested calls support.
+
+#define ERPC_NESTED_CALLS_DETECTION_DISABLED (0U) //!< Nested calls detection disabled.
+#define ERPC_NESTED_CALLS_DETECTION_ENABLED (1U)  //!< Nested calls detection enabled.
+
+#define ERPC_MESSAGE_LOGGING_DISABLED (0U) //!< Trace functions disabled.
+#define ERPC_MESSAGE_LOGGING_ENABLED (1U)  //!< Trace functions enabled.
+
+#define ERPC_TRANSPORT_MU_USE_MCMGR_DISABLED (0U) //!< Do not use MCMGR for MU ISR management.
+#define ERPC_TRANSPORT_MU_USE_MCMGR_ENABLED (1U)  //!< Use MCMGR for MU ISR management.
+
+#define ERPC_PRE_POST_ACTION_DISABLED (0U) //!< Pre post shim callbacks functions disabled.
+#define ERPC_PRE_POST_ACTION_ENABLED (1U)  //!< Pre post shim callback functions enabled.
+
+#define ERPC_PRE_POST_ACTION_DEFAULT_DISABLED (0U) //!< Pre post shim default callbacks functions disabled.
+#define ERPC_PRE_POST_ACTION_DEFAULT_ENABLED (1U)  //!< Pre post shim default callback functions enabled.
+
+#define ERPC_SERVICE_TABLE_DISABLED (0U) //!< Services are looked up by walking the service list.
+#define ERPC_SERVICE_TABLE_ENABLED (1U)  //!< Services are looked up in a direct-indexed table.
+//@}
+
+//! @name Configuration options
+//@{
+
+//! @def ERPC_ALLOCATION_POLICY
+//!
+//! Runtime tests are built twice, the static allocation policy is selected by the makefile.
+#if !defined(ERPC_ALLOCATION_POLICY)
+#define ERPC_ALLOCATION_POLICY (ERPC_ALLOCATION_POLICY_DYNAMIC)
+#endif
+
+//! @def ERPC_CODEC_COUNT
+//!
+//! Codecs of the servers and clients running in tests at the same time.
+#define ERPC_CODEC_COUNT (16U)
+
+//! @def ERPC_MESSAGE_LOGGERS_COUNT
+//!
+//! Message loggers of clients and servers running in tests at the same time.
+#define ERPC_MESSAGE_LOGGERS_COUNT (4U)
+
+//! @def ERPC_CLIENTS_THREADS_AMOUNT
+//!
+//! Client threads of arbitrated clients running in tests at the same time.
+#define ERPC_CLIENTS_THREADS_AMOUNT (4U)
+
+//! @def ERPC_TCP_TRANSPORTS_COUNT
+//!
+//! TCP transports existing in tests at the same time.
+#define ERPC_TCP_TRANSPORTS_COUNT (8U)
+
+//! @def ERPC_TRANSPORT_STATS
+//!
+//! Transport counters are checked by tests.
+#define ERPC_TRANSPORT_STATS (1U)
+
+//! @def ERPC_ONEWAY_CREDITS
+//!
+//! Small window, so tests can exhaust it.
+#define ERPC_ONEWAY_CREDITS (4U)
+
+//! @def ERPC_PRIORITY_QUEUE_SIZE
+//!
+//! Small queues, so tests can fill them.
+#define ERPC_PRIORITY_QUEUE_SIZE (4U)
+
+//! @def ERPC_PRIORITY_AGING_LIMIT
+//!
+//! Low limit, so tests can see aging.
+#define ERPC_PRIORITY_AGING_LIMIT (2U)
+
+//! @def ERPC_MESSAGE_LOGGING
+//!
+//! Message logging is tested.
+#define ERPC_MESSAGE_LOGGING (ERPC_MESSAGE_LOGGING_ENABLED)
+
+//! @def ERPC_MESSAGE_LOGGING_ASYNC
+//!
+//! Messages are logged by a logging thread.
+#define ERPC_MESSAGE_LOGGING_ASYNC (1U)
+
+//! @def ERPC_MESSAGE_LOGGING_QUEUE_SIZE
+//!
+//! Small queue, so slow loggers make it overflow.
+#define ERPC_MESSAGE_LOGGING_QUEUE_SIZE (4U)
+
+//! @def ERPC_CLIENT_METRICS
+//!
+//! Clients of tests time their calls, so attribution to phases and functions can be tested.
+#define ERPC_CLIENT_METRICS (1U)
+
+//! @def ERPC_SERVER_METRICS
+//!
+//! Servers of tests count calls, so the stats service can be tested.
+#define ERPC_SERVER_METRICS (1U)
+
+//! @def ERPC_MEMORY_ACCOUNTING
+//!
+//! Allocations of tests are counted.
+#define ERPC_MEMORY_ACCOUNTING (1U)
+
+//! @def ERPC_SOCK_IO_URING
+//!
+//! TCP servers of tests receive through io_uring.
+#define ERPC_SOCK_IO_URING (1U)
+
+//! @def ERPC_SOCK_IO_URING_BUFFERS
+//!
+//! Few buffers, so tests can exhaust them.
+#define ERPC_SOCK_IO_URING_BUFFERS (4U)
+
+//! @def ERPC_SOCK_IO_URING_BUFFER_SIZE
+//!
+//! Small buffers, so messages span several of them.
+#define ERPC_SOCK_IO_URING_BUFFER_SIZE (64U)
+
+//! @def ERPC_TRACE
+//!
+//! Calls of tests are traced, so rings of trace records can be tested.
+#define ERPC_TRACE (1U)
+//@}
+
+/*! @} */
+#endif // _ERPC_CONFIG_H_
+////////////////////////////////////////////////////////////////////////////////
+// EOF
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _RUNTIME_TEST__RPMSG_LINUX_ENDPOINT_H_
+#define _RUNTIME_TEST__RPMSG_LINUX_ENDPOINT_H_
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+/*!
+ * @brief Local stand-in for the RPMsg endpoint of rpmsg-cpp.
+ *
+ * Messages are queued by the test. Each queued message is signalled on an eventfd, as endpoint layers with
+ * notification descriptors do. Receiving is non-blocking like on the real endpoint.
+ */
+class RPMsgEndpoint
+{
+public:
+    static const int16_t kLocalDefaultAddress = 1;  /*!< Default local address. */
+    static const int16_t kRemoteDefaultAddress = 0; /*!< Default remote address. */
+    static const int8_t kDatagram = 0;              /*!< Datagram endpoint type. */
+    static const int8_t kStream = 1;                /*!< Stream endpoint type. */
+
+    RPMsgEndpoint(void) : m_eventFd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)), m_receiveCalls(0U) {}
+
+    ~RPMsgEndpoint(void) { (void)close(m_eventFd); }
+
+    int init(void) { return (m_eventFd < 0) ? -1 : 0; }
+
+    int send(uint8_t *buffer, uint32_t dst, uint32_t len)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        (void)dst;
+        m_sent.push_back(std::vector<uint8_t>(buffer, buffer + len));
+
+        return (int)len;
+    }
+
+    int receive(uint8_t *buffer, uint32_t maxlen)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        int ret = 0;
+
+        ++m_receiveCalls;
+        if (!m_received.empty())
+        {
+            if (m_received.front().size() > maxlen)
+            {
+                ret = -1;
+            }
+            else
+            {
+                (void)memcpy(buffer, m_received.front().data(), m_received.front().size());
+                ret = (int)m_received.front().size();
+            }
+            m_received.pop_front();
+        }
+
+        return ret;
+    }
+
+    /*!
+     * @brief Queue message for receiving and signal it.
+     *
+     * @param[in] message Message to queue.
+     */
+    void push(const std::vector<uint8_t> &message)
+    {
+        uint64_t one = 1U;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_received.push_back(message);
+        }
+        (void)write(m_eventFd, &one, sizeof(one));
+    }
+
+    int getEventFd(void) const { return m_eventFd; }
+
+    uint32_t getReceiveCalls(void)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_receiveCalls;
+    }
+
+protected:
+    int m_eventFd;                                 /*!< Signalled for each queued message. */
+    std::mutex m_mutex;                            /*!< Guards the queues. */
+    std::deque<std::vector<uint8_t> > m_received; /*!< Messages waiting for receive(). */
+    std::deque<std::vector<uint8_t> > m_sent;     /*!< Messages passed to send(). */
+    uint32_t m_receiveCalls;                       /*!< Count of receive() calls. */
+};
+
+#endif // _RUNTIME_TEST__RPMSG_LINUX_ENDPOINT_H_
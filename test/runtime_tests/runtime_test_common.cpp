@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime_test_common.hpp"
+
+#include "erpc_basic_codec.hpp"
+
+#include <cstring>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+MessageBuffer TestMessageBufferFactory::create(void)
+{
+    (void)__atomic_add_fetch(&m_outstanding, 1, __ATOMIC_ACQ_REL);
+
+    return MessageBuffer(new uint8_t[m_size], m_size);
+}
+
+void TestMessageBufferFactory::dispose(MessageBuffer *buf)
+{
+    if (buf->get() != NULL)
+    {
+        (void)__atomic_sub_fetch(&m_outstanding, 1, __ATOMIC_ACQ_REL);
+        delete[] buf->get();
+    }
+}
+
+erpc_status_t TestService::handleInvocation(uint32_t methodId, uint32_t sequence, Codec *codec,
+                                            MessageBufferFactory *messageFactory, Transport *transport)
+{
+    erpc_status_t err;
+    uint32_t value = 0;
+
+    codec->read(value);
+    err = codec->getStatus();
+    if (err == kErpcStatus_Success)
+    {
+        if (methodId == TEST_METHOD_ONEWAY)
+        {
+            onInvocation(methodId, value);
+            (void)__atomic_add_fetch(&m_onewayCount, 1U, __ATOMIC_ACQ_REL);
+        }
+        else if (methodId == TEST_METHOD_ADD_ONE)
+        {
+            onInvocation(methodId, value);
+            err = messageFactory->prepareServerBufferForSend(codec->getBufferRef(), transport->reserveHeaderSize());
+            if (err == kErpcStatus_Success)
+            {
+                codec->reset(transport->reserveHeaderSize());
+                codec->startWriteMessage(message_type_t::kReplyMessage, m_serviceId, methodId, sequence);
+                codec->write(value + 1U);
+                err = codec->getStatus();
+            }
+        }
+        else
+        {
+            err = kErpcStatus_InvalidArgument;
+        }
+    }
+
+    return err;
+}
+
+erpc_status_t testCallAddOne(ClientManager *client, uint32_t value, uint32_t *result, uint32_t serviceId)
+{
+    erpc_status_t err;
+    RequestContext request = client->createRequest(false);
+    Codec *codec = request.getCodec();
+
+    if (codec == NULL)
+    {
+        err = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        codec->startWriteMessage(message_type_t::kInvocationMessage, serviceId, TEST_METHOD_ADD_ONE,
+                                 request.getSequence());
+        codec->write(value);
+        client->performRequest(request);
+        codec->read(*result);
+        err = codec->getStatus();
+    }
+
+    client->releaseRequest(request);
+
+    return err;
+}
+
+erpc_status_t testSendOneway(ClientManager *client, uint32_t value)
+{
+    erpc_status_t err;
+    RequestContext request = client->createRequest(true);
+    Codec *codec = request.getCodec();
+
+    if (codec == NULL)
+    {
+        err = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        codec->startWriteMessage(message_type_t::kOnewayMessage, TEST_SERVICE_ID, TEST_METHOD_ONEWAY,
+                                 request.getSequence());
+        codec->write(value);
+        client->performRequest(request);
+        err = codec->getStatus();
+    }
+
+    client->releaseRequest(request);
+
+    return err;
+}
+
+erpc_status_t TestQueueTransport::receive(MessageBuffer *message)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    ++m_receiveCalls;
+    m_condition.notify_all();
+    m_condition.wait(lock, [this] { return m_closed || !m_received.empty(); });
+
+    if (m_received.empty())
+    {
+        err = kErpcStatus_ConnectionClosed;
+    }
+    else if (m_received.front().size() > message->getLength())
+    {
+        m_received.pop_front();
+        err = kErpcStatus_ReceiveFailed;
+    }
+    else
+    {
+        (void)memcpy(message->get(), m_received.front().data(), m_received.front().size());
+        message->setUsed(static_cast<uint16_t>(m_received.front().size()));
+        m_received.pop_front();
+    }
+
+    return err;
+}
+
+erpc_status_t TestQueueTransport::send(MessageBuffer *message)
+{
+    std::vector<uint8_t> data(message->get(), message->get() + message->getUsed());
+
+    if (m_peer != NULL)
+    {
+        m_peer->pushMessage(data);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_sent.push_back(data);
+        m_condition.notify_all();
+    }
+
+    return kErpcStatus_Success;
+}
+
+bool TestQueueTransport::hasMessage(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return !m_received.empty();
+}
+
+void TestQueueTransport::pushMessage(const std::vector<uint8_t> &message)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_received.push_back(message);
+    m_condition.notify_all();
+}
+
+bool TestQueueTransport::popSent(std::vector<uint8_t> *message)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool taken = !m_sent.empty();
+
+    if (taken)
+    {
+        *message = m_sent.front();
+        m_sent.pop_front();
+    }
+
+    return taken;
+}
+
+size_t TestQueueTransport::getSentCount(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_sent.size();
+}
+
+bool TestQueueTransport::waitForReceiver(uint32_t receiveCalls)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    return m_condition.wait_for(lock, std::chrono::seconds(5), [this, receiveCalls] {
+        return (m_receiveCalls == receiveCalls) && m_received.empty();
+    });
+}
+
+uint32_t TestQueueTransport::getReceiveCalls(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_receiveCalls;
+}
+
+void TestQueueTransport::close(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_closed = true;
+    m_condition.notify_all();
+}
+
+std::vector<uint8_t> testEncodeMessage(message_type_t type, uint32_t serviceId, uint32_t methodId, uint32_t sequence,
+                                       uint32_t value)
+{
+    uint8_t data[64];
+    MessageBuffer buffer(data, sizeof(data));
+    BasicCodec codec;
+
+    codec.setBuffer(buffer);
+    codec.startWriteMessage(type, serviceId, methodId, sequence);
+    codec.write(value);
+
+    return std::vector<uint8_t>(data, data + codec.getBufferRef().getUsed());
+}
+
+bool testDecodeMessage(const std::vector<uint8_t> &message, message_type_t *type, uint32_t *methodId,
+                       uint32_t *sequence, uint32_t *value)
+{
+    std::vector<uint8_t> data(message);
+    MessageBuffer buffer(data.data(), static_cast<uint16_t>(data.size()));
+    BasicCodec codec;
+    uint32_t serviceId;
+    bool decoded;
+
+    buffer.setUsed(static_cast<uint16_t>(data.size()));
+    codec.setBuffer(buffer);
+    codec.startReadMessage(*type, serviceId, *methodId, *sequence);
+    decoded = codec.isStatusOk();
+    if (decoded && (data.size() >= (sizeof(uint32_t) * 2U)))
+    {
+        codec.read(*value);
+    }
+
+    return decoded;
+}
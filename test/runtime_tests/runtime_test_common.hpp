@@ -0,0 +1,282 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _EMBEDDED_RPC__RUNTIME_TEST_COMMON_H_
+#define _EMBEDDED_RPC__RUNTIME_TEST_COMMON_H_
+
+#include "erpc_client_manager.h"
+#include "erpc_message_buffer.hpp"
+#include "erpc_server.hpp"
+#include "erpc_threading.h"
+#include "erpc_transport.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Service of the test services.
+#define TEST_SERVICE_ID (1U)
+
+//! @brief Method returning its argument plus one.
+#define TEST_METHOD_ADD_ONE (1U)
+
+//! @brief Oneway method counting its calls.
+#define TEST_METHOD_ONEWAY (2U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Message buffer factory allocating buffers from the heap.
+ */
+class TestMessageBufferFactory : public erpc::MessageBufferFactory
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * @param[in] size Size of created buffers.
+     */
+    explicit TestMessageBufferFactory(uint32_t size = 1024U) : m_size(size), m_outstanding(0) {}
+
+    virtual erpc::MessageBuffer create(void) override;
+
+    virtual void dispose(erpc::MessageBuffer *buf) override;
+
+    /*!
+     * @brief Return count of created buffers not disposed yet.
+     *
+     * @return Count of buffers.
+     */
+    int32_t getOutstanding(void) const { return __atomic_load_n(&m_outstanding, __ATOMIC_ACQUIRE); }
+
+protected:
+    uint32_t m_size;       /*!< Size of created buffers. */
+    int32_t m_outstanding; /*!< Count of created buffers not disposed yet. */
+};
+
+/*!
+ * @brief Service written the way erpcgen generates it.
+ *
+ * Method #TEST_METHOD_ADD_ONE replies with its uint32 argument plus one, oneway method #TEST_METHOD_ONEWAY only
+ * counts its calls.
+ */
+class TestService : public erpc::Service
+{
+public:
+    /*!
+     * @brief Constructor.
+     *
+     * @param[in] serviceId Service id.
+     */
+    explicit TestService(uint32_t serviceId = TEST_SERVICE_ID) : Service(serviceId), m_onewayCount(0) {}
+
+    virtual erpc_status_t handleInvocation(uint32_t methodId, uint32_t sequence, erpc::Codec *codec,
+                                           erpc::MessageBufferFactory *messageFactory,
+                                           erpc::Transport *transport) override;
+
+    /*!
+     * @brief Return count of received oneway calls.
+     *
+     * @return Count of oneway calls.
+     */
+    uint32_t getOnewayCount(void) const { return __atomic_load_n(&m_onewayCount, __ATOMIC_ACQUIRE); }
+
+protected:
+    /*!
+     * @brief Called with the argument of each invocation before the reply is written.
+     *
+     * @param[in] methodId Invoked method.
+     * @param[in] value Argument of the invocation.
+     */
+    virtual void onInvocation(uint32_t methodId, uint32_t value)
+    {
+        (void)methodId;
+        (void)value;
+    }
+
+    uint32_t m_onewayCount; /*!< Count of received oneway calls. */
+};
+
+/*!
+ * @brief Transport receiving messages queued by the test and keeping sent messages for the test.
+ *
+ * Receiving blocks until a message is queued or the transport is closed. Two transports connected by setPeer() form
+ * an in-memory link between a client and a server.
+ */
+class TestQueueTransport : public erpc::Transport
+{
+public:
+    TestQueueTransport(void) : m_peer(NULL), m_closed(false), m_receiveCalls(0U) {}
+
+    virtual erpc_status_t receive(erpc::MessageBuffer *message) override;
+
+    virtual erpc_status_t send(erpc::MessageBuffer *message) override;
+
+    virtual bool hasMessage(void) override;
+
+    /*!
+     * @brief Send messages to peer transport instead of keeping them.
+     *
+     * Must be called before anything is sent.
+     *
+     * @param[in] peer Transport receiving sent messages.
+     */
+    void setPeer(TestQueueTransport *peer) { m_peer = peer; }
+
+    /*!
+     * @brief Queue message for receiving.
+     *
+     * @param[in] message Message to queue.
+     */
+    void pushMessage(const std::vector<uint8_t> &message);
+
+    /*!
+     * @brief Take the oldest sent message.
+     *
+     * @param[out] message Sent message.
+     *
+     * @retval true Message was taken.
+     * @retval false No message was sent.
+     */
+    bool popSent(std::vector<uint8_t> *message);
+
+    /*!
+     * @brief Return count of sent messages not taken yet.
+     *
+     * @return Count of sent messages.
+     */
+    size_t getSentCount(void);
+
+    /*!
+     * @brief Wait until the receiver took all queued messages and waits for the next one.
+     *
+     * @param[in] receiveCalls Expected count of receive() calls, including the waiting one.
+     *
+     * @retval true Receiver waits in receive() call number receiveCalls.
+     * @retval false Timeout expired.
+     */
+    bool waitForReceiver(uint32_t receiveCalls);
+
+    /*!
+     * @brief Return count of receive() calls.
+     *
+     * @return Count of calls, including a call waiting for a message.
+     */
+    uint32_t getReceiveCalls(void);
+
+    /*!
+     * @brief Make receive() return #kErpcStatus_ConnectionClosed once queued messages are taken.
+     */
+    void close(void);
+
+protected:
+    TestQueueTransport *m_peer;                    /*!< Transport receiving sent messages, or NULL. */
+    std::mutex m_mutex;                            /*!< Guards the queues. */
+    std::condition_variable m_condition;           /*!< Signalled when a message is queued or transport is closed. */
+    std::deque<std::vector<uint8_t> > m_received; /*!< Messages waiting for receive(). */
+    std::deque<std::vector<uint8_t> > m_sent;     /*!< Messages passed to send(). */
+    bool m_closed;                                 /*!< Transport was closed. */
+    uint32_t m_receiveCalls;                       /*!< Count of receive() calls. */
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// API
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Encode message carrying one uint32 argument.
+ *
+ * @param[in] type Message type.
+ * @param[in] serviceId Service id.
+ * @param[in] methodId Method id.
+ * @param[in] sequence Sequence number.
+ * @param[in] value Argument.
+ *
+ * @return Encoded message.
+ */
+std::vector<uint8_t> testEncodeMessage(erpc::message_type_t type, uint32_t serviceId, uint32_t methodId,
+                                       uint32_t sequence, uint32_t value);
+
+/*!
+ * @brief Decode message carrying at most one uint32 argument.
+ *
+ * @param[in] message Encoded message.
+ * @param[out] type Message type.
+ * @param[out] methodId Method id.
+ * @param[out] sequence Sequence number.
+ * @param[out] value Argument, left unchanged when the message has none.
+ *
+ * @retval true Header was decoded.
+ * @retval false Message is malformed.
+ */
+bool testDecodeMessage(const std::vector<uint8_t> &message, erpc::message_type_t *type, uint32_t *methodId,
+                       uint32_t *sequence, uint32_t *value);
+
+/*!
+ * @brief Call #TEST_METHOD_ADD_ONE the way a generated client shim does.
+ *
+ * @param[in] client Client manager.
+ * @param[in] value Argument.
+ * @param[out] result Reply of the server.
+ * @param[in] serviceId Called service.
+ *
+ * @return Status of the call.
+ */
+erpc_status_t testCallAddOne(erpc::ClientManager *client, uint32_t value, uint32_t *result,
+                             uint32_t serviceId = TEST_SERVICE_ID);
+
+/*!
+ * @brief Send #TEST_METHOD_ONEWAY the way a generated client shim does.
+ *
+ * @param[in] client Client manager.
+ * @param[in] value Argument.
+ *
+ * @return Status of the call.
+ */
+erpc_status_t testSendOneway(erpc::ClientManager *client, uint32_t value);
+
+/*!
+ * @brief Wait until condition becomes true.
+ *
+ * @param[in] condition Checked condition.
+ * @param[in] timeoutMs Maximum time to wait.
+ *
+ * @retval true Condition became true.
+ * @retval false Timeout expired.
+ */
+template <typename Condition>
+bool testWaitFor(Condition condition, uint32_t timeoutMs = 5000U)
+{
+    for (uint32_t waited = 0; !condition(); ++waited)
+    {
+        if (waited >= timeoutMs)
+        {
+            return false;
+        }
+        erpc::Thread::sleep(1000U);
+    }
+
+    return true;
+}
+
+#endif // _EMBEDDED_RPC__RUNTIME_TEST_COMMON_H_
@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_client_setup.h"
+#include "erpc_simple_server.hpp"
+#include "erpc_threading.h"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <thread>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Delay inserted into the slowed phase of a call, far above time of other phases.
+#define SLOW_PHASE_USECS (20000U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Message buffer factory which can delay creating of buffers.
+ */
+class SlowMessageBufferFactory : public TestMessageBufferFactory
+{
+public:
+    SlowMessageBufferFactory(void) : m_slow(false) {}
+
+    virtual MessageBuffer create(void) override
+    {
+        if (m_slow)
+        {
+            Thread::sleep(SLOW_PHASE_USECS);
+        }
+        return TestMessageBufferFactory::create();
+    }
+
+    bool m_slow;
+};
+
+/*!
+ * @brief Queue transport which can delay or fail sending.
+ */
+class SlowQueueTransport : public TestQueueTransport
+{
+public:
+    SlowQueueTransport(void) : m_slow(false), m_fail(false) {}
+
+    virtual erpc_status_t send(MessageBuffer *message) override
+    {
+        if (m_fail)
+        {
+            return kErpcStatus_SendFailed;
+        }
+        if (m_slow)
+        {
+            Thread::sleep(SLOW_PHASE_USECS);
+        }
+        return TestQueueTransport::send(message);
+    }
+
+    bool m_slow;
+    bool m_fail;
+};
+
+/*!
+ * @brief Service which can delay processing.
+ */
+class SlowService : public TestService
+{
+public:
+    SlowService(void) : TestService(TEST_SERVICE_ID), m_slow(false) {}
+
+    virtual void onInvocation(uint32_t methodId, uint32_t value) override
+    {
+        (void)methodId;
+        (void)value;
+        if (__atomic_load_n(&m_slow, __ATOMIC_ACQUIRE))
+        {
+            Thread::sleep(SLOW_PHASE_USECS);
+        }
+    }
+
+    bool m_slow;
+};
+
+/*!
+ * @brief Client with metrics and simple server linked by queue transports.
+ */
+class ClientMetricsTest : public ::testing::Test
+{
+protected:
+    SlowQueueTransport m_clientTransport;
+    TestQueueTransport m_serverTransport;
+    SlowMessageBufferFactory m_clientMessageFactory;
+    TestMessageBufferFactory m_serverMessageFactory;
+    BasicCodecFactory m_codecFactory;
+    ClientManager m_client;
+    SlowService m_service;
+    SimpleServer m_server;
+    std::thread m_serverThread;
+
+    virtual void SetUp(void) override
+    {
+        m_clientTransport.setPeer(&m_serverTransport);
+        m_serverTransport.setPeer(&m_clientTransport);
+        m_client.setTransport(&m_clientTransport);
+        m_client.setCodecFactory(&m_codecFactory);
+        m_client.setMessageBufferFactory(&m_clientMessageFactory);
+        m_server.setTransport(&m_serverTransport);
+        m_server.setCodecFactory(&m_codecFactory);
+        m_server.setMessageBufferFactory(&m_serverMessageFactory);
+        m_server.addService(&m_service);
+        m_serverThread = std::thread([this] { (void)m_server.run(); });
+    }
+
+    virtual void TearDown(void) override
+    {
+        m_server.stop();
+        m_serverTransport.close();
+        if (m_serverThread.joinable())
+        {
+            m_serverThread.join();
+        }
+    }
+
+    /*!
+     * @brief Call addOne with optional delays in encoding and decoding, like a generated shim doing slow work.
+     */
+    erpc_status_t callAddOne(bool slowEncode, bool slowDecode)
+    {
+        erpc_status_t err;
+        uint32_t result = 0U;
+        RequestContext request = m_client.createRequest(false);
+        Codec *codec = request.getCodec();
+
+        if (codec == NULL)
+        {
+            err = kErpcStatus_MemoryError;
+        }
+        else
+        {
+            codec->startWriteMessage(message_type_t::kInvocationMessage, TEST_SERVICE_ID, TEST_METHOD_ADD_ONE,
+                                     request.getSequence());
+            codec->write(result);
+            if (slowEncode)
+            {
+                Thread::sleep(SLOW_PHASE_USECS);
+            }
+            m_client.performRequest(request);
+            codec->read(result);
+            if (slowDecode)
+            {
+                Thread::sleep(SLOW_PHASE_USECS);
+            }
+            err = codec->getStatus();
+        }
+
+        m_client.releaseRequest(request);
+
+        return err;
+    }
+
+    /*!
+     * @brief Read counters of the only recorded function.
+     */
+    void getOnlyFunctionStats(erpc_client_function_stats_t *stats)
+    {
+        erpc_client_function_stats_t all[2];
+
+        ASSERT_EQ(erpc_client_get_metrics(reinterpret_cast<erpc_client_t>(&m_client), all, 2U, NULL), 1U);
+        *stats = all[0];
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Return count of calls of a phase which took at least #SLOW_PHASE_USECS.
+ */
+static uint32_t countSlow(const erpc_client_function_stats_t &stats, erpc_client_phase_t phase)
+{
+    uint32_t count = 0U;
+
+    for (uint32_t bucket = ClientMetrics::getLatencyBucket(SLOW_PHASE_USECS); bucket < ERPC_CLIENT_LATENCY_BUCKETS;
+         ++bucket)
+    {
+        count += stats.latency[phase][bucket];
+    }
+
+    return count;
+}
+
+/*!
+ * @brief Return count of calls in histogram of a phase.
+ */
+static uint32_t countAll(const erpc_client_function_stats_t &stats, erpc_client_phase_t phase)
+{
+    uint32_t count = 0U;
+
+    for (uint32_t bucket = 0U; bucket < ERPC_CLIENT_LATENCY_BUCKETS; ++bucket)
+    {
+        count += stats.latency[phase][bucket];
+    }
+
+    return count;
+}
+
+TEST_F(ClientMetricsTest, SlowPhaseIsAttributed)
+{
+    erpc_client_function_stats_t stats;
+
+    for (uint32_t slowPhase = kErpcClientPhase_Acquire; slowPhase < kErpcClientPhase_Total; ++slowPhase)
+    {
+        erpc_client_reset_metrics(reinterpret_cast<erpc_client_t>(&m_client));
+
+        m_clientMessageFactory.m_slow = (slowPhase == kErpcClientPhase_Acquire);
+        m_clientTransport.m_slow = (slowPhase == kErpcClientPhase_Send);
+        __atomic_store_n(&m_service.m_slow, (slowPhase == kErpcClientPhase_Wait), __ATOMIC_RELEASE);
+        ASSERT_EQ(callAddOne((slowPhase == kErpcClientPhase_Encode), (slowPhase == kErpcClientPhase_Decode)),
+                  kErpcStatus_Success);
+
+        getOnlyFunctionStats(&stats);
+        EXPECT_EQ(stats.calls, 1U);
+        for (uint32_t phase = kErpcClientPhase_Acquire; phase < kErpcClientPhase_Count; ++phase)
+        {
+            uint32_t expected = ((phase == slowPhase) || (phase == kErpcClientPhase_Total)) ? 1U : 0U;
+
+            EXPECT_EQ(countAll(stats, (erpc_client_phase_t)phase), 1U) << "phase " << phase;
+            EXPECT_EQ(countSlow(stats, (erpc_client_phase_t)phase), expected)
+                << "slow phase " << slowPhase << ", phase " << phase;
+        }
+    }
+}
+
+TEST_F(ClientMetricsTest, FunctionsAreCountedSeparately)
+{
+    erpc_client_t client = reinterpret_cast<erpc_client_t>(&m_client);
+    erpc_client_function_stats_t stats[3];
+    uint32_t untracked = 1U;
+    uint32_t result = 0U;
+
+    for (uint32_t i = 0U; i < 3U; ++i)
+    {
+        ASSERT_EQ(testCallAddOne(&m_client, i, &result), kErpcStatus_Success);
+    }
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        ASSERT_EQ(testSendOneway(&m_client, i), kErpcStatus_Success);
+    }
+    m_clientTransport.m_fail = true;
+    EXPECT_EQ(testCallAddOne(&m_client, 0U, &result), kErpcStatus_SendFailed);
+
+    ASSERT_EQ(erpc_client_get_metrics(client, stats, 3U, &untracked), 2U);
+    EXPECT_EQ(untracked, 0U);
+
+    EXPECT_EQ(stats[0].service_id, (uint32_t)TEST_SERVICE_ID);
+    EXPECT_EQ(stats[0].method_id, (uint32_t)TEST_METHOD_ADD_ONE);
+    EXPECT_EQ(stats[0].calls, 4U);
+    EXPECT_EQ(stats[0].errors, 1U);
+    EXPECT_EQ(stats[0].last_error, kErpcStatus_SendFailed);
+    EXPECT_EQ(countAll(stats[0], kErpcClientPhase_Total), 4U);
+
+    EXPECT_EQ(stats[1].service_id, (uint32_t)TEST_SERVICE_ID);
+    EXPECT_EQ(stats[1].method_id, (uint32_t)TEST_METHOD_ONEWAY);
+    EXPECT_EQ(stats[1].calls, 2U);
+    EXPECT_EQ(stats[1].errors, 0U);
+    EXPECT_EQ(countAll(stats[1], kErpcClientPhase_Total), 2U);
+
+    // Snapshot is limited by the array, functions keep their positions.
+    ASSERT_EQ(erpc_client_get_metrics(client, stats, 1U, NULL), 1U);
+    EXPECT_EQ(stats[0].method_id, (uint32_t)TEST_METHOD_ADD_ONE);
+
+    erpc_client_reset_metrics(client);
+    ASSERT_EQ(erpc_client_get_metrics(client, stats, 3U, NULL), 2U);
+    EXPECT_EQ(stats[0].calls, 0U);
+    EXPECT_EQ(stats[0].errors, 0U);
+    EXPECT_EQ(countAll(stats[0], kErpcClientPhase_Total), 0U);
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_fragmenting_transport.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_FRAGMENT_MTU (64U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Loopback link refusing frames bigger than its MTU.
+ */
+class MtuQueueTransport : public TestQueueTransport
+{
+public:
+    explicit MtuQueueTransport(uint16_t mtu) : m_mtu(mtu) {}
+
+    virtual erpc_status_t send(MessageBuffer *message) override
+    {
+        if (message->getUsed() > m_mtu)
+        {
+            return kErpcStatus_SendFailed;
+        }
+
+        return TestQueueTransport::send(message);
+    }
+
+protected:
+    uint16_t m_mtu; /*!< Largest frame the link carries. */
+};
+
+/*!
+ * @brief Sender and receiver connected by a link the test forwards fragments over, so it can lose some of them.
+ */
+class FragmentingTransportTest : public ::testing::Test
+{
+protected:
+    MtuQueueTransport m_sendLink{ TEST_FRAGMENT_MTU };
+    MtuQueueTransport m_receiveLink{ TEST_FRAGMENT_MTU };
+    TestMessageBufferFactory m_fragmentFactory{ TEST_FRAGMENT_MTU };
+    FragmentingTransport m_sender{ &m_sendLink, TEST_FRAGMENT_MTU };
+    FragmentingTransport m_receiver{ &m_receiveLink, TEST_FRAGMENT_MTU };
+    std::vector<uint8_t> m_receiveData;
+    MessageBuffer m_receiveMessage;
+
+    virtual void SetUp(void) override
+    {
+        m_sender.setFragmentFactory(&m_fragmentFactory);
+        m_receiver.setFragmentFactory(&m_fragmentFactory);
+        setReceiveSize(1024U);
+    }
+
+    virtual void TearDown(void) override { EXPECT_EQ(m_fragmentFactory.getOutstanding(), 0); }
+
+    void setReceiveSize(uint16_t size)
+    {
+        m_receiveData.assign(size, 0U);
+        m_receiveMessage.set(m_receiveData.data(), size);
+    }
+
+    //! @brief Send message with pattern data and return its data.
+    std::vector<uint8_t> sendMessage(uint16_t size, uint8_t seed)
+    {
+        std::vector<uint8_t> data(size);
+
+        for (uint16_t i = 0; i < size; ++i)
+        {
+            data[i] = (uint8_t)(seed + (i * 3U));
+        }
+        MessageBuffer message(data.data(), size);
+        message.setUsed(size);
+        EXPECT_EQ(m_sender.send(&message), kErpcStatus_Success);
+
+        return data;
+    }
+
+    //! @brief Move sent fragments to the receiver, except the one with given index.
+    uint32_t forwardFragments(int32_t lostIndex = -1)
+    {
+        std::vector<uint8_t> fragment;
+        int32_t index = 0;
+
+        while (m_sendLink.popSent(&fragment))
+        {
+            if (index != lostIndex)
+            {
+                m_receiveLink.pushMessage(fragment);
+            }
+            ++index;
+        }
+
+        return (uint32_t)index;
+    }
+
+    //! @brief Receive message and compare it with expected data.
+    void expectMessage(const std::vector<uint8_t> &expected)
+    {
+        ASSERT_EQ(m_receiver.receive(&m_receiveMessage), kErpcStatus_Success);
+        ASSERT_EQ(m_receiveMessage.getUsed(), expected.size());
+        EXPECT_EQ(std::vector<uint8_t>(m_receiveData.begin(), m_receiveData.begin() + expected.size()), expected);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(FragmentingTransportTest, ReassemblesMultiFragmentMessage)
+{
+    const uint16_t chunk = TEST_FRAGMENT_MTU - FragmentingTransport::kHeaderSize;
+    std::vector<uint8_t> data = sendMessage(1000U, 1U);
+
+    // Link refuses bigger frames, so every fragment fits the MTU.
+    EXPECT_EQ(forwardFragments(), (1000U + chunk - 1U) / chunk);
+    expectMessage(data);
+
+    data = sendMessage(chunk, 2U);
+    EXPECT_EQ(forwardFragments(), 1U);
+    expectMessage(data);
+
+    EXPECT_EQ(m_receiver.getDroppedCount(), 0U);
+}
+
+TEST_F(FragmentingTransportTest, LostMiddleFragmentResynchronizes)
+{
+    std::vector<uint8_t> next;
+
+    (void)sendMessage(300U, 3U);
+    ASSERT_GT(forwardFragments(2), 3U);
+
+    // Rest of the broken message is skipped until the first fragment of the next one.
+    next = sendMessage(200U, 4U);
+    (void)forwardFragments();
+    expectMessage(next);
+    EXPECT_EQ(m_receiver.getDroppedCount(), 1U);
+}
+
+TEST_F(FragmentingTransportTest, LostFirstFragmentResynchronizes)
+{
+    std::vector<uint8_t> next;
+
+    (void)sendMessage(300U, 5U);
+    (void)forwardFragments(0);
+
+    next = sendMessage(100U, 6U);
+    (void)forwardFragments();
+    expectMessage(next);
+    EXPECT_EQ(m_receiver.getDroppedCount(), 1U);
+}
+
+TEST_F(FragmentingTransportTest, OversizeMessageIsDiscarded)
+{
+    std::vector<uint8_t> next;
+
+    setReceiveSize(256U);
+    (void)sendMessage(600U, 7U);
+    (void)forwardFragments();
+
+    // Fragments of the oversize message are consumed without writing past the receive buffer.
+    next = sendMessage(256U, 8U);
+    (void)forwardFragments();
+    expectMessage(next);
+    EXPECT_EQ(m_receiver.getDroppedCount(), 1U);
+}
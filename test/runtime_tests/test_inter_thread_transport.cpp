@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_inter_thread_buffer_transport.hpp"
+#include "erpc_simple_server.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <cstring>
+#include <thread>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+static void writeNumber(MessageBuffer *message, uint32_t number)
+{
+    (void)memcpy(message->get(), &number, sizeof(number));
+    message->setUsed(sizeof(number));
+}
+
+static uint32_t readNumber(const MessageBuffer &message)
+{
+    uint32_t number;
+
+    (void)memcpy(&number, message.get(), sizeof(number));
+
+    return number;
+}
+
+TEST(InterThreadBufferTransport, SenderDoesNotWaitForReceiver)
+{
+    TestMessageBufferFactory messageFactory;
+
+    {
+        InterThreadBufferTransport sender;
+        InterThreadBufferTransport receiver;
+        MessageBuffer message;
+
+        sender.linkWithPeer(&receiver);
+        sender.setMessageBufferFactory(&messageFactory);
+        receiver.setMessageBufferFactory(&messageFactory);
+
+        // All slots are filled from one thread without any receive.
+        EXPECT_FALSE(receiver.hasMessage());
+        for (uint32_t i = 0U; i < ERPC_INTER_THREAD_BUFFER_SLOTS; ++i)
+        {
+            message = messageFactory.create();
+            writeNumber(&message, i);
+            ASSERT_EQ(sender.send(&message), kErpcStatus_Success);
+            // Sender continues with the empty buffer of the slot, the message is not copied.
+            EXPECT_EQ(message.get(), nullptr);
+        }
+        EXPECT_TRUE(receiver.hasMessage());
+
+        // Receive half of the messages, the rest stays pending until the transports are destroyed.
+        for (uint32_t i = 0U; i < (ERPC_INTER_THREAD_BUFFER_SLOTS / 2U); ++i)
+        {
+            message = messageFactory.create();
+            ASSERT_EQ(receiver.receive(&message), kErpcStatus_Success);
+            EXPECT_EQ(readNumber(message), i);
+            messageFactory.dispose(&message);
+        }
+        EXPECT_EQ(messageFactory.getOutstanding(), (int32_t)ERPC_INTER_THREAD_BUFFER_SLOTS);
+    }
+
+    // Pending messages and spare buffers were disposed with the transports.
+    EXPECT_EQ(messageFactory.getOutstanding(), 0);
+}
+
+TEST(InterThreadBufferTransport, MessagesStayInOrderUnderLoad)
+{
+    const uint32_t count = 100000U;
+    TestMessageBufferFactory messageFactory(16U);
+
+    {
+        InterThreadBufferTransport sender;
+        InterThreadBufferTransport receiver;
+
+        sender.linkWithPeer(&receiver);
+        sender.setMessageBufferFactory(&messageFactory);
+        receiver.setMessageBufferFactory(&messageFactory);
+
+        std::thread producer([&] {
+            MessageBuffer message;
+
+            for (uint32_t i = 0U; i < count; ++i)
+            {
+                // Reuse spare buffer left in the slot by the receiver.
+                if (message.get() == NULL)
+                {
+                    message = messageFactory.create();
+                }
+                writeNumber(&message, i);
+                ASSERT_EQ(sender.send(&message), kErpcStatus_Success);
+            }
+            messageFactory.dispose(&message);
+        });
+
+        MessageBuffer message = messageFactory.create();
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            ASSERT_EQ(receiver.receive(&message), kErpcStatus_Success);
+            ASSERT_EQ(readNumber(message), i);
+        }
+        messageFactory.dispose(&message);
+        producer.join();
+
+        // Buffers circulate between the sides instead of being created for each message.
+        EXPECT_LE(messageFactory.getOutstanding(), (int32_t)ERPC_INTER_THREAD_BUFFER_SLOTS);
+    }
+
+    EXPECT_EQ(messageFactory.getOutstanding(), 0);
+}
+
+TEST(InterThreadBufferTransport, ClientCallsServerOnOtherThread)
+{
+    TestMessageBufferFactory messageFactory;
+    InterThreadBufferTransport clientTransport;
+    InterThreadBufferTransport serverTransport;
+    BasicCodecFactory codecFactory;
+    ClientManager client;
+    TestService service;
+    SimpleServer server;
+    uint32_t result = 0U;
+
+    clientTransport.linkWithPeer(&serverTransport);
+    clientTransport.setMessageBufferFactory(&messageFactory);
+    serverTransport.setMessageBufferFactory(&messageFactory);
+    client.setTransport(&clientTransport);
+    client.setCodecFactory(&codecFactory);
+    client.setMessageBufferFactory(&messageFactory);
+    server.setTransport(&serverTransport);
+    server.setCodecFactory(&codecFactory);
+    server.setMessageBufferFactory(&messageFactory);
+    server.addService(&service);
+
+    std::thread serverThread([&] {
+        while (service.getOnewayCount() == 0U)
+        {
+            ASSERT_EQ(server.poll(), kErpcStatus_Success);
+        }
+    });
+
+    for (uint32_t i = 0U; i < 100U; ++i)
+    {
+        ASSERT_EQ(testCallAddOne(&client, i, &result), kErpcStatus_Success);
+        EXPECT_EQ(result, i + 1U);
+    }
+    EXPECT_EQ(testSendOneway(&client, 0U), kErpcStatus_Success);
+    serverThread.join();
+}
@@ -0,0 +1,235 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_crc16.hpp"
+#include "erpc_io_uring.hpp"
+#include "erpc_simple_server.hpp"
+#include "erpc_tcp_transport.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_IO_URING_PORT (12460U)
+#define TEST_IO_URING_BUFFERS (4U)
+#define TEST_IO_URING_BUFFER_SIZE (64U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Receiver reading from one end of a stream socket pair, the test writes to the other end.
+ */
+class IoUringReceiverTest : public ::testing::Test
+{
+protected:
+    int m_sockets[2] = { -1, -1 };
+    IoUringReceiver m_receiver;
+
+    virtual void SetUp(void) override
+    {
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, m_sockets), 0);
+        ASSERT_TRUE(m_receiver.init(TEST_IO_URING_BUFFERS, TEST_IO_URING_BUFFER_SIZE));
+    }
+
+    virtual void TearDown(void) override
+    {
+        closeSockets();
+    }
+
+    void closeSockets(void)
+    {
+        for (int &fd : m_sockets)
+        {
+            if (fd != -1)
+            {
+                (void)close(fd);
+                fd = -1;
+            }
+        }
+    }
+
+    void writePeer(const std::vector<uint8_t> &data)
+    {
+        ASSERT_EQ(write(m_sockets[1], data.data(), data.size()), (ssize_t)data.size());
+    }
+};
+
+/*!
+ * @brief TCP transport telling whether it receives through io_uring.
+ */
+class TestTcpTransport : public TCPTransport
+{
+public:
+    TestTcpTransport(const char *host, uint16_t port, bool isServer) : TCPTransport(host, port, isServer) {}
+
+    bool receivesByIoUring(void) const { return m_uring.isActive(); }
+};
+
+/*!
+ * @brief Server side of TCP test. Server thread blocks in the transport and lives until the test program exits.
+ */
+struct TcpUringServer
+{
+    TestTcpTransport transport{ "localhost", TEST_IO_URING_PORT, true };
+    Crc16 crc16;
+    TestMessageBufferFactory messageFactory;
+    BasicCodecFactory codecFactory;
+    SimpleServer server;
+    TestService service;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<uint8_t> makePattern(uint32_t size, uint8_t seed)
+{
+    std::vector<uint8_t> data(size);
+
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        data[i] = (uint8_t)(seed + i);
+    }
+
+    return data;
+}
+
+TEST_F(IoUringReceiverTest, ReceivesAcrossBufferBoundaries)
+{
+    std::vector<uint8_t> sent = makePattern(1000U, 1U);
+    std::vector<uint8_t> received(sent.size());
+    uint32_t offset = 0;
+    uint32_t size = 1U;
+
+    // More data than all registered buffers hold, so the kernel runs out of buffers and receive is posted again.
+    writePeer(sent);
+    while (offset < received.size())
+    {
+        if (size > received.size() - offset)
+        {
+            size = (uint32_t)(received.size() - offset);
+        }
+        ASSERT_EQ(m_receiver.receive(m_sockets[0], 1U, &received[offset], size), kErpcStatus_Success);
+        offset += size;
+        size = (size * 3U) % 97U + 1U;
+    }
+
+    EXPECT_TRUE(m_receiver.isActive());
+    EXPECT_EQ(received, sent);
+}
+
+TEST_F(IoUringReceiverTest, WaitsForLateData)
+{
+    std::vector<uint8_t> sent = makePattern(100U, 7U);
+    std::vector<uint8_t> received(sent.size());
+    std::thread writer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        (void)write(m_sockets[1], sent.data(), sent.size());
+    });
+
+    EXPECT_EQ(m_receiver.receive(m_sockets[0], 1U, received.data(), (uint32_t)received.size()), kErpcStatus_Success);
+    writer.join();
+    EXPECT_EQ(received, sent);
+}
+
+TEST_F(IoUringReceiverTest, PeerCloseIsReported)
+{
+    uint8_t data[8];
+
+    writePeer(makePattern(4U, 0U));
+    (void)close(m_sockets[1]);
+    m_sockets[1] = -1;
+
+    EXPECT_EQ(m_receiver.receive(m_sockets[0], 1U, data, sizeof(data)), kErpcStatus_ConnectionClosed);
+}
+
+TEST_F(IoUringReceiverTest, NewConnectionDropsOldData)
+{
+    std::vector<uint8_t> sent = makePattern(32U, 0x40U);
+    std::vector<uint8_t> received(sent.size());
+    uint8_t data[4];
+
+    // Connection 1 leaves buffered data behind.
+    writePeer(makePattern(16U, 0U));
+    ASSERT_EQ(m_receiver.receive(m_sockets[0], 1U, data, sizeof(data)), kErpcStatus_Success);
+    closeSockets();
+
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, m_sockets), 0);
+    writePeer(sent);
+    ASSERT_EQ(m_receiver.receive(m_sockets[0], 2U, received.data(), (uint32_t)received.size()), kErpcStatus_Success);
+    EXPECT_EQ(received, sent);
+}
+
+TEST(TcpIoUring, OnlyServerReceivesByIoUring)
+{
+    static TcpUringServer server;
+    Crc16 crc16;
+    TestMessageBufferFactory messageFactory;
+    BasicCodecFactory codecFactory;
+    ClientManager client;
+    TestTcpTransport transport("localhost", TEST_IO_URING_PORT, false);
+    uint32_t result;
+
+    server.transport.setCrc16(&server.crc16);
+    server.server.setTransport(&server.transport);
+    server.server.setCodecFactory(&server.codecFactory);
+    server.server.setMessageBufferFactory(&server.messageFactory);
+    server.server.addService(&server.service);
+    ASSERT_EQ(server.transport.open(), kErpcStatus_Success);
+    std::thread([] {
+        // Server returns when client disconnects.
+        for (;;)
+        {
+            (void)server.server.run();
+        }
+    }).detach();
+
+    // Server binds the port from its own thread.
+    ASSERT_TRUE(testWaitFor([&] { return transport.open() == kErpcStatus_Success; }));
+    transport.setCrc16(&crc16);
+    client.setTransport(&transport);
+    client.setCodecFactory(&codecFactory);
+    client.setMessageBufferFactory(&messageFactory);
+
+    // Messages are shorter than io_uring buffers, completions carry several frames or parts of them.
+    for (uint32_t i = 0; i < 100U; ++i)
+    {
+        ASSERT_EQ(testCallAddOne(&client, i, &result), kErpcStatus_Success);
+        EXPECT_EQ(result, i + 1U);
+        ASSERT_EQ(testSendOneway(&client, i), kErpcStatus_Success);
+    }
+    EXPECT_TRUE(testWaitFor([&] { return server.service.getOnewayCount() == 100U; }));
+
+    EXPECT_TRUE(server.transport.receivesByIoUring());
+    EXPECT_FALSE(transport.receivesByIoUring());
+
+    (void)transport.close();
+}
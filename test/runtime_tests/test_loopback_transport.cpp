@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_loopback_transport.hpp"
+#include "erpc_priority_server.hpp"
+#include "erpc_server_setup.h"
+#include "erpc_transport_setup.h"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Client and server sharing one loopback transport in the test thread.
+ */
+class LoopbackTransportTest : public ::testing::Test
+{
+protected:
+    erpc_transport_t m_transport;
+    TestMessageBufferFactory m_messageFactory;
+    BasicCodecFactory m_codecFactory;
+    ClientManager m_client;
+    TestService m_service;
+    SimpleServer m_server;
+
+    virtual void SetUp(void) override
+    {
+        m_transport = erpc_transport_loopback_init(reinterpret_cast<erpc_mbf_t>(&m_messageFactory));
+        ASSERT_NE(m_transport, nullptr);
+
+        m_client.setTransport(reinterpret_cast<Transport *>(m_transport));
+        m_client.setCodecFactory(&m_codecFactory);
+        m_client.setMessageBufferFactory(&m_messageFactory);
+        m_server.setTransport(reinterpret_cast<Transport *>(m_transport));
+        m_server.setCodecFactory(&m_codecFactory);
+        m_server.setMessageBufferFactory(&m_messageFactory);
+        m_server.addService(&m_service);
+    }
+
+    virtual void TearDown(void) override
+    {
+        if (m_transport != NULL)
+        {
+            erpc_transport_loopback_deinit(m_transport);
+        }
+    }
+
+    erpc_server_t getServer(SimpleServer *server) { return reinterpret_cast<erpc_server_t>(server); }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(LoopbackTransportTest, ServerProcessesRequestsInCallingThread)
+{
+    uint32_t result = 0U;
+
+    ASSERT_TRUE(erpc_transport_loopback_set_server(m_transport, getServer(&m_server)));
+
+    for (uint32_t i = 0U; i < 100U; ++i)
+    {
+        ASSERT_EQ(testCallAddOne(&m_client, i, &result), kErpcStatus_Success);
+        EXPECT_EQ(result, i + 1U);
+    }
+
+    // Oneway is processed before sending returns.
+    EXPECT_EQ(testSendOneway(&m_client, 0U), kErpcStatus_Success);
+    EXPECT_EQ(m_service.getOnewayCount(), 1U);
+
+    // Spare buffers kept by the transport are returned to the factory with it.
+    erpc_transport_loopback_deinit(m_transport);
+    m_transport = NULL;
+    EXPECT_EQ(m_messageFactory.getOutstanding(), 0);
+}
+
+TEST_F(LoopbackTransportTest, AsynchronousServerIsRejected)
+{
+    PriorityServer priorityServer;
+    uint32_t result = 0U;
+
+    priorityServer.setTransport(reinterpret_cast<Transport *>(m_transport));
+    EXPECT_FALSE(erpc_transport_loopback_set_server(m_transport, getServer(&priorityServer)));
+
+    // No server was attached.
+    EXPECT_EQ(testCallAddOne(&m_client, 1U, &result), kErpcStatus_ConnectionFailure);
+}
+
+TEST_F(LoopbackTransportTest, ServerWithOtherFactoryIsRejected)
+{
+    TestMessageBufferFactory otherFactory;
+    uint32_t result = 0U;
+
+    // Server would dispose client's buffers to its own factory.
+    m_server.setMessageBufferFactory(&otherFactory);
+    EXPECT_FALSE(erpc_transport_loopback_set_server(m_transport, getServer(&m_server)));
+    EXPECT_EQ(testCallAddOne(&m_client, 1U, &result), kErpcStatus_ConnectionFailure);
+
+    m_server.setMessageBufferFactory(&m_messageFactory);
+    ASSERT_TRUE(erpc_transport_loopback_set_server(m_transport, getServer(&m_server)));
+    ASSERT_EQ(testCallAddOne(&m_client, 1U, &result), kErpcStatus_Success);
+    EXPECT_EQ(result, 2U);
+    EXPECT_EQ(otherFactory.getOutstanding(), 0);
+}
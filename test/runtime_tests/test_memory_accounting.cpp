@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_port.h"
+#include "erpc_simple_server.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Service of functions with list parameters, not used by other tests.
+#define PARAMS_SERVICE_ID (9U)
+
+//! @brief Function returning sum of list of int32.
+#define PARAMS_METHOD_SUM (1U)
+
+//! @brief Function returning maximum of list of int32.
+#define PARAMS_METHOD_MAX (2U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Service with functions sum(list<int32> values) -> int32 and max(list<int32> values) -> int32.
+ *
+ * The shim decodes the list like the server shim generated by erpcgen, into memory allocated with the tag of the
+ * function.
+ */
+class ParamsService : public Service
+{
+public:
+    ParamsService(void) : Service(PARAMS_SERVICE_ID), m_bytesInCall(0) {}
+
+    virtual erpc_status_t handleInvocation(uint32_t methodId, uint32_t sequence, Codec *codec,
+                                           MessageBufferFactory *messageFactory, Transport *transport) override;
+
+    /*!
+     * @brief Return current bytes of the function seen by the last call while its parameters were allocated.
+     */
+    uint32_t getBytesInCall(void) const { return __atomic_load_n(&m_bytesInCall, __ATOMIC_ACQUIRE); }
+
+protected:
+    uint32_t m_bytesInCall;
+};
+
+/*!
+ * @brief Client and simple server linked by queue transports, with memory accounting.
+ */
+class MemoryAccountingTest : public ::testing::Test
+{
+protected:
+    TestQueueTransport m_clientTransport;
+    TestQueueTransport m_serverTransport;
+    TestMessageBufferFactory m_messageFactory;
+    BasicCodecFactory m_codecFactory;
+    ClientManager m_client;
+    ParamsService m_service;
+    SimpleServer m_server;
+    std::thread m_serverThread;
+
+    virtual void SetUp(void) override
+    {
+        m_clientTransport.setPeer(&m_serverTransport);
+        m_serverTransport.setPeer(&m_clientTransport);
+        m_client.setTransport(&m_clientTransport);
+        m_client.setCodecFactory(&m_codecFactory);
+        m_client.setMessageBufferFactory(&m_messageFactory);
+        m_server.setTransport(&m_serverTransport);
+        m_server.setCodecFactory(&m_codecFactory);
+        m_server.setMessageBufferFactory(&m_messageFactory);
+        m_server.addService(&m_service);
+        m_serverThread = std::thread([this] { (void)m_server.run(); });
+    }
+
+    virtual void TearDown(void) override
+    {
+        m_server.stop();
+        m_serverTransport.close();
+        if (m_serverThread.joinable())
+        {
+            m_serverThread.join();
+        }
+    }
+
+    /*!
+     * @brief Call function with list parameter like a generated client shim.
+     */
+    erpc_status_t callList(uint32_t methodId, const std::vector<int32_t> &values, int32_t *result)
+    {
+        erpc_status_t err;
+        RequestContext request = m_client.createRequest(false);
+        Codec *codec = request.getCodec();
+
+        if (codec == NULL)
+        {
+            err = kErpcStatus_MemoryError;
+        }
+        else
+        {
+            codec->startWriteMessage(message_type_t::kInvocationMessage, PARAMS_SERVICE_ID, methodId,
+                                     request.getSequence());
+            codec->startWriteList(values.size());
+            for (int32_t value : values)
+            {
+                codec->write(value);
+            }
+            m_client.performRequest(request);
+            codec->read(*result);
+            err = codec->getStatus();
+        }
+
+        m_client.releaseRequest(request);
+
+        return err;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Read counters of decoded parameters of a function.
+ *
+ * @retval true Function has counters.
+ * @retval false Parameters of the function were never allocated.
+ */
+static bool getFunctionStats(uint32_t serviceId, uint32_t methodId, erpc_memory_stats_t *stats)
+{
+    uint32_t service;
+    uint32_t method;
+
+    for (uint32_t index = 0U; index < erpc_memory_get_function_count(); ++index)
+    {
+        if (erpc_memory_get_function_stats(index, &service, &method, stats) && (service == serviceId) &&
+            (method == methodId))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+erpc_status_t ParamsService::handleInvocation(uint32_t methodId, uint32_t sequence, Codec *codec,
+                                              MessageBufferFactory *messageFactory, Transport *transport)
+{
+    erpc_status_t err;
+    uint32_t count = 0U;
+    int32_t *values = NULL;
+    int32_t result = 0;
+    erpc_memory_stats_t stats;
+
+    if ((methodId != PARAMS_METHOD_SUM) && (methodId != PARAMS_METHOD_MAX))
+    {
+        return kErpcStatus_InvalidArgument;
+    }
+
+    codec->startReadList(count);
+    values = (int32_t *)ERPC_MALLOC_TAGGED(count * sizeof(int32_t), codec->getMemoryTag());
+    if ((values == NULL) && (count > 0U))
+    {
+        codec->updateStatus(kErpcStatus_MemoryError);
+    }
+    else
+    {
+        for (uint32_t index = 0U; index < count; ++index)
+        {
+            codec->read(values[index]);
+        }
+    }
+
+    err = codec->getStatus();
+    if (err == kErpcStatus_Success)
+    {
+        // Implementation of the function.
+        for (uint32_t index = 0U; index < count; ++index)
+        {
+            if (methodId == PARAMS_METHOD_SUM)
+            {
+                result += values[index];
+            }
+            else if ((index == 0U) || (values[index] > result))
+            {
+                result = values[index];
+            }
+        }
+        if (getFunctionStats(PARAMS_SERVICE_ID, methodId, &stats))
+        {
+            __atomic_store_n(&m_bytesInCall, stats.currentBytes, __ATOMIC_RELEASE);
+        }
+
+        err = messageFactory->prepareServerBufferForSend(codec->getBufferRef(), transport->reserveHeaderSize());
+    }
+
+    if (err == kErpcStatus_Success)
+    {
+        codec->reset(transport->reserveHeaderSize());
+        codec->startWriteMessage(message_type_t::kReplyMessage, m_serviceId, methodId, sequence);
+        codec->write(result);
+        err = codec->getStatus();
+    }
+
+    erpc_free(values);
+
+    return err;
+}
+
+TEST_F(MemoryAccountingTest, ParametersAreCountedPerFunction)
+{
+    erpc_memory_stats_t before;
+    erpc_memory_stats_t params;
+    erpc_memory_stats_t sum;
+    erpc_memory_stats_t max;
+    int32_t result = 0;
+
+    ASSERT_TRUE(erpc_memory_get_stats(kErpcMemory_Params, &before));
+
+    ASSERT_EQ(callList(PARAMS_METHOD_SUM, { 1, 2, 3, 4 }, &result), kErpcStatus_Success);
+    EXPECT_EQ(result, 10);
+    EXPECT_EQ(m_service.getBytesInCall(), 4U * sizeof(int32_t));
+    ASSERT_EQ(callList(PARAMS_METHOD_SUM, { 5, 6 }, &result), kErpcStatus_Success);
+    EXPECT_EQ(result, 11);
+    ASSERT_EQ(callList(PARAMS_METHOD_MAX, { 1, 8, 3, 4, 5, 6, 7, 2 }, &result), kErpcStatus_Success);
+    EXPECT_EQ(result, 8);
+    EXPECT_EQ(m_service.getBytesInCall(), 8U * sizeof(int32_t));
+
+    ASSERT_TRUE(getFunctionStats(PARAMS_SERVICE_ID, PARAMS_METHOD_SUM, &sum));
+    EXPECT_EQ(sum.allocations, 2U);
+    EXPECT_EQ(sum.frees, 2U);
+    EXPECT_EQ(sum.failures, 0U);
+    EXPECT_EQ(sum.currentBytes, 0U);
+    EXPECT_EQ(sum.peakBytes, 4U * sizeof(int32_t));
+
+    ASSERT_TRUE(getFunctionStats(PARAMS_SERVICE_ID, PARAMS_METHOD_MAX, &max));
+    EXPECT_EQ(max.allocations, 1U);
+    EXPECT_EQ(max.frees, 1U);
+    EXPECT_EQ(max.currentBytes, 0U);
+    EXPECT_EQ(max.peakBytes, 8U * sizeof(int32_t));
+
+    // Functions are counted in the parameters category as well.
+    ASSERT_TRUE(erpc_memory_get_stats(kErpcMemory_Params, &params));
+    EXPECT_EQ(params.allocations - before.allocations, 3U);
+    EXPECT_EQ(params.frees - before.frees, 3U);
+    EXPECT_EQ(params.currentBytes, before.currentBytes);
+
+    // Functions keep their counters, peaks restart from current bytes.
+    erpc_memory_reset_peaks();
+    ASSERT_TRUE(getFunctionStats(PARAMS_SERVICE_ID, PARAMS_METHOD_SUM, &sum));
+    EXPECT_EQ(sum.allocations, 2U);
+    EXPECT_EQ(sum.peakBytes, 0U);
+}
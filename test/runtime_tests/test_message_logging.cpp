@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_simple_server.hpp"
+#include "erpc_threading.h"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <thread>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Time a slow logger spends on each message.
+#define SLOW_LOGGER_USECS (200U)
+
+//! @brief Count of calls made by tests.
+#define LOGGED_CALLS (64U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Logger transport which takes its time and counts logged messages.
+ */
+class SlowLoggerTransport : public Transport
+{
+public:
+    SlowLoggerTransport(void) : m_count(0) {}
+
+    virtual erpc_status_t receive(MessageBuffer *message) override
+    {
+        (void)message;
+        return kErpcStatus_ReceiveFailed;
+    }
+
+    virtual erpc_status_t send(MessageBuffer *message) override
+    {
+        (void)message;
+        Thread::sleep(SLOW_LOGGER_USECS);
+        (void)__atomic_add_fetch(&m_count, 1U, __ATOMIC_ACQ_REL);
+        return kErpcStatus_Success;
+    }
+
+    uint32_t getCount(void) const { return __atomic_load_n(&m_count, __ATOMIC_ACQUIRE); }
+
+protected:
+    uint32_t m_count;
+};
+
+/*!
+ * @brief Client and simple server linked by queue transports, both logging messages.
+ */
+class MessageLoggingTest : public ::testing::Test
+{
+protected:
+    TestQueueTransport m_clientTransport;
+    TestQueueTransport m_serverTransport;
+    TestMessageBufferFactory m_messageFactory;
+    BasicCodecFactory m_codecFactory;
+    ClientManager m_client;
+    TestService m_service;
+    SimpleServer m_server;
+    SlowLoggerTransport m_clientLogger;
+    SlowLoggerTransport m_lateClientLogger;
+    SlowLoggerTransport m_serverLogger;
+    std::thread m_serverThread;
+
+    virtual void SetUp(void) override
+    {
+        m_clientTransport.setPeer(&m_serverTransport);
+        m_serverTransport.setPeer(&m_clientTransport);
+        m_client.setTransport(&m_clientTransport);
+        m_client.setCodecFactory(&m_codecFactory);
+        m_client.setMessageBufferFactory(&m_messageFactory);
+        m_server.setTransport(&m_serverTransport);
+        m_server.setCodecFactory(&m_codecFactory);
+        m_server.setMessageBufferFactory(&m_messageFactory);
+        m_server.addService(&m_service);
+        m_serverThread = std::thread([this] { (void)m_server.run(); });
+    }
+
+    virtual void TearDown(void) override
+    {
+        m_server.stop();
+        m_serverTransport.close();
+        if (m_serverThread.joinable())
+        {
+            m_serverThread.join();
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Return true when each of given count of messages was either logged or dropped.
+ */
+static bool allLoggedOrDropped(const SlowLoggerTransport &logger, uint32_t dropped, uint32_t count)
+{
+    return (logger.getCount() + dropped) == count;
+}
+
+TEST_F(MessageLoggingTest, EveryMessageIsLoggedOrDropped)
+{
+    uint32_t result = 0U;
+
+    ASSERT_TRUE(m_client.addMessageLogger(&m_clientLogger));
+    ASSERT_TRUE(m_server.addMessageLogger(&m_serverLogger));
+
+    for (uint32_t i = 0U; i < LOGGED_CALLS; ++i)
+    {
+        ASSERT_EQ(testCallAddOne(&m_client, i, &result), kErpcStatus_Success);
+        EXPECT_EQ(result, i + 1U);
+    }
+
+    // Request and reply of each call are logged on both sides.
+    EXPECT_TRUE(testWaitFor(
+        [&] { return allLoggedOrDropped(m_clientLogger, m_client.getDroppedCount(), 2U * LOGGED_CALLS); }));
+    EXPECT_TRUE(testWaitFor(
+        [&] { return allLoggedOrDropped(m_serverLogger, m_server.getDroppedCount(), 2U * LOGGED_CALLS); }));
+    EXPECT_GT(m_clientLogger.getCount(), 0U);
+    EXPECT_GT(m_serverLogger.getCount(), 0U);
+}
+
+TEST_F(MessageLoggingTest, LoggerIsAddedWhileLogging)
+{
+    uint32_t result = 0U;
+    uint32_t before;
+
+    ASSERT_TRUE(m_client.addMessageLogger(&m_clientLogger));
+    for (uint32_t i = 0U; i < LOGGED_CALLS; ++i)
+    {
+        ASSERT_EQ(testCallAddOne(&m_client, i, &result), kErpcStatus_Success);
+        if (i == (LOGGED_CALLS / 2U))
+        {
+            // Logging thread is busy with queued messages of earlier calls.
+            ASSERT_TRUE(m_client.addMessageLogger(&m_lateClientLogger));
+        }
+    }
+
+    EXPECT_TRUE(testWaitFor(
+        [&] { return allLoggedOrDropped(m_clientLogger, m_client.getDroppedCount(), 2U * LOGGED_CALLS); }));
+
+    // The last message may still be passed to the late logger.
+    Thread::sleep(2U * SLOW_LOGGER_USECS);
+    before = m_lateClientLogger.getCount();
+    EXPECT_GT(before, 0U);
+    EXPECT_LE(before, m_clientLogger.getCount());
+
+    // Both loggers get every message logged from now on.
+    ASSERT_EQ(testCallAddOne(&m_client, 0U, &result), kErpcStatus_Success);
+    EXPECT_TRUE(testWaitFor([&] { return m_lateClientLogger.getCount() == (before + 2U); }));
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_simple_server.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <thread>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Client and simple server linked by queue transports. Server is started by the test.
+ */
+class OnewayCreditsTest : public ::testing::Test
+{
+protected:
+    TestQueueTransport m_clientTransport;
+    TestQueueTransport m_serverTransport;
+    TestMessageBufferFactory m_messageFactory;
+    BasicCodecFactory m_codecFactory;
+    ClientManager m_client;
+    TestService m_service;
+    SimpleServer m_server;
+    std::thread m_serverThread;
+
+    virtual void SetUp(void) override
+    {
+        m_clientTransport.setPeer(&m_serverTransport);
+        m_serverTransport.setPeer(&m_clientTransport);
+        m_client.setTransport(&m_clientTransport);
+        m_client.setCodecFactory(&m_codecFactory);
+        m_client.setMessageBufferFactory(&m_messageFactory);
+        m_server.setTransport(&m_serverTransport);
+        m_server.setCodecFactory(&m_codecFactory);
+        m_server.setMessageBufferFactory(&m_messageFactory);
+        m_server.addService(&m_service);
+    }
+
+    virtual void TearDown(void) override
+    {
+        m_server.stop();
+        m_serverTransport.close();
+        if (m_serverThread.joinable())
+        {
+            m_serverThread.join();
+        }
+    }
+
+    void startServer(void)
+    {
+        m_serverThread = std::thread([this] { (void)m_server.run(); });
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(OnewayCreditsTest, FailFastWhenWindowIsExhausted)
+{
+    m_client.setOnewayFailFast(true);
+
+    // Server is not running yet, so the whole window stays outstanding.
+    for (uint32_t i = 0U; i < ERPC_ONEWAY_CREDITS; ++i)
+    {
+        EXPECT_EQ(testSendOneway(&m_client, i), kErpcStatus_Success);
+    }
+    EXPECT_EQ(testSendOneway(&m_client, ERPC_ONEWAY_CREDITS), kErpcStatus_Busy);
+
+    // Server returns credit after each half of the window.
+    startServer();
+    ASSERT_TRUE(testWaitFor([&] { return m_service.getOnewayCount() == ERPC_ONEWAY_CREDITS; }));
+    ASSERT_TRUE(testWaitFor([&] { return m_clientTransport.hasMessage(); }));
+    for (uint32_t i = 0U; i < ERPC_ONEWAY_CREDITS; ++i)
+    {
+        EXPECT_EQ(testSendOneway(&m_client, i), kErpcStatus_Success);
+    }
+    ASSERT_TRUE(testWaitFor([&] { return m_service.getOnewayCount() == (2U * ERPC_ONEWAY_CREDITS); }));
+}
+
+TEST_F(OnewayCreditsTest, BlockingClientIsRefilled)
+{
+    const uint32_t count = 8U * ERPC_ONEWAY_CREDITS;
+    uint32_t result = 0U;
+
+    startServer();
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        ASSERT_EQ(testSendOneway(&m_client, i), kErpcStatus_Success);
+    }
+
+    // Credit messages waiting ahead of the reply are absorbed by the client.
+    EXPECT_EQ(testCallAddOne(&m_client, 41U, &result), kErpcStatus_Success);
+    EXPECT_EQ(result, 42U);
+    EXPECT_EQ(m_service.getOnewayCount(), count);
+    EXPECT_FALSE(m_clientTransport.hasMessage());
+}
+
+TEST_F(OnewayCreditsTest, ClientWithoutCreditsGetsNoCredit)
+{
+    const uint32_t count = 8U * ERPC_ONEWAY_CREDITS;
+    uint32_t result = 0U;
+
+    startServer();
+
+    // Plain oneway messages, as sent by clients which never read credit messages (e.g. Python client).
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        m_serverTransport.pushMessage(
+            testEncodeMessage(message_type_t::kOnewayMessage, TEST_SERVICE_ID, TEST_METHOD_ONEWAY, i, i));
+    }
+    ASSERT_TRUE(testWaitFor([&] { return m_service.getOnewayCount() == count; }));
+    EXPECT_FALSE(m_clientTransport.hasMessage());
+
+    // Client with credits sharing the server is refilled as usual.
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        ASSERT_EQ(testSendOneway(&m_client, i), kErpcStatus_Success);
+    }
+    ASSERT_TRUE(testWaitFor([&] { return m_service.getOnewayCount() == (2U * count); }));
+    EXPECT_TRUE(m_clientTransport.hasMessage());
+    EXPECT_EQ(testCallAddOne(&m_client, 41U, &result), kErpcStatus_Success);
+    EXPECT_EQ(result, 42U);
+}
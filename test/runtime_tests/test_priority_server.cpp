@@ -0,0 +1,363 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_priority_server.hpp"
+#include "erpc_server_setup.h"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+#include <thread>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Argument making the service wait until the test opens the gate.
+#define TEST_PRIORITY_BLOCK_VALUE (0xB10CU)
+
+//! @brief Stack size of workers which is not clamped by the system.
+#define TEST_PRIORITY_WORKER_STACK_SIZE (256U * 1024U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Service whose method id is the priority of the method. Each method replies with its argument plus one.
+ */
+class PriorityTestService : public Service
+{
+public:
+    PriorityTestService(void) : Service(TEST_SERVICE_ID), m_gateOpen(false) {}
+
+    virtual uint32_t getMethodPriority(uint32_t methodId) const override { return methodId; }
+
+    virtual erpc_status_t handleInvocation(uint32_t methodId, uint32_t sequence, Codec *codec,
+                                           MessageBufferFactory *messageFactory, Transport *transport) override
+    {
+        erpc_status_t err;
+        uint32_t value = 0;
+
+        codec->read(value);
+        err = codec->getStatus();
+        if (err == kErpcStatus_Success)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_handled.push_back(value);
+                m_condition.notify_all();
+                if (value == TEST_PRIORITY_BLOCK_VALUE)
+                {
+                    m_condition.wait(lock, [this] { return m_gateOpen; });
+                }
+            }
+
+            err = messageFactory->prepareServerBufferForSend(codec->getBufferRef(), transport->reserveHeaderSize());
+            if (err == kErpcStatus_Success)
+            {
+                codec->reset(transport->reserveHeaderSize());
+                codec->startWriteMessage(message_type_t::kReplyMessage, m_serviceId, methodId, sequence);
+                codec->write(value + 1U);
+                err = codec->getStatus();
+            }
+        }
+
+        return err;
+    }
+
+    //! @brief Let blocked invocations finish.
+    void openGate(void)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_gateOpen = true;
+        m_condition.notify_all();
+    }
+
+    //! @brief Wait until the worker blocks in the service.
+    bool waitForBlocked(void)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_condition.wait_for(lock, std::chrono::seconds(5), [this] {
+            return (!m_handled.empty()) && (m_handled.back() == TEST_PRIORITY_BLOCK_VALUE);
+        });
+    }
+
+    //! @brief Return arguments in order of handling.
+    std::vector<uint32_t> getHandled(void)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_handled;
+    }
+
+protected:
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::vector<uint32_t> m_handled;
+    bool m_gateOpen;
+};
+
+/*!
+ * @brief Service recording CPUs and stack size of the worker which handles invocation.
+ */
+class WorkerProbeService : public PriorityTestService
+{
+public:
+    virtual erpc_status_t handleInvocation(uint32_t methodId, uint32_t sequence, Codec *codec,
+                                           MessageBufferFactory *messageFactory, Transport *transport) override
+    {
+        pthread_attr_t attr;
+        cpu_set_t set;
+
+        CPU_ZERO(&set);
+        (void)pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+        m_cpuSet = set;
+        (void)pthread_getattr_np(pthread_self(), &attr);
+        (void)pthread_attr_getstacksize(&attr, &m_stackSize);
+        (void)pthread_attr_destroy(&attr);
+
+        return PriorityTestService::handleInvocation(methodId, sequence, codec, messageFactory, transport);
+    }
+
+    cpu_set_t m_cpuSet = {};
+    size_t m_stackSize = 0U;
+};
+
+/*!
+ * @brief Priority server exposing the count of its space semaphore.
+ */
+class TestPriorityServer : public PriorityServer
+{
+public:
+    int getSpaceCount(void) const { return m_spaceSem.getCount(); }
+};
+
+/*!
+ * @brief Priority server with one worker, receiving from queue transport on its own thread.
+ */
+class PriorityServerTest : public ::testing::Test
+{
+protected:
+    TestQueueTransport m_transport;
+    TestMessageBufferFactory m_messageFactory;
+    BasicCodecFactory m_codecFactory;
+    PriorityTestService m_service;
+    TestPriorityServer m_server;
+    std::thread m_receiver;
+    uint32_t m_sequence = 0U;
+
+    virtual void SetUp(void) override
+    {
+        m_server.setTransport(&m_transport);
+        m_server.setCodecFactory(&m_codecFactory);
+        m_server.setMessageBufferFactory(&m_messageFactory);
+        m_server.addService(&m_service);
+        ASSERT_EQ(m_server.setWorkers(1U, 0U), kErpcStatus_Success);
+        m_receiver = std::thread([this] { (void)m_server.run(); });
+    }
+
+    virtual void TearDown(void) override
+    {
+        m_service.openGate();
+        m_server.stop();
+        m_transport.close();
+        m_receiver.join();
+    }
+
+    void invoke(uint32_t priority, uint32_t value, message_type_t type = message_type_t::kInvocationMessage)
+    {
+        m_transport.pushMessage(testEncodeMessage(type, TEST_SERVICE_ID, priority, ++m_sequence, value));
+    }
+
+    //! @brief Occupy the only worker with a blocked request.
+    void blockWorker(message_type_t type = message_type_t::kInvocationMessage)
+    {
+        invoke(0U, TEST_PRIORITY_BLOCK_VALUE, type);
+        ASSERT_TRUE(m_service.waitForBlocked());
+    }
+
+    //! @brief Check replies, they must answer the arguments in order of handling.
+    void expectReplies(size_t count)
+    {
+        std::vector<uint32_t> handled;
+        std::vector<uint8_t> reply;
+        message_type_t type;
+        uint32_t methodId;
+        uint32_t sequence;
+        uint32_t value;
+
+        ASSERT_TRUE(testWaitFor([&] { return m_transport.getSentCount() == count; }));
+        handled = m_service.getHandled();
+        ASSERT_EQ(handled.size(), count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ASSERT_TRUE(m_transport.popSent(&reply));
+            ASSERT_TRUE(testDecodeMessage(reply, &type, &methodId, &sequence, &value));
+            EXPECT_EQ(type, message_type_t::kReplyMessage);
+            EXPECT_EQ(value, handled[i] + 1U);
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(PriorityServerTest, MostUrgentServedFirst)
+{
+    blockWorker();
+    for (uint32_t priority = 0U; priority < ERPC_PRIORITY_LEVELS; ++priority)
+    {
+        invoke(priority, 10U + priority);
+    }
+    ASSERT_TRUE(m_transport.waitForReceiver(ERPC_PRIORITY_LEVELS + 2U));
+
+    m_service.openGate();
+    expectReplies(ERPC_PRIORITY_LEVELS + 1U);
+    EXPECT_EQ(m_service.getHandled(), (std::vector<uint32_t>{ TEST_PRIORITY_BLOCK_VALUE, 13U, 12U, 11U, 10U }));
+}
+
+TEST_F(PriorityServerTest, OvertakenRequestAges)
+{
+    // Low priority request overtaken ERPC_PRIORITY_AGING_LIMIT (2) times goes before the next urgent one.
+    blockWorker();
+    invoke(3U, 21U);
+    invoke(3U, 22U);
+    invoke(0U, 30U);
+    invoke(3U, 23U);
+    ASSERT_TRUE(m_transport.waitForReceiver(6U));
+
+    m_service.openGate();
+    expectReplies(5U);
+    EXPECT_EQ(m_service.getHandled(), (std::vector<uint32_t>{ TEST_PRIORITY_BLOCK_VALUE, 21U, 22U, 30U, 23U }));
+}
+
+TEST_F(PriorityServerTest, FullQueueStallsReceiver)
+{
+    const uint32_t count = ERPC_PRIORITY_QUEUE_SIZE + 2U;
+    std::vector<uint32_t> expected{ TEST_PRIORITY_BLOCK_VALUE };
+
+    blockWorker();
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        invoke(1U, 40U + i);
+        expected.push_back(40U + i);
+    }
+
+    // Queue holds ERPC_PRIORITY_QUEUE_SIZE requests, receiver holds the next one and waits for space.
+    ASSERT_TRUE(testWaitFor([&] { return m_transport.getReceiveCalls() == (ERPC_PRIORITY_QUEUE_SIZE + 2U); }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(m_transport.getReceiveCalls(), ERPC_PRIORITY_QUEUE_SIZE + 2U);
+    EXPECT_EQ(m_server.getSpaceCount(), 0);
+
+    m_service.openGate();
+    expectReplies(count + 1U);
+    EXPECT_EQ(m_service.getHandled(), expected);
+    ASSERT_TRUE(m_transport.waitForReceiver(count + 2U));
+
+    // Workers signal space only to a waiting receiver, so the semaphore does not count up.
+    EXPECT_EQ(m_server.getSpaceCount(), 0);
+    invoke(2U, 50U);
+    invoke(2U, 51U);
+    ASSERT_TRUE(m_transport.waitForReceiver(count + 4U));
+    ASSERT_TRUE(testWaitFor([&] { return m_transport.getSentCount() == 2U; }));
+    EXPECT_EQ(m_server.getSpaceCount(), 0);
+}
+
+TEST_F(PriorityServerTest, ClientGetsBusyOverAdmissionLimit)
+{
+    TestQueueTransport clientTransport;
+    TestMessageBufferFactory messageFactory;
+    BasicCodecFactory codecFactory;
+    ClientManager client;
+    erpc_server_t server = reinterpret_cast<erpc_server_t>(static_cast<SimpleServer *>(&m_server));
+    uint32_t busy;
+    uint32_t dropped;
+    uint32_t result = 0U;
+
+    clientTransport.setPeer(&m_transport);
+    m_transport.setPeer(&clientTransport);
+    client.setTransport(&clientTransport);
+    client.setCodecFactory(&codecFactory);
+    client.setMessageBufferFactory(&messageFactory);
+
+    // Blocked oneway request fills the admission limit without a reply to the client.
+    m_server.setAdmissionLimit(1U);
+    blockWorker(message_type_t::kOnewayMessage);
+
+    EXPECT_EQ(testCallAddOne(&client, 5U, &result), kErpcStatus_Busy);
+    EXPECT_EQ(testSendOneway(&client, 6U), kErpcStatus_Success);
+    ASSERT_TRUE(m_transport.waitForReceiver(4U));
+
+    erpc_priority_server_get_shed_counts(server, &busy, &dropped);
+    EXPECT_EQ(busy, 1U);
+    EXPECT_EQ(dropped, 1U);
+
+    // Requests are admitted again once the worker finishes the blocked one.
+    m_service.openGate();
+    ASSERT_TRUE(testWaitFor([&] { return testCallAddOne(&client, 7U, &result) == kErpcStatus_Success; }));
+    EXPECT_EQ(result, 8U);
+    EXPECT_EQ(m_service.getHandled(), (std::vector<uint32_t>{ TEST_PRIORITY_BLOCK_VALUE, 7U }));
+}
+
+TEST(PriorityServerWorkers, AttributesApplyToWorkers)
+{
+    TestQueueTransport transport;
+    TestMessageBufferFactory messageFactory;
+    BasicCodecFactory codecFactory;
+    WorkerProbeService service;
+    TestPriorityServer server;
+    std::thread receiver;
+    cpu_set_t processSet;
+    uint32_t cpu = 0U;
+
+    CPU_ZERO(&processSet);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(processSet), &processSet), 0);
+    while ((cpu < 32U) && !CPU_ISSET(cpu, &processSet))
+    {
+        ++cpu;
+    }
+    ASSERT_LT(cpu, 32U);
+
+    server.setTransport(&transport);
+    server.setCodecFactory(&codecFactory);
+    server.setMessageBufferFactory(&messageFactory);
+    server.addService(&service);
+    ASSERT_EQ(server.setWorkers(1U, 0U), kErpcStatus_Success);
+    ASSERT_EQ(server.setWorkerAttributes(0U, TEST_PRIORITY_WORKER_STACK_SIZE, 1U << cpu), kErpcStatus_Success);
+    receiver = std::thread([&server] { (void)server.run(); });
+
+    transport.pushMessage(testEncodeMessage(message_type_t::kInvocationMessage, TEST_SERVICE_ID, 0U, 1U, 1U));
+    EXPECT_TRUE(testWaitFor([&] { return transport.getSentCount() == 1U; }));
+
+    // Worker runs only on the selected CPU with the requested stack.
+    EXPECT_EQ(CPU_COUNT(&service.m_cpuSet), 1);
+    EXPECT_TRUE(CPU_ISSET(cpu, &service.m_cpuSet));
+    EXPECT_GE(service.m_stackSize, TEST_PRIORITY_WORKER_STACK_SIZE);
+    EXPECT_LT(service.m_stackSize, 2U * TEST_PRIORITY_WORKER_STACK_SIZE);
+
+    // Running workers keep their attributes.
+    EXPECT_EQ(server.setWorkerAttributes(0U, 0U, 0U), kErpcStatus_InvalidArgument);
+
+    server.stop();
+    transport.close();
+    receiver.join();
+}
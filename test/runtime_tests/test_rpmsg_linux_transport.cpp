@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_rpmsg_linux_transport.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <thread>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(RPMsgLinuxTransport, NotificationFdIsDrained)
+{
+    RPMsgEndpoint endpoint;
+    RPMsgLinuxTransport transport(&endpoint, RPMsgEndpoint::kRemoteDefaultAddress);
+    uint8_t data[64];
+    MessageBuffer message(data, sizeof(data));
+    uint32_t calls;
+
+    ASSERT_EQ(transport.init(), kErpcStatus_Success);
+    transport.setReceiveFd(endpoint.getEventFd(), true);
+
+    // Two messages signalled before the first receive, both are received.
+    endpoint.push({ 1U, 2U, 3U });
+    endpoint.push({ 4U });
+    ASSERT_EQ(transport.receive(&message), kErpcStatus_Success);
+    EXPECT_EQ(message.getUsed(), 3U);
+    ASSERT_EQ(transport.receive(&message), kErpcStatus_Success);
+    EXPECT_EQ(message.getUsed(), 1U);
+    EXPECT_EQ(data[0], 4U);
+
+    // Receiver sleeps while nothing is queued instead of polling the endpoint again and again.
+    std::thread receiver([&] {
+        uint8_t buffer[64];
+        MessageBuffer received(buffer, sizeof(buffer));
+        EXPECT_EQ(transport.receive(&received), kErpcStatus_Success);
+        EXPECT_EQ(received.getUsed(), 2U);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    calls = endpoint.getReceiveCalls();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(endpoint.getReceiveCalls(), calls);
+
+    endpoint.push({ 5U, 6U });
+    receiver.join();
+}
+
+TEST(RPMsgLinuxTransport, BusyPollReceivesWithoutSleeping)
+{
+    RPMsgEndpoint endpoint;
+    RPMsgLinuxTransport transport(&endpoint, RPMsgEndpoint::kRemoteDefaultAddress);
+    uint8_t data[64];
+    MessageBuffer message(data, sizeof(data));
+    erpc_transport_stats_t stats;
+
+    ASSERT_EQ(transport.init(), kErpcStatus_Success);
+    transport.setReceiveFd(endpoint.getEventFd(), true);
+    transport.setBusyPoll(1000000U);
+
+    std::thread sender([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        endpoint.push({ 7U });
+    });
+    ASSERT_EQ(transport.receive(&message), kErpcStatus_Success);
+    sender.join();
+    EXPECT_EQ(data[0], 7U);
+
+    // Message arrived within the busy poll window, receiver did not wait on the descriptor.
+    transport.getStats(&stats);
+    EXPECT_EQ(stats.wouldBlock, 0U);
+}
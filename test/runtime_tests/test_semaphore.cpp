@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_threading.h"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_SEMAPHORE_WAITERS (8U)
+#define TEST_SEMAPHORE_GETS (2000U)
+#define TEST_SEMAPHORE_TIMEOUT_US (50000U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(Semaphore, PutWakesWaiter)
+{
+    Semaphore semaphore;
+    std::atomic<bool> taken(false);
+    std::thread waiter([&] {
+        EXPECT_TRUE(semaphore.get());
+        taken = true;
+    });
+
+    // Waiter sleeps in the kernel, nothing wakes it but put().
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(taken);
+
+    semaphore.put();
+    EXPECT_TRUE(testWaitFor([&] { return taken.load(); }));
+    waiter.join();
+    EXPECT_EQ(semaphore.getCount(), 0);
+}
+
+TEST(Semaphore, TimedWaitExpires)
+{
+    Semaphore semaphore;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::duration elapsed;
+
+    EXPECT_FALSE(semaphore.get(TEST_SEMAPHORE_TIMEOUT_US));
+    elapsed = std::chrono::steady_clock::now() - start;
+
+    // Deadline is taken from CLOCK_MONOTONIC, the same clock as steady_clock.
+    EXPECT_GE(elapsed, std::chrono::microseconds(TEST_SEMAPHORE_TIMEOUT_US));
+    EXPECT_LT(elapsed, std::chrono::seconds(2));
+    EXPECT_EQ(semaphore.getCount(), 0);
+}
+
+TEST(Semaphore, TimedWaitTakesLatePut)
+{
+    Semaphore semaphore;
+    std::thread putter([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        semaphore.put();
+    });
+
+    EXPECT_TRUE(semaphore.get(5000000U));
+    putter.join();
+    EXPECT_EQ(semaphore.getCount(), 0);
+}
+
+TEST(Semaphore, GetWithoutTimeoutDoesNotBlock)
+{
+    Semaphore semaphore;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // Empty semaphore used to loop forever here.
+    EXPECT_FALSE(semaphore.get(0U));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+    semaphore.put();
+    EXPECT_TRUE(semaphore.get(0U));
+    EXPECT_FALSE(semaphore.get(0U));
+}
+
+TEST(Semaphore, ManyWaitersTakeAllPuts)
+{
+    Semaphore semaphore;
+    std::vector<std::thread> waiters;
+    std::vector<std::thread> putters;
+    std::atomic<uint32_t> taken(0U);
+
+    for (uint32_t i = 0; i < TEST_SEMAPHORE_WAITERS; ++i)
+    {
+        waiters.emplace_back([&] {
+            for (uint32_t j = 0; j < TEST_SEMAPHORE_GETS; ++j)
+            {
+                // Lost wake up would leave a waiter sleeping until the timeout.
+                if (semaphore.get(5000000U))
+                {
+                    ++taken;
+                }
+            }
+        });
+    }
+    for (uint32_t i = 0; i < 2U; ++i)
+    {
+        putters.emplace_back([&] {
+            for (uint32_t j = 0; j < (TEST_SEMAPHORE_WAITERS * TEST_SEMAPHORE_GETS) / 2U; ++j)
+            {
+                semaphore.put();
+            }
+        });
+    }
+
+    for (std::thread &putter : putters)
+    {
+        putter.join();
+    }
+    for (std::thread &waiter : waiters)
+    {
+        waiter.join();
+    }
+
+    EXPECT_EQ(taken, TEST_SEMAPHORE_WAITERS * TEST_SEMAPHORE_GETS);
+    EXPECT_EQ(semaphore.getCount(), 0);
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_crc16.hpp"
+#include "erpc_serial_transport.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Receive timeout of the tests in milliseconds.
+#define TEST_SERIAL_TIMEOUT_MS (50)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Serial transport on the slave side of a pseudo terminal, the test writes to the master side.
+ */
+class SerialTransportTest : public ::testing::Test
+{
+protected:
+    int m_master = -1;
+    Crc16 m_crc16;
+    SerialTransport *m_transport = NULL;
+    uint8_t m_data[512];
+    MessageBuffer m_message{ m_data, sizeof(m_data) };
+
+    virtual void SetUp(void) override
+    {
+        m_master = posix_openpt(O_RDWR | O_NOCTTY);
+        ASSERT_GE(m_master, 0);
+        ASSERT_EQ(grantpt(m_master), 0);
+        ASSERT_EQ(unlockpt(m_master), 0);
+
+        m_transport = new SerialTransport(ptsname(m_master), 115200);
+        ASSERT_EQ(m_transport->init(0U, 1U), kErpcStatus_Success);
+        m_transport->setCrc16(&m_crc16);
+        m_transport->setReadTimeout(TEST_SERIAL_TIMEOUT_MS);
+    }
+
+    virtual void TearDown(void) override
+    {
+        delete m_transport;
+        (void)close(m_master);
+    }
+
+    //! @brief Build frame the way FramedTransport sends it.
+    std::vector<uint8_t> makeFrame(const std::vector<uint8_t> &payload)
+    {
+        uint16_t size = (uint16_t)payload.size();
+        uint16_t crcBody = m_crc16.computeCRC16(payload.data(), size);
+        uint16_t crcHeader = m_crc16.computeCRC16(reinterpret_cast<uint8_t *>(&size), sizeof(size)) +
+                             m_crc16.computeCRC16(reinterpret_cast<uint8_t *>(&crcBody), sizeof(crcBody));
+        std::vector<uint8_t> frame(sizeof(FramedTransport::Header));
+
+        (void)memcpy(&frame[0], &crcHeader, sizeof(crcHeader));
+        (void)memcpy(&frame[2], &size, sizeof(size));
+        (void)memcpy(&frame[4], &crcBody, sizeof(crcBody));
+        frame.insert(frame.end(), payload.begin(), payload.end());
+
+        return frame;
+    }
+
+    void writeMaster(const uint8_t *data, size_t size) { ASSERT_EQ(write(m_master, data, size), (ssize_t)size); }
+
+    void writeMaster(const std::vector<uint8_t> &data) { writeMaster(data.data(), data.size()); }
+
+    //! @brief Receive message and compare it with the payload.
+    void expectMessage(const std::vector<uint8_t> &payload)
+    {
+        const uint8_t headerSize = m_transport->reserveHeaderSize();
+
+        ASSERT_EQ(m_transport->receive(&m_message), kErpcStatus_Success);
+        ASSERT_EQ(m_message.getUsed(), headerSize + payload.size());
+        EXPECT_EQ(memcmp(&m_data[headerSize], payload.data(), payload.size()), 0);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(SerialTransportTest, ResynchronizesAfterTimeoutInBody)
+{
+    std::vector<uint8_t> broken = makeFrame(std::vector<uint8_t>(40U, 0x11U));
+    std::vector<uint8_t> payload{ 1U, 2U, 3U, 4U, 5U };
+    erpc_transport_stats_t stats;
+
+    // Body stops in the middle.
+    writeMaster(broken.data(), 20U);
+    EXPECT_EQ(m_transport->receive(&m_message), kErpcStatus_Timeout);
+
+    // Late rest of the broken frame is skipped, the next frame is received.
+    writeMaster(&broken[20], broken.size() - 20U);
+    writeMaster(makeFrame(payload));
+    expectMessage(payload);
+
+    m_transport->getStats(&stats);
+    EXPECT_EQ(stats.framingErrors, 1U);
+}
+
+TEST_F(SerialTransportTest, PartialHeaderIsKept)
+{
+    std::vector<uint8_t> payload{ 9U, 8U, 7U };
+    std::vector<uint8_t> frame = makeFrame(payload);
+
+    writeMaster(frame.data(), 3U);
+    EXPECT_EQ(m_transport->receive(&m_message), kErpcStatus_Timeout);
+
+    writeMaster(&frame[3], frame.size() - 3U);
+    expectMessage(payload);
+}
+
+TEST_F(SerialTransportTest, NoiseBeforeFrameIsSkipped)
+{
+    std::vector<uint8_t> noise{ 0xFFU, 0x00U, 0x55U, 0xAAU, 0x01U, 0x02U, 0x03U };
+    std::vector<uint8_t> first{ 0x10U, 0x20U };
+    std::vector<uint8_t> second(300U, 0x42U);
+
+    writeMaster(noise);
+    writeMaster(makeFrame(first));
+    writeMaster(makeFrame(second));
+
+    // Message longer than the receive buffer follows, it is read directly.
+    expectMessage(first);
+    expectMessage(second);
+}
+
+TEST_F(SerialTransportTest, SentFrameReachesPeer)
+{
+    std::vector<uint8_t> payload{ 0xA5U, 0x5AU, 0x00U, 0xFFU };
+    std::vector<uint8_t> expected = makeFrame(payload);
+    std::vector<uint8_t> received(expected.size());
+    const uint8_t headerSize = m_transport->reserveHeaderSize();
+    size_t length = 0U;
+    ssize_t ret;
+
+    (void)memcpy(&m_data[headerSize], payload.data(), payload.size());
+    m_message.setUsed(headerSize + payload.size());
+    ASSERT_EQ(m_transport->send(&m_message), kErpcStatus_Success);
+
+    while (length < received.size())
+    {
+        ret = read(m_master, &received[length], received.size() - length);
+        ASSERT_GT(ret, 0);
+        length += (size_t)ret;
+    }
+    EXPECT_EQ(received, expected);
+}
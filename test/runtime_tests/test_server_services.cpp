@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "erpc_simple_server.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Service ID above 8 bits, looked up outside the service table.
+#define TEST_SERVICE_ID_LARGE (0x12345U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Server exposing the lookup of services it dispatches requests to.
+ */
+class ServiceLookupServer : public SimpleServer
+{
+public:
+    Service *find(uint32_t serviceId) { return findServiceWithId(serviceId); }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(ServerServices, LookupFindsServiceById)
+{
+    ServiceLookupServer server;
+    TestService first(1U);
+    TestService second(2U);
+    TestService last(255U);
+
+    server.addService(&first);
+    server.addService(&second);
+    server.addService(&last);
+
+    EXPECT_EQ(server.find(1U), &first);
+    EXPECT_EQ(server.find(2U), &second);
+    EXPECT_EQ(server.find(255U), &last);
+    EXPECT_EQ(server.find(0U), nullptr);
+    EXPECT_EQ(server.find(3U), nullptr);
+
+    server.removeService(&second);
+    EXPECT_EQ(server.find(1U), &first);
+    EXPECT_EQ(server.find(2U), nullptr);
+    EXPECT_EQ(server.find(255U), &last);
+}
+
+TEST(ServerServices, FirstRegistrationOfIdWins)
+{
+    ServiceLookupServer server;
+    TestService winner(5U);
+    TestService other(5U);
+
+    server.addService(&winner);
+    server.addService(&other);
+    EXPECT_EQ(server.find(5U), &winner);
+
+    // Removing the service which is not served changes nothing.
+    server.removeService(&other);
+    EXPECT_EQ(server.find(5U), &winner);
+}
+
+TEST(ServerServices, RemovingWinnerLetsOtherTakeOver)
+{
+    ServiceLookupServer server;
+    TestService unrelated(4U);
+    TestService winner(5U);
+    TestService other(5U);
+
+    server.addService(&winner);
+    server.addService(&unrelated);
+    server.addService(&other);
+
+    server.removeService(&winner);
+    EXPECT_EQ(server.find(5U), &other);
+    EXPECT_EQ(server.find(4U), &unrelated);
+
+    server.removeService(&other);
+    EXPECT_EQ(server.find(5U), nullptr);
+    EXPECT_EQ(server.find(4U), &unrelated);
+}
+
+TEST(ServerServices, IdsOutsideTableAreFound)
+{
+    ServiceLookupServer server;
+    TestService above(256U);
+    TestService large(TEST_SERVICE_ID_LARGE);
+    TestService other(TEST_SERVICE_ID_LARGE);
+
+    server.addService(&above);
+    server.addService(&large);
+    server.addService(&other);
+
+    EXPECT_EQ(server.find(256U), &above);
+    EXPECT_EQ(server.find(TEST_SERVICE_ID_LARGE), &large);
+    EXPECT_EQ(server.find(TEST_SERVICE_ID_LARGE + 1U), nullptr);
+    // Table slot of the truncated ID stays empty.
+    EXPECT_EQ(server.find(TEST_SERVICE_ID_LARGE & 0xFFU), nullptr);
+
+    server.removeService(&large);
+    EXPECT_EQ(server.find(TEST_SERVICE_ID_LARGE), &other);
+    server.removeService(&above);
+    EXPECT_EQ(server.find(256U), nullptr);
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_shm_transport.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Smallest ring, so messages wrap around often.
+#define TEST_SHM_RING_SIZE (256U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Shared memory transport able to publish raw frames.
+ */
+class TestShmTransport : public ShmTransport
+{
+public:
+    TestShmTransport(const char *name, bool isServer) : ShmTransport(name, TEST_SHM_RING_SIZE, isServer) {}
+
+    /*!
+     * @brief Publish frame header without checks done by send().
+     *
+     * @param[in] length Length field of the frame.
+     * @param[in] published Count of bytes to publish.
+     */
+    void publishRawFrame(uint32_t length, uint32_t published)
+    {
+        uint32_t head = m_txControl->head;
+
+        (void)memcpy(&m_txData[head & (m_ringSize - 1U)], &length, sizeof(length));
+        __atomic_store_n(&m_txControl->head, head + published, __ATOMIC_SEQ_CST);
+    }
+};
+
+/*!
+ * @brief Server and client transport sharing one object.
+ */
+class ShmTransportTest : public ::testing::Test
+{
+protected:
+    std::string m_name;
+    TestShmTransport *m_server;
+    TestShmTransport *m_client;
+
+    virtual void SetUp(void) override
+    {
+        m_name = "/erpc_runtime_test_" + std::to_string(getpid());
+        m_server = new TestShmTransport(m_name.c_str(), true);
+        m_client = new TestShmTransport(m_name.c_str(), false);
+        ASSERT_EQ(m_server->open(), kErpcStatus_Success);
+        ASSERT_EQ(m_client->open(), kErpcStatus_Success);
+    }
+
+    virtual void TearDown(void) override
+    {
+        delete m_client;
+        delete m_server;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(ShmTransportTest, RoundTripWrapsAround)
+{
+    const uint32_t count = 200U;
+    std::thread echo([this, count] {
+        uint8_t data[128];
+        MessageBuffer buffer(data, sizeof(data));
+
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+            ASSERT_EQ(m_server->receive(&buffer), kErpcStatus_Success);
+            for (uint16_t j = 0U; j < buffer.getUsed(); ++j)
+            {
+                data[j] ^= 0xFFU;
+            }
+            ASSERT_EQ(m_server->send(&buffer), kErpcStatus_Success);
+        }
+    });
+    uint8_t sent[128];
+    uint8_t received[128];
+    MessageBuffer sendBuffer(sent, sizeof(sent));
+    MessageBuffer receiveBuffer(received, sizeof(received));
+
+    // Lengths not dividing the ring size move frames over its end in many positions.
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+        uint16_t length = (uint16_t)(1U + ((i * 37U) % 100U));
+
+        for (uint16_t j = 0U; j < length; ++j)
+        {
+            sent[j] = (uint8_t)(i + j);
+        }
+        sendBuffer.setUsed(length);
+        ASSERT_EQ(m_client->send(&sendBuffer), kErpcStatus_Success);
+        ASSERT_EQ(m_client->receive(&receiveBuffer), kErpcStatus_Success);
+        ASSERT_EQ(receiveBuffer.getUsed(), length);
+        for (uint16_t j = 0U; j < length; ++j)
+        {
+            ASSERT_EQ(received[j], (uint8_t)~sent[j]);
+        }
+    }
+
+    echo.join();
+}
+
+TEST_F(ShmTransportTest, FrameOutsideRingIsRejected)
+{
+    uint8_t data[1024];
+    MessageBuffer buffer(data, sizeof(data));
+
+    m_client->publishRawFrame(TEST_SHM_RING_SIZE, 8U);
+
+    EXPECT_EQ(m_server->receive(&buffer), kErpcStatus_ConnectionFailure);
+    buffer.setUsed(4U);
+    EXPECT_EQ(m_client->send(&buffer), kErpcStatus_ConnectionClosed);
+}
+
+TEST_F(ShmTransportTest, FrameBeyondPublishedDataIsRejected)
+{
+    uint8_t data[1024];
+    MessageBuffer buffer(data, sizeof(data));
+
+    m_client->publishRawFrame(100U, 8U);
+
+    EXPECT_EQ(m_server->receive(&buffer), kErpcStatus_ConnectionFailure);
+}
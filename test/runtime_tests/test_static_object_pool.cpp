@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_manually_constructed.hpp"
+
+#include "gtest.h"
+
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Count of objects of tested pool.
+#define POOL_OBJECTS (8U)
+
+//! @brief Count of threads creating and destroying objects at the same time.
+#define POOL_THREADS (4U)
+
+//! @brief Count of create and destroy rounds of each thread.
+#define POOL_ROUNDS (50000U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Object of tested pool remembering its creator.
+ */
+class PoolItem
+{
+public:
+    explicit PoolItem(uint32_t owner) : m_owner(owner) {}
+
+    uint32_t m_owner; /*!< Thread which created the object. */
+};
+
+/*!
+ * @brief Pool with access to its storage, so tests can check which slot an object uses.
+ */
+class TestObjectPool : public StaticObjectPool<PoolItem, POOL_OBJECTS>
+{
+public:
+    using StaticObjectPool<PoolItem, POOL_OBJECTS>::head_t;
+
+    /*!
+     * @brief Return slot of object.
+     */
+    uint32_t getIndex(const PoolItem *item) const
+    {
+        for (uint32_t index = 0U; index < POOL_OBJECTS; ++index)
+        {
+            if (m_objects[index].get() == item)
+            {
+                return index;
+            }
+        }
+        return POOL_OBJECTS;
+    }
+
+    /*!
+     * @brief Read free list head like take() does before its compare and swap.
+     */
+    void readHead(head_t *head, uint32_t *next) const
+    {
+        *head = __atomic_load_n(&m_freeHead, __ATOMIC_ACQUIRE);
+        *next = m_next[static_cast<uint32_t>(*head & kIndexMask) - 1U];
+    }
+
+    /*!
+     * @brief Finish take() of a thread which read the head earlier.
+     *
+     * @return True when the stale head was swapped in.
+     */
+    bool swapHead(head_t head, uint32_t next)
+    {
+        return __atomic_compare_exchange_n(&m_freeHead, &head, ((head + kTagIncrement) & ~kIndexMask) | next, false,
+                                           __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(StaticObjectPoolTest, ExhaustedPoolReturnsNull)
+{
+    static TestObjectPool pool;
+    std::set<PoolItem *> items;
+    PoolItem *item;
+
+    for (uint32_t i = 0U; i < POOL_OBJECTS; ++i)
+    {
+        item = pool.create(i);
+        ASSERT_NE(item, nullptr);
+        EXPECT_EQ(item->m_owner, i);
+        EXPECT_TRUE(items.insert(item).second);
+    }
+    EXPECT_EQ(pool.create(POOL_OBJECTS), nullptr);
+
+    // Destroyed slot is reused, foreign pointers are ignored.
+    item = *items.begin();
+    pool.destroy(item);
+    PoolItem foreign(0U);
+    pool.destroy(&foreign);
+    EXPECT_EQ(pool.create(POOL_OBJECTS), item);
+    EXPECT_EQ(pool.create(POOL_OBJECTS), nullptr);
+
+    for (PoolItem *used : items)
+    {
+        pool.destroy(used);
+    }
+}
+
+TEST(StaticObjectPoolTest, StaleHeadIsRejected)
+{
+    static TestObjectPool pool;
+    TestObjectPool::head_t head;
+    uint32_t next;
+    PoolItem *first = pool.create(0U);
+    PoolItem *second = pool.create(0U);
+
+    pool.destroy(second);
+    pool.destroy(first);
+
+    // Other threads take the first two objects and return the first one while a thread is preempted.
+    pool.readHead(&head, &next);
+    first = pool.create(1U);
+    second = pool.create(1U);
+    pool.destroy(first);
+
+    // Swapping in the stale head would hand out the second object twice.
+    EXPECT_FALSE(pool.swapHead(head, next));
+    pool.destroy(second);
+}
+
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+TEST(StaticObjectPoolTest, TagDoesNotWrapAfter16Bits)
+{
+    static TestObjectPool pool;
+    TestObjectPool::head_t head;
+    uint32_t next;
+    PoolItem *item = pool.create(0U);
+
+    pool.destroy(item);
+    pool.readHead(&head, &next);
+
+    // 65536 head updates leave the same object first, which wraps a 16-bit tag to the same head.
+    for (uint32_t i = 0U; i < 0x8000U; ++i)
+    {
+        pool.destroy(pool.create(1U));
+    }
+
+    EXPECT_FALSE(pool.swapHead(head, next));
+}
+#endif
+
+TEST(StaticObjectPoolTest, ConcurrentCreateAndDestroy)
+{
+    static TestObjectPool pool;
+    uint32_t slotUsers[POOL_OBJECTS] = {};
+    uint32_t conflicts = 0U;
+    uint32_t creates = 0U;
+    std::vector<std::thread> threads;
+    std::set<PoolItem *> items;
+    PoolItem *item;
+
+    for (uint32_t thread = 0U; thread < POOL_THREADS; ++thread)
+    {
+        threads.emplace_back([&, thread] {
+            PoolItem *held[2] = {};
+
+            // Each thread holds up to two objects, so the pool is never exhausted and the free list is busy.
+            for (uint32_t round = 0U; round < POOL_ROUNDS; ++round)
+            {
+                PoolItem *&slot = held[round & 1U];
+                uint32_t index;
+
+                if (slot != nullptr)
+                {
+                    index = pool.getIndex(slot);
+                    __atomic_store_n(&slotUsers[index], 0U, __ATOMIC_RELEASE);
+                    pool.destroy(slot);
+                }
+                slot = pool.create(thread);
+                if (slot == nullptr)
+                {
+                    (void)__atomic_add_fetch(&conflicts, 1U, __ATOMIC_RELAXED);
+                    continue;
+                }
+                (void)__atomic_add_fetch(&creates, 1U, __ATOMIC_RELAXED);
+
+                // A slot handed out twice would already have a user.
+                index = pool.getIndex(slot);
+                if ((index >= POOL_OBJECTS) || (slot->m_owner != thread) ||
+                    (__atomic_exchange_n(&slotUsers[index], thread + 1U, __ATOMIC_ACQ_REL) != 0U))
+                {
+                    (void)__atomic_add_fetch(&conflicts, 1U, __ATOMIC_RELAXED);
+                }
+            }
+
+            for (PoolItem *last : held)
+            {
+                if (last != nullptr)
+                {
+                    __atomic_store_n(&slotUsers[pool.getIndex(last)], 0U, __ATOMIC_RELEASE);
+                    pool.destroy(last);
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(conflicts, 0U);
+    EXPECT_EQ(creates, POOL_THREADS * POOL_ROUNDS);
+
+    // No slot was lost or linked twice.
+    for (uint32_t i = 0U; i < POOL_OBJECTS; ++i)
+    {
+        item = pool.create(i);
+        ASSERT_NE(item, nullptr);
+        EXPECT_TRUE(items.insert(item).second);
+    }
+    EXPECT_EQ(pool.create(POOL_OBJECTS), nullptr);
+}
+
+#if ERPC_ALLOCATION_POLICY == ERPC_ALLOCATION_POLICY_STATIC
+TEST(StaticObjectPoolTest, CodecsAreNotSharedBetweenThreads)
+{
+    BasicCodecFactory factory;
+    uint32_t conflicts = 0U;
+    std::vector<std::thread> threads;
+    std::set<Codec *> active;
+    std::mutex activeMutex;
+
+    for (uint32_t thread = 0U; thread < POOL_THREADS; ++thread)
+    {
+        threads.emplace_back([&] {
+            for (uint32_t round = 0U; round < (POOL_ROUNDS / 10U); ++round)
+            {
+                Codec *codec = factory.create();
+
+                // Pool is shared with servers of other tests, which may hold some codecs.
+                if (codec == NULL)
+                {
+                    continue;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(activeMutex);
+                    if (!active.insert(codec).second)
+                    {
+                        ++conflicts;
+                    }
+                }
+                {
+                    std::lock_guard<std::mutex> lock(activeMutex);
+                    (void)active.erase(codec);
+                }
+                factory.dispose(codec);
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(conflicts, 0U);
+}
+#endif
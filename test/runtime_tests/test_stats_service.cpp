@@ -0,0 +1,337 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_client_manager.h"
+#include "erpc_simple_server.hpp"
+#include "erpc_stats_service.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <thread>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Count of buckets of latency histogram, erpc_stats_latency_buckets of erpc_stats.erpc.
+#define erpc_stats_latency_buckets (8U)
+
+//! @brief eRPCMethodStats structure of erpc_stats.erpc.
+typedef struct eRPCMethodStats
+{
+    uint32_t serviceId;
+    uint32_t methodId;
+    uint32_t calls;
+    uint32_t errors;
+    uint32_t requestBytes;
+    uint32_t replyBytes;
+    uint32_t latency[erpc_stats_latency_buckets];
+} eRPCMethodStats;
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Client of eRPCStats interface of erpc_stats.erpc.
+ *
+ * Shims follow the C++ client code generated by erpcgen from erpc_stats.erpc, so that the test checks the wire
+ * format which generated clients use against StatsService.
+ */
+class eRPCStats_client
+{
+public:
+    static const uint8_t m_serviceId = 255;
+    static const uint8_t m_getMethodCountId = 1;
+    static const uint8_t m_getMethodStatsId = 2;
+    static const uint8_t m_getUntrackedCountId = 3;
+    static const uint8_t m_resetId = 4;
+
+    eRPCStats_client(ClientManager *manager) : m_clientManager(manager) {}
+
+    uint32_t getMethodCount(void);
+
+    bool getMethodStats(uint32_t index, eRPCMethodStats *stats);
+
+    uint32_t getUntrackedCount(void);
+
+    void reset(void);
+
+protected:
+    ClientManager *m_clientManager;
+
+    uint32_t readUint32Result(uint8_t methodId);
+};
+
+/*!
+ * @brief Simple server with a test service and the stats service, linked by queue transports to a client.
+ */
+class StatsServiceTest : public ::testing::Test
+{
+protected:
+    TestQueueTransport m_clientTransport;
+    TestQueueTransport m_serverTransport;
+    TestMessageBufferFactory m_messageFactory;
+    BasicCodecFactory m_codecFactory;
+    ClientManager m_client;
+    TestService m_service;
+    SimpleServer m_server;
+    StatsService m_statsService;
+    eRPCStats_client m_stats;
+    std::thread m_serverThread;
+
+    StatsServiceTest(void) : m_statsService(&m_server.getMetrics()), m_stats(&m_client) {}
+
+    virtual void SetUp(void) override
+    {
+        m_clientTransport.setPeer(&m_serverTransport);
+        m_serverTransport.setPeer(&m_clientTransport);
+        m_client.setTransport(&m_clientTransport);
+        m_client.setCodecFactory(&m_codecFactory);
+        m_client.setMessageBufferFactory(&m_messageFactory);
+        m_server.setTransport(&m_serverTransport);
+        m_server.setCodecFactory(&m_codecFactory);
+        m_server.setMessageBufferFactory(&m_messageFactory);
+        m_server.addService(&m_service);
+        m_server.addService(&m_statsService);
+        m_serverThread = std::thread([this] { (void)m_server.run(); });
+    }
+
+    virtual void TearDown(void) override
+    {
+        m_server.stop();
+        m_serverTransport.close();
+        if (m_serverThread.joinable())
+        {
+            m_serverThread.join();
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+static void read_eRPCMethodStats_struct(Codec *codec, eRPCMethodStats *data)
+{
+    if (NULL == data)
+    {
+        return;
+    }
+
+    codec->read(data->serviceId);
+
+    codec->read(data->methodId);
+
+    codec->read(data->calls);
+
+    codec->read(data->errors);
+
+    codec->read(data->requestBytes);
+
+    codec->read(data->replyBytes);
+
+    for (uint32_t arrayCount0 = 0U; arrayCount0 < erpc_stats_latency_buckets; ++arrayCount0)
+    {
+        codec->read(data->latency[arrayCount0]);
+    }
+}
+
+uint32_t eRPCStats_client::readUint32Result(uint8_t methodId)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    uint32_t result = 0U;
+
+    // Get a new request.
+    RequestContext request = m_clientManager->createRequest(false);
+
+    // Encode the request.
+    Codec *codec = request.getCodec();
+
+    if (codec == NULL)
+    {
+        err = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        codec->startWriteMessage(message_type_t::kInvocationMessage, m_serviceId, methodId, request.getSequence());
+
+        // Send message to server
+        // Codec status is checked inside this function.
+        m_clientManager->performRequest(request);
+
+        codec->read(result);
+
+        err = codec->getStatus();
+    }
+
+    // Dispose of the request.
+    m_clientManager->releaseRequest(request);
+
+    // Invoke error handler callback function
+    m_clientManager->callErrorHandler(err, methodId);
+
+    return result;
+}
+
+uint32_t eRPCStats_client::getMethodCount(void)
+{
+    return readUint32Result(m_getMethodCountId);
+}
+
+bool eRPCStats_client::getMethodStats(uint32_t index, eRPCMethodStats *stats)
+{
+    erpc_status_t err = kErpcStatus_Success;
+    bool result = false;
+
+    // Get a new request.
+    RequestContext request = m_clientManager->createRequest(false);
+
+    // Encode the request.
+    Codec *codec = request.getCodec();
+
+    if (codec == NULL)
+    {
+        err = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        codec->startWriteMessage(message_type_t::kInvocationMessage, m_serviceId, m_getMethodStatsId,
+                                 request.getSequence());
+
+        codec->write(index);
+
+        // Send message to server
+        // Codec status is checked inside this function.
+        m_clientManager->performRequest(request);
+
+        read_eRPCMethodStats_struct(codec, stats);
+
+        codec->read(result);
+
+        err = codec->getStatus();
+    }
+
+    // Dispose of the request.
+    m_clientManager->releaseRequest(request);
+
+    // Invoke error handler callback function
+    m_clientManager->callErrorHandler(err, m_getMethodStatsId);
+
+    return result;
+}
+
+uint32_t eRPCStats_client::getUntrackedCount(void)
+{
+    return readUint32Result(m_getUntrackedCountId);
+}
+
+void eRPCStats_client::reset(void)
+{
+    erpc_status_t err = kErpcStatus_Success;
+
+    // Get a new request.
+    RequestContext request = m_clientManager->createRequest(false);
+
+    // Encode the request.
+    Codec *codec = request.getCodec();
+
+    if (codec == NULL)
+    {
+        err = kErpcStatus_MemoryError;
+    }
+    else
+    {
+        codec->startWriteMessage(message_type_t::kInvocationMessage, m_serviceId, m_resetId, request.getSequence());
+
+        // Send message to server
+        // Codec status is checked inside this function.
+        m_clientManager->performRequest(request);
+
+        err = codec->getStatus();
+    }
+
+    // Dispose of the request.
+    m_clientManager->releaseRequest(request);
+
+    // Invoke error handler callback function
+    m_clientManager->callErrorHandler(err, m_resetId);
+}
+
+TEST_F(StatsServiceTest, GeneratedClientReadsCounters)
+{
+    eRPCMethodStats stats = {};
+    uint32_t result = 0U;
+    uint32_t latencyCalls = 0U;
+
+    EXPECT_EQ(m_stats.getMethodCount(), 0U);
+
+    for (uint32_t i = 0U; i < 3U; ++i)
+    {
+        ASSERT_EQ(testCallAddOne(&m_client, i, &result), kErpcStatus_Success);
+        EXPECT_EQ(result, i + 1U);
+    }
+
+    // Calls are recorded after their reply is written, so the count does not include the current call.
+    EXPECT_EQ(m_stats.getMethodCount(), 2U);
+
+    ASSERT_TRUE(m_stats.getMethodStats(0U, &stats));
+    EXPECT_EQ(stats.serviceId, (uint32_t)StatsService::kServiceId);
+    EXPECT_EQ(stats.methodId, (uint32_t)StatsService::kGetMethodCountId);
+    EXPECT_EQ(stats.calls, 2U);
+
+    ASSERT_TRUE(m_stats.getMethodStats(1U, &stats));
+    EXPECT_EQ(stats.serviceId, (uint32_t)TEST_SERVICE_ID);
+    EXPECT_EQ(stats.methodId, (uint32_t)TEST_METHOD_ADD_ONE);
+    EXPECT_EQ(stats.calls, 3U);
+    EXPECT_EQ(stats.errors, 0U);
+    EXPECT_GT(stats.requestBytes, 0U);
+    EXPECT_EQ(stats.requestBytes % 3U, 0U);
+    EXPECT_EQ(stats.replyBytes, stats.requestBytes);
+    for (uint32_t bucket = 0U; bucket < erpc_stats_latency_buckets; ++bucket)
+    {
+        latencyCalls += stats.latency[bucket];
+    }
+    EXPECT_EQ(latencyCalls, 3U);
+
+    EXPECT_FALSE(m_stats.getMethodStats(m_stats.getMethodCount(), &stats));
+    EXPECT_EQ(m_stats.getUntrackedCount(), 0U);
+}
+
+TEST_F(StatsServiceTest, ResetZeroesCounters)
+{
+    eRPCMethodStats stats = {};
+    uint32_t result = 0U;
+
+    ASSERT_EQ(testCallAddOne(&m_client, 1U, &result), kErpcStatus_Success);
+    m_stats.reset();
+
+    // Methods keep their slots, the reset call itself is recorded after the reset.
+    EXPECT_EQ(m_stats.getMethodCount(), 2U);
+    ASSERT_TRUE(m_stats.getMethodStats(0U, &stats));
+    EXPECT_EQ(stats.methodId, (uint32_t)TEST_METHOD_ADD_ONE);
+    EXPECT_EQ(stats.calls, 0U);
+    EXPECT_EQ(stats.requestBytes, 0U);
+    ASSERT_TRUE(m_stats.getMethodStats(1U, &stats));
+    EXPECT_EQ(stats.serviceId, (uint32_t)StatsService::kServiceId);
+    EXPECT_EQ(stats.methodId, (uint32_t)StatsService::kResetId);
+    EXPECT_EQ(stats.calls, 1U);
+}
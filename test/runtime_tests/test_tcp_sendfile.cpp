@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_crc16.hpp"
+#include "erpc_tcp_transport.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_TCP_SENDFILE_PORT (12470U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Client sending to its own server over loopback.
+ *
+ * Each test uses its own port. Server thread blocks in accept() until the test program exits, so servers are never
+ * destroyed.
+ */
+class TcpSendFileTest : public ::testing::Test
+{
+protected:
+    Crc16 m_crc16;
+    TCPTransport *m_server = NULL;
+    TCPTransport *m_client = NULL;
+    std::vector<uint8_t> m_sendData;
+    std::vector<uint8_t> m_receiveData;
+    MessageBuffer m_sendMessage;
+    MessageBuffer m_receiveMessage;
+
+    virtual void SetUp(void) override
+    {
+        static uint16_t s_port = TEST_TCP_SENDFILE_PORT;
+        uint16_t port = s_port++;
+
+        m_sendData.resize(UINT16_MAX);
+        m_receiveData.resize(UINT16_MAX);
+        m_sendMessage.set(m_sendData.data(), (uint16_t)m_sendData.size());
+        m_receiveMessage.set(m_receiveData.data(), (uint16_t)m_receiveData.size());
+
+        m_server = new TCPTransport("localhost", port, true);
+        m_server->setCrc16(&m_crc16);
+        ASSERT_EQ(m_server->open(), kErpcStatus_Success);
+
+        m_client = new TCPTransport("localhost", port, false);
+        m_client->setCrc16(&m_crc16);
+        // Server binds the port from its own thread.
+        ASSERT_TRUE(testWaitFor([&] { return m_client->open() == kErpcStatus_Success; }));
+    }
+
+    virtual void TearDown(void) override
+    {
+        if (m_client != NULL)
+        {
+            (void)m_client->close();
+            delete m_client;
+        }
+    }
+
+    //! @brief Send message with pattern data, the server receives and checks it.
+    void sendAndCheck(uint32_t size, uint8_t seed)
+    {
+        const uint8_t headerSize = m_client->reserveHeaderSize();
+
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            m_sendData[headerSize + i] = (uint8_t)(seed + i);
+        }
+        m_sendMessage.setUsed((uint16_t)(headerSize + size));
+
+        ASSERT_EQ(m_client->send(&m_sendMessage), kErpcStatus_Success);
+        ASSERT_EQ(m_server->receive(&m_receiveMessage), kErpcStatus_Success);
+        ASSERT_EQ(m_receiveMessage.getUsed(), headerSize + size);
+        EXPECT_EQ(memcmp(&m_receiveData[headerSize], &m_sendData[headerSize], size), 0);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TcpSendFileTest, FileDataEndTheFrame)
+{
+    const uint8_t headerSize = m_client->reserveHeaderSize();
+    const uint32_t prefixSize = 12U;
+    const uint32_t fileOffset = 5000U;
+    const uint32_t fileSize = 30000U;
+    std::vector<uint8_t> file(fileOffset + fileSize);
+    FILE *stream = tmpfile();
+
+    ASSERT_NE(stream, nullptr);
+    for (uint32_t i = 0; i < file.size(); ++i)
+    {
+        file[i] = (uint8_t)((i * 7U) + (i >> 8));
+    }
+    ASSERT_EQ(fwrite(file.data(), 1U, file.size(), stream), file.size());
+    ASSERT_EQ(fflush(stream), 0);
+
+    for (uint32_t i = 0; i < prefixSize; ++i)
+    {
+        m_sendData[headerSize + i] = (uint8_t)(0xA0U + i);
+    }
+    m_sendMessage.setUsed((uint16_t)(headerSize + prefixSize));
+
+    ASSERT_EQ(m_client->sendFile(&m_sendMessage, fileno(stream), fileOffset, fileSize), kErpcStatus_Success);
+    ASSERT_EQ(m_server->receive(&m_receiveMessage), kErpcStatus_Success);
+    ASSERT_EQ(m_receiveMessage.getUsed(), headerSize + prefixSize + fileSize);
+    EXPECT_EQ(memcmp(&m_receiveData[headerSize], &m_sendData[headerSize], prefixSize), 0);
+    EXPECT_EQ(memcmp(&m_receiveData[headerSize + prefixSize], &file[fileOffset], fileSize), 0);
+
+    // Frame would not fit 16 bit size.
+    EXPECT_EQ(m_client->sendFile(&m_sendMessage, fileno(stream), 0U, UINT16_MAX), kErpcStatus_InvalidArgument);
+
+    // Stream is still in sync after the file frame.
+    sendAndCheck(100U, 4U);
+
+    (void)fclose(stream);
+}
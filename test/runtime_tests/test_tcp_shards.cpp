@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_basic_codec.hpp"
+#include "erpc_crc16.hpp"
+#include "erpc_simple_server.hpp"
+#include "erpc_transport_setup.h"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <chrono>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <thread>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_TCP_SHARDS_PORT (12450U)
+#define TEST_TCP_SHARDS_COUNT (2U)
+#define TEST_TCP_SHARDS_CLIENTS (16U)
+#define TEST_TCP_SHARD_GROUP_PORT (12490U)
+#define TEST_TCP_SHARD_GROUP_CLIENTS (4U)
+#define TEST_TCP_SHARD_GROUP_CALLS (500U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief One shard of sharded server. Server threads block in the transport and live until the test program exits.
+ */
+struct TcpShard
+{
+    erpc_transport_t transport;
+    Crc16 crc16;
+    TestMessageBufferFactory messageFactory;
+    BasicCodecFactory codecFactory;
+    SimpleServer server;
+    TestService service;
+};
+
+/*!
+ * @brief Shards of shard group and CPUs their threads run on.
+ */
+struct TcpShardGroup
+{
+    TcpShard shards[TEST_TCP_SHARDS_COUNT];
+    uint32_t cpuMasks[TEST_TCP_SHARDS_COUNT];
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+static erpc_transport_stats_t getStats(erpc_transport_t transport)
+{
+    erpc_transport_stats_t stats;
+
+    erpc_transport_get_stats(transport, &stats);
+
+    return stats;
+}
+
+static uint32_t toCpuMask(const cpu_set_t &set)
+{
+    uint32_t mask = 0U;
+
+    for (uint32_t cpu = 0U; cpu < 32U; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &set))
+        {
+            mask |= 1U << cpu;
+        }
+    }
+
+    return mask;
+}
+
+static void setupShard(TcpShard &shard, erpc_transport_t transport)
+{
+    shard.transport = transport;
+    reinterpret_cast<Transport *>(transport)->setCrc16(&shard.crc16);
+    shard.server.setTransport(reinterpret_cast<Transport *>(transport));
+    shard.server.setCodecFactory(&shard.codecFactory);
+    shard.server.setMessageBufferFactory(&shard.messageFactory);
+    shard.server.addService(&shard.service);
+}
+
+static void serveShardGroup(erpc_transport_t transport, uint32_t index, void *context)
+{
+    TcpShardGroup *group = reinterpret_cast<TcpShardGroup *>(context);
+    TcpShard &shard = group->shards[index];
+    cpu_set_t set;
+
+    setupShard(shard, transport);
+    CPU_ZERO(&set);
+    (void)pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+    __atomic_store_n(&group->cpuMasks[index], toCpuMask(set), __ATOMIC_RELEASE);
+
+    // Server returns when client disconnects.
+    for (;;)
+    {
+        (void)shard.server.run();
+    }
+}
+
+static bool waitForDisconnects(TcpShard (&shards)[TEST_TCP_SHARDS_COUNT])
+{
+    return testWaitFor([&] {
+        for (TcpShard &shard : shards)
+        {
+            erpc_transport_stats_t stats = getStats(shard.transport);
+            if (stats.connects != stats.disconnects)
+            {
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+static erpc_transport_t connectClient(uint16_t port = TEST_TCP_SHARDS_PORT)
+{
+    erpc_transport_t transport = NULL;
+
+    // Shards bind the port from their own threads.
+    (void)testWaitFor([&] {
+        transport = erpc_transport_tcp_init("localhost", port, false);
+        return transport != NULL;
+    });
+
+    return transport;
+}
+
+TEST(TcpShards, ShardsShareListeningPort)
+{
+    static TcpShard shards[TEST_TCP_SHARDS_COUNT];
+    uint32_t connects = 0;
+    uint32_t result;
+
+    for (TcpShard &shard : shards)
+    {
+        erpc_transport_t transport = erpc_transport_tcp_shard_init("localhost", TEST_TCP_SHARDS_PORT);
+        ASSERT_NE(transport, nullptr);
+
+        setupShard(shard, transport);
+        std::thread([&shard] {
+            // Server returns when client disconnects.
+            for (;;)
+            {
+                (void)shard.server.run();
+            }
+        }).detach();
+    }
+
+    for (uint32_t i = 0; i < TEST_TCP_SHARDS_CLIENTS; ++i)
+    {
+        Crc16 crc16;
+        TestMessageBufferFactory messageFactory;
+        BasicCodecFactory codecFactory;
+        ClientManager client;
+        erpc_transport_t transport = connectClient();
+
+        ASSERT_NE(transport, nullptr);
+        reinterpret_cast<Transport *>(transport)->setCrc16(&crc16);
+        client.setTransport(reinterpret_cast<Transport *>(transport));
+        client.setCodecFactory(&codecFactory);
+        client.setMessageBufferFactory(&messageFactory);
+
+        EXPECT_EQ(testCallAddOne(&client, i, &result), kErpcStatus_Success);
+        EXPECT_EQ(result, i + 1U);
+
+        erpc_transport_tcp_close(transport);
+        erpc_transport_tcp_deinit(transport);
+
+        // Each shard serves one connection at a time, wait until it sees the client leave.
+        EXPECT_TRUE(waitForDisconnects(shards));
+    }
+
+    // Kernel spreads connections between shards by hash of the client address.
+    for (TcpShard &shard : shards)
+    {
+        erpc_transport_stats_t stats = getStats(shard.transport);
+        EXPECT_GT(stats.connects, 0U);
+        connects += stats.connects;
+    }
+    EXPECT_EQ(connects, TEST_TCP_SHARDS_CLIENTS);
+}
+
+TEST(TcpShards, ShardGroupPinsShardsAndServesClients)
+{
+    static TcpShardGroup group;
+    uint32_t calls = 0;
+    uint32_t processMask;
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(set), &set), 0);
+    processMask = toCpuMask(set);
+    ASSERT_NE(processMask, 0U);
+
+    ASSERT_TRUE(erpc_transport_tcp_shard_group_init("localhost", TEST_TCP_SHARD_GROUP_PORT, TEST_TCP_SHARDS_COUNT,
+                                                    processMask, serveShardGroup, &group));
+    EXPECT_TRUE(testWaitFor([&] {
+        for (uint32_t &cpuMask : group.cpuMasks)
+        {
+            if (__atomic_load_n(&cpuMask, __ATOMIC_ACQUIRE) == 0U)
+            {
+                return false;
+            }
+        }
+        return true;
+    }));
+
+    // Every shard runs on single CPU, shards are spread over CPUs of the process in order.
+    for (uint32_t i = 0; i < TEST_TCP_SHARDS_COUNT; ++i)
+    {
+        uint32_t cpuMask = __atomic_load_n(&group.cpuMasks[i], __ATOMIC_ACQUIRE);
+        uint32_t expected = processMask;
+
+        for (uint32_t n = i % __builtin_popcount(processMask); n > 0U; --n)
+        {
+            expected &= expected - 1U;
+        }
+        expected &= ~(expected - 1U);
+        EXPECT_EQ(cpuMask, expected);
+    }
+
+    // Shards serve one connection at a time, so clients take turns and each measures calls over its connection.
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < TEST_TCP_SHARD_GROUP_CLIENTS; ++i)
+    {
+        Crc16 crc16;
+        TestMessageBufferFactory messageFactory;
+        BasicCodecFactory codecFactory;
+        ClientManager client;
+        erpc_transport_t transport = connectClient(TEST_TCP_SHARD_GROUP_PORT);
+        uint32_t result;
+
+        ASSERT_NE(transport, nullptr);
+        reinterpret_cast<Transport *>(transport)->setCrc16(&crc16);
+        client.setTransport(reinterpret_cast<Transport *>(transport));
+        client.setCodecFactory(&codecFactory);
+        client.setMessageBufferFactory(&messageFactory);
+
+        for (uint32_t value = 0; value < TEST_TCP_SHARD_GROUP_CALLS; ++value)
+        {
+            if ((testCallAddOne(&client, value, &result) == kErpcStatus_Success) && (result == value + 1U))
+            {
+                ++calls;
+            }
+        }
+
+        erpc_transport_tcp_close(transport);
+        erpc_transport_tcp_deinit(transport);
+        EXPECT_TRUE(waitForDisconnects(group.shards));
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - begin;
+
+    EXPECT_EQ(calls, TEST_TCP_SHARD_GROUP_CLIENTS * TEST_TCP_SHARD_GROUP_CALLS);
+    RecordProperty("calls_per_second", std::to_string(static_cast<uint32_t>(calls / elapsed.count())));
+}
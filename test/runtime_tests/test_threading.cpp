@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "erpc_threading.h"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <linux/capability.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Stack size which is not clamped by the system.
+#define TEST_THREAD_STACK_SIZE (512U * 1024U)
+
+//! @brief Step making probe thread exit.
+#define TEST_THREAD_PROBE_EXIT (0xFFFFFFFFU)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Scheduling seen by a thread from inside. The thread records it, then waits for the next step.
+ */
+struct ThreadProbe
+{
+    uint32_t step;     /*!< Step the test asked for, the thread exits on step TEST_THREAD_PROBE_EXIT. */
+    uint32_t recorded; /*!< Last step recorded by the thread. */
+    uint32_t cpuMask;  /*!< CPUs thread can run on. */
+    size_t stackSize;  /*!< Size of thread stack. */
+    int policy;        /*!< Scheduling policy of thread. */
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+static uint32_t toCpuMask(const cpu_set_t &set)
+{
+    uint32_t mask = 0U;
+
+    for (uint32_t cpu = 0U; cpu < 32U; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &set))
+        {
+            mask |= 1U << cpu;
+        }
+    }
+
+    return mask;
+}
+
+static uint32_t getProcessCpuMask(void)
+{
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    (void)sched_getaffinity(0, sizeof(set), &set);
+
+    return toCpuMask(set);
+}
+
+static void recordProbe(ThreadProbe *probe, uint32_t step)
+{
+    pthread_attr_t attr;
+    struct sched_param param;
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    (void)pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+    probe->cpuMask = toCpuMask(set);
+
+    (void)pthread_getattr_np(pthread_self(), &attr);
+    (void)pthread_attr_getstacksize(&attr, &probe->stackSize);
+    (void)pthread_attr_destroy(&attr);
+
+    (void)pthread_getschedparam(pthread_self(), &probe->policy, &param);
+
+    __atomic_store_n(&probe->recorded, step, __ATOMIC_RELEASE);
+}
+
+static void probeThread(void *arg)
+{
+    ThreadProbe *probe = reinterpret_cast<ThreadProbe *>(arg);
+    uint32_t step = 0U;
+
+    for (;;)
+    {
+        recordProbe(probe, step);
+        while (__atomic_load_n(&probe->step, __ATOMIC_ACQUIRE) == step)
+        {
+            Thread::sleep(1000);
+        }
+        step = __atomic_load_n(&probe->step, __ATOMIC_ACQUIRE);
+        if (step == TEST_THREAD_PROBE_EXIT)
+        {
+            break;
+        }
+    }
+    __atomic_store_n(&probe->recorded, TEST_THREAD_PROBE_EXIT, __ATOMIC_RELEASE);
+}
+
+//! @brief Ask probe thread to record its scheduling again and wait until it does.
+static bool stepProbe(ThreadProbe *probe, uint32_t step)
+{
+    __atomic_store_n(&probe->step, step, __ATOMIC_RELEASE);
+    return testWaitFor([probe, step] { return __atomic_load_n(&probe->recorded, __ATOMIC_ACQUIRE) == step; });
+}
+
+//! @brief Drop privilege for real-time scheduling from the calling thread only.
+static bool dropSysNice(void)
+{
+    struct __user_cap_header_struct header = { _LINUX_CAPABILITY_VERSION_3, 0 };
+    struct __user_cap_data_struct data[_LINUX_CAPABILITY_U32S_3] = {};
+
+    bool retVal = (syscall(SYS_capget, &header, data) == 0);
+
+    if (retVal)
+    {
+        data[0].effective &= ~(1U << CAP_SYS_NICE);
+        retVal = (syscall(SYS_capset, &header, data) == 0);
+    }
+
+    return retVal;
+}
+
+TEST(Threading, AffinitySetBeforeStartApplies)
+{
+    uint32_t processMask = getProcessCpuMask();
+    uint32_t cpuMask = processMask & ~(processMask - 1U);
+    ThreadProbe probe = {};
+    Thread thread(probeThread);
+
+    ASSERT_NE(cpuMask, 0U);
+    EXPECT_TRUE(thread.setCpuAffinity(cpuMask));
+    thread.start(&probe);
+    ASSERT_TRUE(stepProbe(&probe, 1U));
+    EXPECT_EQ(probe.cpuMask, cpuMask);
+    EXPECT_TRUE(stepProbe(&probe, TEST_THREAD_PROBE_EXIT));
+}
+
+TEST(Threading, AffinityOfRunningThreadChanges)
+{
+    uint32_t processMask = getProcessCpuMask();
+    uint32_t cpuMask = processMask & ~(processMask - 1U);
+    ThreadProbe probe = {};
+    Thread thread(probeThread);
+
+    thread.start(&probe);
+    ASSERT_TRUE(stepProbe(&probe, 1U));
+    EXPECT_EQ(probe.cpuMask, processMask);
+
+    EXPECT_TRUE(thread.setCpuAffinity(cpuMask));
+    ASSERT_TRUE(stepProbe(&probe, 2U));
+    EXPECT_EQ(probe.cpuMask, cpuMask);
+
+    // Zero allows every CPU again.
+    EXPECT_TRUE(thread.setCpuAffinity(0U));
+    ASSERT_TRUE(stepProbe(&probe, 3U));
+    EXPECT_EQ(probe.cpuMask, processMask);
+
+    EXPECT_TRUE(stepProbe(&probe, TEST_THREAD_PROBE_EXIT));
+}
+
+TEST(Threading, StackSizeIsApplied)
+{
+    ThreadProbe probe = {};
+    Thread thread(probeThread, 0U, TEST_THREAD_STACK_SIZE);
+
+    thread.start(&probe);
+    ASSERT_TRUE(stepProbe(&probe, 1U));
+    EXPECT_GE(probe.stackSize, TEST_THREAD_STACK_SIZE);
+    EXPECT_LT(probe.stackSize, 2U * TEST_THREAD_STACK_SIZE);
+    EXPECT_TRUE(stepProbe(&probe, TEST_THREAD_PROBE_EXIT));
+}
+
+TEST(Threading, TooSmallStackSizeIsClamped)
+{
+    ThreadProbe probe = {};
+    Thread thread(probeThread, 0U, 1U);
+
+    thread.start(&probe);
+    ASSERT_TRUE(stepProbe(&probe, 1U));
+    // Rejected size would leave the default stack of several megabytes.
+    EXPECT_GE(probe.stackSize, (size_t)PTHREAD_STACK_MIN);
+    EXPECT_LT(probe.stackSize, 2U * (size_t)PTHREAD_STACK_MIN);
+    EXPECT_TRUE(stepProbe(&probe, TEST_THREAD_PROBE_EXIT));
+}
+
+TEST(Threading, PriorityWithoutPrivilegeStillStarts)
+{
+    struct rlimit limit;
+    ThreadProbe probe = {};
+    Thread thread(probeThread, 10U);
+    bool dropped = false;
+
+    ASSERT_EQ(getrlimit(RLIMIT_RTPRIO, &limit), 0);
+    if (limit.rlim_cur != 0U)
+    {
+        // Real-time priority is allowed without privilege, nothing to fall back from.
+        return;
+    }
+
+    // Capabilities are per thread, the creating thread and the thread it creates lose CAP_SYS_NICE.
+    std::thread([&] {
+        dropped = dropSysNice();
+        if (dropped)
+        {
+            thread.start(&probe);
+        }
+    }).join();
+    ASSERT_TRUE(dropped);
+
+    ASSERT_TRUE(stepProbe(&probe, 1U));
+    EXPECT_EQ(probe.policy, SCHED_OTHER);
+    EXPECT_TRUE(stepProbe(&probe, TEST_THREAD_PROBE_EXIT));
+}
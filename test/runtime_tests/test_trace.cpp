@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_trace.h"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Service id marking records of tests, calls of other tests record other ids.
+#define TRACE_MARK (0xa5U)
+
+//! @brief Count of records checked for order.
+#define TRACE_ORDERED_RECORDS (100U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Starts each test with empty rings and collects marked records when draining.
+ */
+class TraceTest : public ::testing::Test
+{
+protected:
+    std::vector<erpc_trace_record_t> m_records;
+
+    virtual void SetUp(void) override { (void)erpc_trace_drain(NULL, NULL); }
+
+    static void collect(const erpc_trace_record_t *records, uint32_t count, void *context)
+    {
+        std::vector<erpc_trace_record_t> *collected = reinterpret_cast<std::vector<erpc_trace_record_t> *>(context);
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (records[i].serviceId == TRACE_MARK)
+            {
+                collected->push_back(records[i]);
+            }
+        }
+    }
+
+    void drain(void)
+    {
+        m_records.clear();
+        (void)erpc_trace_drain(collect, &m_records);
+    }
+
+    static void record(uint32_t sequence)
+    {
+        erpc_trace_record(kErpcTrace_Send, TRACE_MARK, 1U, sequence, sequence * 10U, sequence);
+    }
+};
+
+/*!
+ * @brief Thread keeping its ring until released.
+ */
+class RingHolder
+{
+public:
+    RingHolder(void) : m_recorded(false), m_release(false), m_thread(&RingHolder::run, this) {}
+
+    ~RingHolder(void)
+    {
+        m_release = true;
+        m_thread.join();
+    }
+
+    std::atomic<bool> m_recorded; /*!< Thread recorded its record. */
+
+protected:
+    std::atomic<bool> m_release; /*!< Thread can exit. */
+    std::thread m_thread;        /*!< Recording thread. */
+
+    void run(void)
+    {
+        erpc_trace_record(kErpcTrace_Send, TRACE_MARK, 1U, 0U, 0U, 0U);
+        m_recorded = true;
+        while (!m_release)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TraceTest, RecordsAreDrainedInOrder)
+{
+    // Records stay in the ring after the thread exits and released it.
+    std::thread recorder([]() {
+        for (uint32_t i = 0; i < TRACE_ORDERED_RECORDS; ++i)
+        {
+            record(i);
+        }
+    });
+    recorder.join();
+
+    drain();
+    ASSERT_EQ(m_records.size(), TRACE_ORDERED_RECORDS);
+    for (uint32_t i = 0; i < TRACE_ORDERED_RECORDS; ++i)
+    {
+        EXPECT_EQ(m_records[i].sequence, i);
+        EXPECT_EQ(m_records[i].timestamp, i);
+        EXPECT_EQ(m_records[i].length, i * 10U);
+        EXPECT_EQ(m_records[i].event, kErpcTrace_Send);
+        EXPECT_EQ(m_records[i].methodId, 1U);
+        EXPECT_EQ(m_records[i].thread, m_records[0].thread);
+    }
+
+    // Drained records are freed.
+    drain();
+    EXPECT_EQ(m_records.size(), 0U);
+}
+
+TEST_F(TraceTest, FullRingDropsRecords)
+{
+    uint32_t dropped = erpc_trace_get_dropped();
+    uint32_t drained = 0;
+    uint32_t droppedAfterDrain = 0;
+
+    std::thread recorder([&]() {
+        for (uint32_t i = 0; i < (ERPC_TRACE_BUFFER_SIZE + 5U); ++i)
+        {
+            record(i);
+        }
+        drained = erpc_trace_drain(NULL, NULL);
+
+        // Drained ring takes records again.
+        record(0U);
+        droppedAfterDrain = erpc_trace_get_dropped();
+    });
+    recorder.join();
+
+    EXPECT_EQ(drained, ERPC_TRACE_BUFFER_SIZE);
+    EXPECT_EQ(droppedAfterDrain - dropped, 5U);
+    drain();
+    EXPECT_EQ(m_records.size(), 1U);
+}
+
+TEST_F(TraceTest, RecordsAreDroppedWhenAllRingsAreTaken)
+{
+    std::vector<std::unique_ptr<RingHolder>> holders;
+    uint32_t dropped = erpc_trace_get_dropped();
+    bool allTaken = false;
+
+    // Rings can also be held by threads of other tests which still run, so holders are added until one is refused.
+    while (!allTaken && (holders.size() <= ERPC_TRACE_THREADS))
+    {
+        holders.emplace_back(new RingHolder());
+        ASSERT_TRUE(testWaitFor([&]() { return holders.back()->m_recorded.load(); }));
+        allTaken = (erpc_trace_get_dropped() != dropped);
+    }
+    ASSERT_TRUE(allTaken);
+    EXPECT_EQ(erpc_trace_get_dropped() - dropped, 1U);
+
+    // Exited threads release their rings.
+    holders.clear();
+    dropped = erpc_trace_get_dropped();
+    std::thread recorder([]() { record(0U); });
+    recorder.join();
+    EXPECT_EQ(erpc_trace_get_dropped(), dropped);
+}
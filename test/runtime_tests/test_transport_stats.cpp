@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "erpc_crc16.hpp"
+#include "erpc_framed_transport.hpp"
+#include "erpc_transport_setup.h"
+
+#include "gtest.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+//! @brief Size of frame header of framed transports.
+#define FRAME_HEADER_SIZE (6U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief Framed transport sending to and receiving from a byte vector.
+ */
+class MemoryFramedTransport : public FramedTransport
+{
+public:
+    MemoryFramedTransport(void) : m_readPos(0), m_failSend(false) {}
+
+    std::vector<uint8_t> m_data; /*!< Sent bytes, received from m_readPos. */
+    size_t m_readPos;            /*!< Position of next received byte. */
+    bool m_failSend;             /*!< Send fails. */
+
+protected:
+    virtual erpc_status_t underlyingSend(const uint8_t *data, uint32_t size) override
+    {
+        if (m_failSend)
+        {
+            return kErpcStatus_SendFailed;
+        }
+        m_data.insert(m_data.end(), data, data + size);
+        return kErpcStatus_Success;
+    }
+
+    virtual erpc_status_t underlyingReceive(uint8_t *data, uint32_t size) override
+    {
+        if ((m_data.size() - m_readPos) < size)
+        {
+            return kErpcStatus_ReceiveFailed;
+        }
+        (void)memcpy(data, &m_data[m_readPos], size);
+        m_readPos += size;
+        return kErpcStatus_Success;
+    }
+};
+
+/*!
+ * @brief Framed transport read through the setup API.
+ */
+class TransportStatsTest : public ::testing::Test
+{
+protected:
+    Crc16 m_crc16;
+    MemoryFramedTransport m_transport;
+    uint8_t m_buffer[128];
+
+    virtual void SetUp(void) override { m_transport.setCrc16(&m_crc16); }
+
+    erpc_transport_stats_t getStats(void)
+    {
+        erpc_transport_stats_t stats;
+
+        (void)memset(&stats, 0xff, sizeof(stats));
+        erpc_transport_get_stats(reinterpret_cast<erpc_transport_t>(static_cast<Transport *>(&m_transport)), &stats);
+        return stats;
+    }
+
+    erpc_status_t sendMessage(uint32_t size)
+    {
+        MessageBuffer message(m_buffer, sizeof(m_buffer));
+
+        for (uint32_t i = 0U; i < size; ++i)
+        {
+            m_buffer[FRAME_HEADER_SIZE + i] = (uint8_t)i;
+        }
+        message.setUsed(FRAME_HEADER_SIZE + size);
+        return m_transport.send(&message);
+    }
+
+    erpc_status_t receiveMessage(void)
+    {
+        MessageBuffer message(m_buffer, sizeof(m_buffer));
+
+        return m_transport.receive(&message);
+    }
+
+    /*!
+     * @brief Change size in header of the first sent frame, keeping the header valid.
+     */
+    void setFrameSize(uint16_t size)
+    {
+        uint16_t crcBody;
+        uint16_t crcHeader;
+
+        // Header is CRC of header, message size and CRC of body, each 16 bits little endian.
+        (void)memcpy(&crcBody, &m_transport.m_data[4], sizeof(crcBody));
+        crcHeader = m_crc16.computeCRC16(reinterpret_cast<const uint8_t *>(&size), sizeof(size)) +
+                    m_crc16.computeCRC16(reinterpret_cast<const uint8_t *>(&crcBody), sizeof(crcBody));
+        (void)memcpy(&m_transport.m_data[0], &crcHeader, sizeof(crcHeader));
+        (void)memcpy(&m_transport.m_data[2], &size, sizeof(size));
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(TransportStatsTest, FramesAreCounted)
+{
+    erpc_transport_stats_t stats;
+
+    ASSERT_EQ(sendMessage(10U), kErpcStatus_Success);
+    ASSERT_EQ(sendMessage(40U), kErpcStatus_Success);
+    ASSERT_EQ(receiveMessage(), kErpcStatus_Success);
+    ASSERT_EQ(receiveMessage(), kErpcStatus_Success);
+
+    stats = getStats();
+    EXPECT_EQ(stats.messagesSent, 2U);
+    EXPECT_EQ(stats.messagesReceived, 2U);
+    EXPECT_EQ(stats.bytesSent, 50U + (2U * FRAME_HEADER_SIZE));
+    EXPECT_EQ(stats.bytesReceived, 50U + (2U * FRAME_HEADER_SIZE));
+    EXPECT_EQ(stats.maxFrameSize, 40U + FRAME_HEADER_SIZE);
+    EXPECT_EQ(stats.sendErrors, 0U);
+    EXPECT_EQ(stats.receiveErrors, 0U);
+    EXPECT_EQ(stats.crcErrors, 0U);
+    EXPECT_EQ(stats.framingErrors, 0U);
+
+    // Link level counters are not kept by the framing layer.
+    EXPECT_EQ(stats.syscalls, 0U);
+    EXPECT_EQ(stats.wouldBlock, 0U);
+    EXPECT_EQ(stats.partialTransfers, 0U);
+    EXPECT_EQ(stats.connects, 0U);
+    EXPECT_EQ(stats.disconnects, 0U);
+}
+
+TEST_F(TransportStatsTest, ErrorsAreCounted)
+{
+    erpc_transport_stats_t stats;
+    uint16_t bigSize = sizeof(m_buffer);
+
+    m_transport.m_failSend = true;
+    EXPECT_EQ(sendMessage(10U), kErpcStatus_SendFailed);
+    m_transport.m_failSend = false;
+
+    // Corrupted body.
+    ASSERT_EQ(sendMessage(10U), kErpcStatus_Success);
+    m_transport.m_data[FRAME_HEADER_SIZE + 1U] ^= 0xffU;
+    EXPECT_EQ(receiveMessage(), kErpcStatus_CrcCheckFailed);
+
+    // Corrupted header, its body stays unread.
+    m_transport.m_data.clear();
+    m_transport.m_readPos = 0U;
+    ASSERT_EQ(sendMessage(10U), kErpcStatus_Success);
+    m_transport.m_data[0] ^= 0xffU;
+    EXPECT_EQ(receiveMessage(), kErpcStatus_CrcCheckFailed);
+
+    // Frame bigger than the receive buffer, header is valid.
+    m_transport.m_data.clear();
+    m_transport.m_readPos = 0U;
+    ASSERT_EQ(sendMessage(10U), kErpcStatus_Success);
+    setFrameSize(bigSize);
+    EXPECT_EQ(receiveMessage(), kErpcStatus_ReceiveFailed);
+
+    // Nothing left to receive.
+    m_transport.m_readPos = m_transport.m_data.size();
+    EXPECT_EQ(receiveMessage(), kErpcStatus_ReceiveFailed);
+
+    stats = getStats();
+    EXPECT_EQ(stats.messagesSent, 3U);
+    EXPECT_EQ(stats.sendErrors, 1U);
+    EXPECT_EQ(stats.messagesReceived, 0U);
+    EXPECT_EQ(stats.bytesReceived, 0U);
+    EXPECT_EQ(stats.receiveErrors, 4U);
+    EXPECT_EQ(stats.crcErrors, 2U);
+    EXPECT_EQ(stats.framingErrors, 1U);
+}
+
+TEST_F(TransportStatsTest, ResetZeroesCounters)
+{
+    erpc_transport_t transport = reinterpret_cast<erpc_transport_t>(static_cast<Transport *>(&m_transport));
+    erpc_transport_stats_t stats;
+    erpc_transport_stats_t zero;
+
+    ASSERT_EQ(sendMessage(10U), kErpcStatus_Success);
+    EXPECT_EQ(receiveMessage(), kErpcStatus_Success);
+    EXPECT_EQ(receiveMessage(), kErpcStatus_ReceiveFailed);
+
+    erpc_transport_reset_stats(transport);
+    stats = getStats();
+    (void)memset(&zero, 0, sizeof(zero));
+    EXPECT_EQ(memcmp(&stats, &zero, sizeof(stats)), 0);
+
+    ASSERT_EQ(sendMessage(20U), kErpcStatus_Success);
+    stats = getStats();
+    EXPECT_EQ(stats.messagesSent, 1U);
+    EXPECT_EQ(stats.maxFrameSize, 20U + FRAME_HEADER_SIZE);
+}
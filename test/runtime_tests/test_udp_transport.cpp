@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2024 Xiaomi Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "erpc_crc16.hpp"
+#include "erpc_udp_transport.hpp"
+
+#include "gtest.h"
+#include "runtime_test_common.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+using namespace erpc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#define TEST_UDP_PORT (12480U)
+
+////////////////////////////////////////////////////////////////////////////////
+// Classes
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * @brief UDP transport whose sequence numbers can be changed to simulate lost and late datagrams.
+ */
+class TestUdpTransport : public UdpTransport
+{
+public:
+    TestUdpTransport(const char *host, uint16_t port, bool isServer) : UdpTransport(host, port, isServer) {}
+
+    void setSendSequence(uint32_t sequence) { m_sendSequence = sequence; }
+};
+
+/*!
+ * @brief Client and server transports on loopback. Each test uses its own port.
+ */
+class UdpTransportTest : public ::testing::Test
+{
+protected:
+    Crc16 m_crc16;
+    uint16_t m_port = 0;
+    TestUdpTransport *m_server = NULL;
+    TestUdpTransport *m_client = NULL;
+    uint8_t m_sendData[128];
+    uint8_t m_receiveData[128];
+    MessageBuffer m_sendMessage{ m_sendData, sizeof(m_sendData) };
+    MessageBuffer m_receiveMessage{ m_receiveData, sizeof(m_receiveData) };
+
+    virtual void SetUp(void) override
+    {
+        static uint16_t s_port = TEST_UDP_PORT;
+
+        m_port = s_port++;
+        m_server = new TestUdpTransport("127.0.0.1", m_port, true);
+        m_client = new TestUdpTransport("127.0.0.1", m_port, false);
+        m_server->setCrc16(&m_crc16);
+        m_client->setCrc16(&m_crc16);
+        ASSERT_EQ(m_server->open(), kErpcStatus_Success);
+        ASSERT_EQ(m_client->open(), kErpcStatus_Success);
+    }
+
+    virtual void TearDown(void) override
+    {
+        delete m_client;
+        delete m_server;
+    }
+
+    //! @brief Put encoded message after the datagram header.
+    void prepare(message_type_t type, uint32_t value)
+    {
+        std::vector<uint8_t> encoded = testEncodeMessage(type, TEST_SERVICE_ID, TEST_METHOD_ONEWAY, 0U, value);
+        const uint8_t headerSize = m_client->reserveHeaderSize();
+
+        (void)memcpy(&m_sendData[headerSize], encoded.data(), encoded.size());
+        m_sendMessage.setUsed((uint16_t)(headerSize + encoded.size()));
+    }
+
+    //! @brief Receive message and return its value.
+    uint32_t receiveValue(TestUdpTransport *transport, message_type_t expectedType)
+    {
+        const uint8_t headerSize = transport->reserveHeaderSize();
+        message_type_t type;
+        uint32_t methodId;
+        uint32_t sequence;
+        uint32_t value = 0;
+
+        EXPECT_EQ(transport->receive(&m_receiveMessage), kErpcStatus_Success);
+        EXPECT_TRUE(testDecodeMessage(std::vector<uint8_t>(&m_receiveData[headerSize],
+                                                           &m_receiveData[m_receiveMessage.getUsed()]),
+                                      &type, &methodId, &sequence, &value));
+        EXPECT_EQ(type, expectedType);
+
+        return value;
+    }
+
+    //! @brief Send oneway message with the value from client.
+    void sendOneway(uint32_t value)
+    {
+        prepare(message_type_t::kOnewayMessage, value);
+        ASSERT_EQ(m_client->send(&m_sendMessage), kErpcStatus_Success);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Code
+////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(UdpTransportTest, CountsLostAndLateDatagrams)
+{
+    // Sequence numbers 0, 3, 1: two datagrams missing, then one of them arrives late.
+    sendOneway(10U);
+    m_client->setSendSequence(3U);
+    sendOneway(13U);
+    m_client->setSendSequence(1U);
+    sendOneway(11U);
+
+    EXPECT_EQ(receiveValue(m_server, message_type_t::kOnewayMessage), 10U);
+    EXPECT_EQ(receiveValue(m_server, message_type_t::kOnewayMessage), 13U);
+    EXPECT_EQ(m_server->getDroppedCount(), 2U);
+    EXPECT_EQ(m_server->getOutOfOrderCount(), 0U);
+
+    EXPECT_EQ(receiveValue(m_server, message_type_t::kOnewayMessage), 11U);
+    EXPECT_EQ(m_server->getDroppedCount(), 1U);
+    EXPECT_EQ(m_server->getOutOfOrderCount(), 1U);
+    EXPECT_EQ(m_server->getReceivedCount(), 3U);
+    EXPECT_EQ(m_server->getInvalidCount(), 0U);
+}
+
+TEST_F(UdpTransportTest, BatchIsSentTogether)
+{
+    ASSERT_EQ(m_client->setSendBatch(4U), kErpcStatus_Success);
+
+    for (uint32_t i = 0; i < 3U; ++i)
+    {
+        sendOneway(i);
+    }
+    // Messages wait until the batch is full.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(m_server->hasMessage());
+
+    sendOneway(3U);
+    sendOneway(4U);
+    for (uint32_t i = 0; i < 4U; ++i)
+    {
+        EXPECT_EQ(receiveValue(m_server, message_type_t::kOnewayMessage), i);
+    }
+
+    // Partial batch goes out by flush.
+    ASSERT_EQ(m_client->flush(), kErpcStatus_Success);
+    EXPECT_EQ(receiveValue(m_server, message_type_t::kOnewayMessage), 4U);
+    EXPECT_EQ(m_server->getDroppedCount(), 0U);
+    EXPECT_EQ(m_server->getReceivedCount(), 5U);
+
+    EXPECT_EQ(m_client->setSendBatch(0U), kErpcStatus_InvalidArgument);
+    EXPECT_EQ(m_client->setSendBatch(ERPC_UDP_BATCH_SIZE + 1U), kErpcStatus_InvalidArgument);
+}
+
+TEST_F(UdpTransportTest, ClientSendsOnewayOnly)
+{
+    prepare(message_type_t::kInvocationMessage, 1U);
+    EXPECT_EQ(m_client->send(&m_sendMessage), kErpcStatus_InvalidArgument);
+}
+
+TEST_F(UdpTransportTest, ServerDropsInvocation)
+{
+    std::vector<uint8_t> datagram(m_server->reserveHeaderSize(), 0U);
+    std::vector<uint8_t> encoded =
+        testEncodeMessage(message_type_t::kInvocationMessage, TEST_SERVICE_ID, TEST_METHOD_ADD_ONE, 1U, 5U);
+    struct sockaddr_in address;
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+
+    // Datagram without CRC from a sender which does not check the message type.
+    ASSERT_GE(sock, 0);
+    datagram.insert(datagram.end(), encoded.begin(), encoded.end());
+    (void)memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(m_port);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(sendto(sock, datagram.data(), datagram.size(), 0, reinterpret_cast<struct sockaddr *>(&address),
+                     sizeof(address)),
+              (ssize_t)datagram.size());
+    (void)close(sock);
+
+    sendOneway(6U);
+    EXPECT_EQ(receiveValue(m_server, message_type_t::kOnewayMessage), 6U);
+    EXPECT_EQ(m_server->getInvalidCount(), 1U);
+}
+
+TEST_F(UdpTransportTest, ServerSendsCreditToLastSender)
+{
+    // No sender is known yet.
+    prepare(message_type_t::kCreditMessage, 2U);
+    EXPECT_EQ(m_server->send(&m_sendMessage), kErpcStatus_ConnectionFailure);
+
+    sendOneway(1U);
+    EXPECT_EQ(receiveValue(m_server, message_type_t::kOnewayMessage), 1U);
+
+    prepare(message_type_t::kReplyMessage, 1U);
+    EXPECT_EQ(m_server->send(&m_sendMessage), kErpcStatus_InvalidArgument);
+
+    prepare(message_type_t::kCreditMessage, 2U);
+    ASSERT_EQ(m_server->send(&m_sendMessage), kErpcStatus_Success);
+    EXPECT_EQ(receiveValue(m_client, message_type_t::kCreditMessage), 2U);
+}
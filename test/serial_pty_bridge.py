@@ -0,0 +1,68 @@
+#! /usr/bin/python
+
+# Copyright (C) 2024 Xiaomi Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Null modem made of two pseudo terminals, so serial transport can be tested without hardware.
+# $./serial_pty_bridge.py [server_link client_link]
+# creates the two links (default /tmp/erpc_serial_server and /tmp/erpc_serial_client) pointing to pty slaves
+# and forwards everything written to one of them to the other until terminated.
+import os
+import select
+import signal
+import sys
+import tty
+
+serverLink = "/tmp/erpc_serial_server"
+clientLink = "/tmp/erpc_serial_client"
+if len(sys.argv) == 3:
+    serverLink = sys.argv[1]
+    clientLink = sys.argv[2]
+elif len(sys.argv) != 1:
+    print("Usage: serial_pty_bridge.py [server_link client_link]")
+    sys.exit(1)
+
+
+def openPort(link):
+    master, slave = os.openpty()
+    # Slave stays open, so master does not report hang up while no application has the port open.
+    tty.setraw(slave)
+    if os.path.lexists(link):
+        os.remove(link)
+    os.symlink(os.ttyname(slave), link)
+    return master, slave
+
+
+ports = [openPort(serverLink), openPort(clientLink)]
+peer = {ports[0][0]: ports[1][0], ports[1][0]: ports[0][0]}
+
+
+def stop(signum, frame):
+    for link in (serverLink, clientLink):
+        if os.path.lexists(link):
+            os.remove(link)
+    sys.exit(0)
+
+
+signal.signal(signal.SIGTERM, stop)
+signal.signal(signal.SIGINT, stop)
+
+while True:
+    readable, _, _ = select.select(list(peer.keys()), [], [])
+    for fd in readable:
+        try:
+            data = os.read(fd, 65536)
+        except OSError:
+            continue
+        os.write(peer[fd], data)